@@ -0,0 +1,215 @@
+//==============================================================================
+//
+//  CancellationToken.h
+//
+//  Copyleft 2026-
+//  Authors:
+//  - The FIG contributors
+//
+//------------------------------------------------------------------------------
+//
+//  This file is part of FIG.
+//
+//  The Finite Improbability Generator (FIG) project is free software;
+//  you can redistribute it and/or modify it under the terms of the GNU
+//  General Public License as published by the Free Software Foundation;
+//  either version 3 of the License, or (at your option) any later version.
+//
+//  FIG is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with FIG; if not, write to the Free Software Foundation,
+//	Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//==============================================================================
+
+
+#ifndef CANCELLATIONTOKEN_H
+#define CANCELLATIONTOKEN_H
+
+// C++
+#include <mutex>
+#include <chrono>
+#include <atomic>
+#include <thread>
+#include <functional>
+#include <condition_variable>
+
+
+namespace fig
+{
+
+/**
+ * @brief Cooperative cancellation flag with an optional deadline
+ *
+ *        Long computations (simulations, thresholds building, ...) poll a
+ *        token to know whether they should stop. Polling via the boolean
+ *        conversion is a relaxed atomic load, which costs nothing in the
+ *        simulations' hot path; the wall clock is never read there.
+ *        A deadline can be enforced either by a Watchdog, which flips the
+ *        token from its own thread when the time comes, or by calling
+ *        expired() in coarse-grained loops, e.g. in between simulations.
+ *
+ *        Deadlines are measured with the monotonic std::chrono::steady_clock,
+ *        so they're immune to changes of the system time.
+ *
+ * @note Thread safe: any thread can cancel() a token polled by others
+ * @see Watchdog
+ */
+class CancellationToken
+{
+public:
+
+	typedef  std::chrono::steady_clock  Clock;
+
+private:
+
+	/// Was cancellation requested?
+	mutable std::atomic< bool > cancelled_;
+
+	/// Deadline, as ticks since the clock's epoch (max() if none)
+	std::atomic< Clock::rep > deadline_;
+
+public:  // Ctors
+
+	/// Default ctor: not cancelled and without deadline
+	CancellationToken() noexcept :
+	    cancelled_(false),
+	    deadline_(Clock::time_point::max().time_since_epoch().count())
+		{ /* Not much to do around here */ }
+
+	/// Tokens identify a computation: no copies allowed
+	CancellationToken(const CancellationToken&) = delete;
+
+	/// Tokens identify a computation: no copies allowed
+	CancellationToken& operator=(const CancellationToken&) = delete;
+
+public:  // Accessors
+
+	/// Was cancellation requested? Doesn't check the deadline.
+	/// @note Cheapest possible poll, meant for hot paths
+	inline bool cancelled() const noexcept
+		{ return cancelled_.load(std::memory_order_relaxed); }
+
+	/// @copydoc cancelled()
+	inline explicit operator bool() const noexcept { return cancelled(); }
+
+	/// Deadline of the computation, or Clock::time_point::max() if none
+	inline Clock::time_point deadline() const noexcept
+		{ return Clock::time_point(Clock::duration(deadline_.load())); }
+
+	/// Whether a deadline was set
+	inline bool has_deadline() const noexcept
+		{ return deadline() < Clock::time_point::max(); }
+
+	/// Was cancellation requested, or has the deadline been reached?
+	/// @note Reads the clock if there's a deadline: use in coarse loops only
+	inline bool expired() const noexcept
+		{
+			if (cancelled())
+				return true;
+			if (has_deadline() && Clock::now() >= deadline()) {
+				cancelled_ = true;
+				return true;
+			}
+			return false;
+		}
+
+public:  // Modifiers
+
+	/// Request the computation to stop
+	inline void cancel() noexcept { cancelled_ = true; }
+
+	/// Forget about cancellation requests and deadline
+	inline void reset() noexcept
+		{
+			cancelled_ = false;
+			deadline_ = Clock::time_point::max().time_since_epoch().count();
+		}
+
+	/// Stop the computation when the \p deadline is reached
+	inline void set_deadline(const Clock::time_point& deadline) noexcept
+		{ deadline_ = deadline.time_since_epoch().count(); }
+
+	/// Stop the computation after \p budget time has elapsed from now
+	template< typename Rep, typename Period >
+	inline void set_budget(const std::chrono::duration<Rep,Period>& budget)
+		{
+			const auto now(Clock::now());
+			set_deadline(budget >= Clock::time_point::max() - now
+			             ? Clock::time_point::max()
+			             : now + std::chrono::duration_cast<Clock::duration>(budget));
+		}
+};
+
+
+/**
+ * @brief Enforce a deadline on a CancellationToken from a background thread
+ *
+ *        The watchdog thread sleeps until the deadline, unless disarmed
+ *        first. If the deadline is reached it cancels the token and runs the
+ *        (optional) timeout action. Disarming wakes up the thread and joins
+ *        it, so no thread is ever left behind nor killed asynchronously.
+ *
+ * @note The destructor disarms the watchdog
+ */
+class Watchdog
+{
+	/// Token cancelled on time-out
+	CancellationToken& token_;
+
+	/// Guards 'disarmed_'
+	std::mutex mutex_;
+
+	/// Used to wake up the thread early
+	std::condition_variable wakeUp_;
+
+	/// Was the watchdog disarmed before time-out?
+	bool disarmed_;
+
+	/// Did the time-out happen?
+	std::atomic< bool > fired_;
+
+	/// Thread sleeping until the deadline
+	std::thread thread_;
+
+public:  // Ctors/Dtor
+
+	/**
+	 * @brief Data ctor: start watching
+	 * @param token    Token to cancel when the deadline is reached
+	 * @param deadline Deadline to enforce
+	 * @param onTimeout <i>(Optional)</i> Action to carry out, in the watchdog
+	 *                  thread, right after cancelling the token on time-out
+	 */
+	Watchdog(CancellationToken& token,
+	         const CancellationToken::Clock::time_point& deadline,
+	         std::function<void()> onTimeout = std::function<void()>());
+
+	/// Disarm and join the thread
+	~Watchdog();
+
+	Watchdog(const Watchdog&) = delete;
+	Watchdog& operator=(const Watchdog&) = delete;
+
+public:  // Utils
+
+	/// Did the time-out happen?
+	inline bool fired() const noexcept { return fired_; }
+
+	/// Cancel the time-out if still pending and join the thread
+	/// @return Whether the time-out happened anyway
+	/// @note If the time-out happened, wait till its action finishes
+	bool disarm();
+
+	/// Wait for the time-out (and its action) to happen, then join the thread
+	/// @note Blocks until the deadline unless disarm() is called concurrently
+	void wait();
+};
+
+} // namespace fig
+
+#endif // CANCELLATIONTOKEN_H
@@ -32,12 +32,14 @@
 
 // C++
 #include <string>
-#include <memory>  // std::shared_ptr<>
+#include <memory>      // std::shared_ptr<>
+#include <functional>  // std::function<>
 #include <unordered_map>
 // C
 #include <cassert>
 // FIG
 #include <core_typedefs.h>
+#include <PerfCounters.h>
 
 #if __cplusplus < 201103L
 #  error "C++11 standard required, please compile with -std=c++11\n"
@@ -66,6 +68,9 @@ class Clock
 	// Friends for RNG handling, e.g. re-seeding
 	friend class ModelSuite;
 	friend class Transition;
+	friend class SimulationEngineNosplit;
+	friend class SimulationEngineIS;
+	friend class ModelReplicas;
 
 public:
 
@@ -78,6 +83,11 @@ public:
 	/// Default seed for the RNG
 	static const size_t DEFAULT_RNG_SEED;
 
+	/// Alternative way of sampling clocks, passed explicitly to the
+	/// simulation steps which should use it instead of sample(),
+	/// e.g. to sample from tilted distributions for importance sampling
+	typedef std::function< CLOCK_INTERNAL_TYPE(const Clock&) > Sampler;
+
 private:
 
 	/// Whether to use randomized RNG seeding (affects all clocks)
@@ -95,6 +105,11 @@ private:
 	/// Clock's distribution parameters
 	DistributionParameters distParams_;
 
+#ifdef PERF_COUNTERS
+	/// Index of the distribution for the PerfCounters
+	size_t perfIndex_;
+#endif
+
 public:  // Class' RNG observers
 
 	/// RNGs offered to the user,
@@ -144,6 +159,66 @@ private:  // RNG manipulation via ModelSuite
 	 */
 	static void seed_rng();
 
+private:  // Variance reduction via SimulationEngineNosplit
+
+	/**
+	 * @brief Start a new replication with its own RNG substream
+	 * @details Re-seed the RNG from the \ref rng_seed() "current seed" and
+	 *          a replication counter, so that the i-th replication of every
+	 *          estimation uses the same random numbers regardless of how many
+	 *          were consumed by the previous ones (<i>common random numbers</i>).
+	 * @note The replication counter is restarted by seed_rng()
+	 * @see antithetic_replication()
+	 */
+	static void new_replication();
+
+	/**
+	 * @brief Repeat the last replication with antithetic random numbers
+	 * @details Re-seed the RNG with the substream of the last call to
+	 *          new_replication() and reflect all its values, so that each
+	 *          uniform variate U becomes 1-U. Distributions sampled by
+	 *          inversion (uniform, exponential, Weibull, ...) yield values
+	 *          negatively correlated with those of the original replication.
+	 * @note Antithetic sampling lasts until the next call to new_replication()
+	 *       or seed_rng()
+	 */
+	static void antithetic_replication();
+
+private:  // Parallel simulations via ModelReplicas
+
+	/**
+	 * @brief Start a new round of parallel simulations
+	 * @return Number identifying the round, to pass to thread_rng()
+	 * @note The round counter is restarted by seed_rng()
+	 */
+	static unsigned long new_parallel_round() noexcept;
+
+	/**
+	 * @brief Make the calling thread sample from its own RNG substream
+	 * @details The substream is determined by the \ref rng_seed()
+	 *          "current seed", the \p round and the \p thread number,
+	 *          so each thread can sample concurrently and reproducibly.
+	 *          Other threads are unaffected.
+	 * @warning Threads other than the one which seeded the RNG share it,
+	 *          and thus can't sample concurrently until they call this
+	 * @see shared_rng()
+	 */
+	static void thread_rng(const unsigned long& round, const unsigned& thread);
+
+	/// Make the calling thread sample from the shared RNG again,
+	/// dropping antithetic sampling
+	/// @see thread_rng()
+	static void shared_rng();
+
+private:  // Importance sampling via SimulationEngineIS
+
+	/// Sample our distribution with other parameters
+	inline CLOCK_INTERNAL_TYPE sample(const DistributionParameters& params) const
+		{
+			FIG_PERF_COUNT_AT(CLOCK_SAMPLE, perfIndex_, 1ul);
+			return dist_(params);
+		}
+
 public:  // Ctors
 
 	Clock(const std::string& clockName,
@@ -155,6 +230,9 @@ public:  // Ctors
 			distParams_(params)
 		{
 			assert(!clockName.empty());
+#ifdef PERF_COUNTERS
+			perfIndex_ = PerfCounters::distribution_index(distName);
+#endif
 		}
 
 	Clock(const Clock& that)            = default;
@@ -177,14 +255,28 @@ public:  // Accessors
 public:  // Utils
 
 	/// @brief Sample our distribution function
-	inline CLOCK_INTERNAL_TYPE sample()     const { return dist_(distParams_); }
-	inline CLOCK_INTERNAL_TYPE operator()() const { return dist_(distParams_); }
+	inline CLOCK_INTERNAL_TYPE sample() const
+		{
+			FIG_PERF_COUNT_AT(CLOCK_SAMPLE, perfIndex_, 1ul);
+			return dist_(distParams_);
+		}
+	inline CLOCK_INTERNAL_TYPE operator()() const { return sample(); }
 
 public:  // Debugging info
 	void print_info(std::ostream &out) const;
 };
 
 
+/// Default way of sampling clocks, viz. from their own distributions.
+/// Inlined where the simulation steps are instantiated with it,
+/// so regular simulations pay nothing for the Clock::Sampler alternative
+struct SampleClock
+{
+	inline CLOCK_INTERNAL_TYPE operator()(const Clock& clock) const
+		{ return clock.sample(); }
+};
+
+
 } // namespace fig
 
 #endif // CLOCK_H
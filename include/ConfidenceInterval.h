@@ -277,6 +277,33 @@ protected:
 	 */
 	double confidence_quantile(const double& cc, const bool nn = true) const;
 
+	/**
+	 * Compute the quantile of an asymptotic confidence sequence.
+	 *
+	 * Unlike confidence_quantile(), the interval
+	 * \code
+	 * 		x ± q_n * s / sqrt(n)
+	 * \endcode
+	 * built with the quantile 'q_n' returned here covers the true value
+	 * <i>simultaneously for all n</i> with probability 'cc'. The interval
+	 * can thus be checked after every update, and the estimation stopped
+	 * as soon as it is narrow enough, without losing confidence.<br>
+	 * This is the normal-mixture boundary of the asymptotic confidence
+	 * sequences by Waudby-Smith et al. (2021), whose mixing parameter
+	 * is chosen to make the interval tightest when 'n == nOpt'.
+	 *
+	 * @param cc   Confidence coefficient for the desired confidence sequence
+	 * @param n    Number of samples 'n' ≥ 1
+	 * @param nOpt Number of samples where the sequence should be tightest
+	 *
+	 * @return Quantile 'q_n', which grows like sqrt(log(n)) for n ≫ nOpt
+	 *
+	 * @note Applies to means of any i.i.d. samples with finite variance.
+	 */
+	static double sequence_quantile(const double& cc,
+	                                const long& n,
+	                                const double& nOpt);
+
 private:
 
 	/// @note Typically used for "value simulations", viz. when estimations
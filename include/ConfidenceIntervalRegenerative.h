@@ -0,0 +1,115 @@
+//==============================================================================
+//
+//  ConfidenceIntervalRegenerative.h
+//
+//  Copyleft 2026-
+//  Authors:
+//  - The FIG contributors
+//
+//------------------------------------------------------------------------------
+//
+//  This file is part of FIG.
+//
+//  The Finite Improbability Generator (FIG) project is free software;
+//  you can redistribute it and/or modify it under the terms of the GNU
+//  General Public License as published by the Free Software Foundation;
+//  either version 3 of the License, or (at your option) any later version.
+//
+//  FIG is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with FIG; if not, write to the Free Software Foundation,
+//	Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//==============================================================================
+
+#ifndef CONFIDENCEINTERVALREGENERATIVE_H
+#define CONFIDENCEINTERVALREGENERATIVE_H
+
+// C++
+#include <vector>
+#include <utility>  // std::pair<>
+// FIG
+#include <ConfidenceInterval.h>
+
+
+namespace fig
+{
+
+/**
+ * @brief Confidence interval for long-run estimates from regenerative cycles
+ *
+ * @details Each sample is a <i>regeneration cycle</i>: the stretch of
+ *          simulation between two consecutive visits to the regeneration
+ *          state. For i.i.d. cycles with reward \f$Y_i\f$ (e.g. time spent
+ *          on rare states) and length \f$\tau_i\f$ the long-run rate is
+ *          estimated with the ratio \f$r=\bar{Y}/\bar{\tau}\f$, and the
+ *          classical CLT for regenerative processes gives the interval
+ *          $$ r \pm z_a \frac{s}{\bar{\tau}\sqrt{n}} $$
+ *          where \f$s^2\f$ is the sample variance of \f$Y_i-r\tau_i\f$.<br>
+ *          Means and co-moments are computed incrementally, so the interval
+ *          can be fed a large number of cycles without significant precision
+ *          loss due to fp arithmetic.
+ *
+ * @note Unlike ConfidenceIntervalRate no warm-up period must be discarded:
+ *       every cycle is a valid sample from the steady-state behaviour.
+ */
+class ConfidenceIntervalRegenerative : public ConfidenceInterval
+{
+	/// Sample means of the cycles rewards and lengths
+	double meanReward_, meanLength_;
+
+	/// Co-moments of the cycles rewards and lengths
+	double M2reward_, M2length_, M2cross_;
+
+public:  // Ctor
+
+	/// @copydoc ConfidenceInterval::ConfidenceInterval()
+	ConfidenceIntervalRegenerative(double confidence,
+	                               double precision,
+	                               bool dynamicPrecision = false,
+	                               bool neverStop = false);
+public:  // Modifyers
+
+	/// Unsupported: cycles are made of a reward and a length
+	/// @throw FigException always
+	/// @see update(const double&, const double&)
+	void update(const double&) override;
+
+	/**
+	 * Update current estimation with a new regeneration cycle
+	 * @param reward Reward accumulated during the cycle,
+	 *               e.g. simulation time spent on rare states
+	 * @param length Simulation time the cycle lasted
+	 * @throw FigException if detected possible overflow
+	 */
+	void update(const double& reward, const double& length);
+
+	/**
+	 * Update current estimation with several new regeneration cycles
+	 * @param cycles Pairs (reward,length) of each cycle simulated
+	 * @throw FigException if detected possible overflow
+	 * @see update(const double&, const double&)
+	 */
+	void update(const std::vector< std::pair< double, double > >& cycles);
+
+public:  // Utils
+
+	bool min_samples_covered(bool considerEpsilon = false) const noexcept override;
+
+	double precision(const double& confco) const override;
+
+	void reset(bool fullReset = false) noexcept override;
+
+private:
+
+	/// Compute estimate, variance and half-width from the moments
+	void update_interval();
+};
+
+}  // namespace fig
+
+#endif // CONFIDENCEINTERVALREGENERATIVE_H
@@ -86,7 +86,7 @@ public:  // Modifyers
 	 *                    observed in all the simulations ran
 	 * @throw FigException if detected possible overflow
 	 */
-	void update(const std::vector<double>& weighedNREs);
+	virtual void update(const std::vector<double>& weighedNREs);
 
 public:  // Utils
 
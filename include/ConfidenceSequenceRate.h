@@ -0,0 +1,72 @@
+//==============================================================================
+//
+//  ConfidenceSequenceRate.h
+//
+//  Copyleft 2026-
+//  Authors:
+//  - The FIG contributors
+//
+//------------------------------------------------------------------------------
+//
+//  This file is part of FIG.
+//
+//  The Finite Improbability Generator (FIG) project is free software;
+//  you can redistribute it and/or modify it under the terms of the GNU
+//  General Public License as published by the Free Software Foundation;
+//  either version 3 of the License, or (at your option) any later version.
+//
+//  FIG is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with FIG; if not, write to the Free Software Foundation,
+//	Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//==============================================================================
+
+#ifndef CONFIDENCESEQUENCERATE_H
+#define CONFIDENCESEQUENCERATE_H
+
+#include <ConfidenceIntervalRate.h>
+
+namespace fig
+{
+
+/**
+ * @brief Anytime-valid confidence interval for long-run simulations
+ *
+ * @details Estimates are computed as in ConfidenceIntervalRate, but the
+ *          half-width uses the \ref ConfidenceInterval::sequence_quantile()
+ *          "quantile of a confidence sequence", valid simultaneously for
+ *          every number of samples fed. Stopping as soon as is_valid()
+ *          holds thus keeps the confidence coefficient requested.
+ *
+ * @see ConfidenceSequenceTransient
+ */
+class ConfidenceSequenceRate : public ConfidenceIntervalRate
+{
+	/// Number of samples for which the sequence is tightest
+	const double optimalSamples_;
+
+public:
+	/**
+	 * @copydoc ConfidenceInterval::ConfidenceInterval()
+	 * @param optimalSamples Number of samples (batches) for which the
+	 *                       interval should be tightest
+	 */
+	ConfidenceSequenceRate(double conf,
+	                       double precision,
+	                       bool dynamicPrecision = false,
+	                       bool neverStop = false,
+	                       double optimalSamples = 1ul<<8ul);
+
+	void update(const double& newMean) override;
+
+	double precision(const double& confco) const override;
+};
+
+}
+
+#endif // CONFIDENCESEQUENCERATE_H
@@ -0,0 +1,83 @@
+//==============================================================================
+//
+//  ConfidenceSequenceTransient.h
+//
+//  Copyleft 2026-
+//  Authors:
+//  - The FIG contributors
+//
+//------------------------------------------------------------------------------
+//
+//  This file is part of FIG.
+//
+//  The Finite Improbability Generator (FIG) project is free software;
+//  you can redistribute it and/or modify it under the terms of the GNU
+//  General Public License as published by the Free Software Foundation;
+//  either version 3 of the License, or (at your option) any later version.
+//
+//  FIG is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with FIG; if not, write to the Free Software Foundation,
+//	Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//==============================================================================
+
+#ifndef CONFIDENCESEQUENCETRANSIENT_H
+#define CONFIDENCESEQUENCETRANSIENT_H
+
+// FIG
+#include <ConfidenceIntervalTransient.h>
+
+
+namespace fig
+{
+
+/**
+ * @brief Anytime-valid confidence interval for transient-like simulations
+ *
+ * @details Estimates are computed as in ConfidenceIntervalTransient, but the
+ *          half-width uses the \ref ConfidenceInterval::sequence_quantile()
+ *          "quantile of a confidence sequence": the interval covers the true
+ *          value simultaneously for every number of samples fed. Checking
+ *          is_valid() after each batch and stopping as soon as it holds
+ *          (i.e. at a data-dependent time) thus keeps the confidence
+ *          coefficient requested, which is not the case for the fixed-sample
+ *          intervals.
+ *
+ * @note The price is a wider interval for the same number of samples:
+ *       about 50% wider around the optimal sample size, growing like
+ *       \f$\sqrt{\log n}\f$ far from it.
+ */
+class ConfidenceSequenceTransient : public ConfidenceIntervalTransient
+{
+	/// Number of samples for which the sequence is tightest
+	const double optimalSamples_;
+
+public:  // Ctor
+
+	/**
+	 * @copydoc ConfidenceInterval::ConfidenceInterval()
+	 * @param optimalSamples Number of samples (simulations) for which the
+	 *                       interval should be tightest
+	 */
+	ConfidenceSequenceTransient(double confidence,
+	                            double precision,
+	                            bool dynamicPrecision = false,
+	                            bool neverStop = false,
+	                            double optimalSamples = 1ul<<24ul);
+public:  // Modifyers
+
+	void update(const std::vector<double>& weighedNREs) override;
+
+public:  // Utils
+
+	double precision(const double& confco) const override;
+};
+
+}  // namespace fig
+
+#endif // CONFIDENCESEQUENCETRANSIENT_H
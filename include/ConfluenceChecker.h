@@ -4,6 +4,9 @@
 #define CONFLUENCE_CHECKER_H
 
 #include <set>
+#include <map>
+#include <vector>
+#include <cstdint>
 
 #include "IOSAModule.h"
 
@@ -34,10 +37,17 @@ class ConfluenceChecker : public Visitor {
     /// Maps each label to its position on the matrix
     std::map<string, unsigned int> position;
 
+    /// Row of the matrix: bit "j" of row "i" says whether
+    /// label "i" (indirectly) triggers label "j"
+    typedef std::vector<std::uint64_t> Row;
+
     /// We use this matrix to implement the Warshall algorithm that
     /// computes the reflexive transivie closure of the triggering
-    /// relation.
-    std::vector<std::vector<bool>> matrix;
+    /// relation. Rows are bitsets so they can be or-ed a word at a time.
+    std::vector<Row> matrix;
+
+    /// Position of labels that don't occur in the triggering relation
+    static constexpr unsigned int NO_POSITION = ~0u;
 
 public:
 
@@ -62,8 +72,18 @@ private:
     /// Run the actual algorithm
     bool confluence_check();
 
+    /// Position of the label on the matrix, or NO_POSITION
+    unsigned int position_of(const string &label) const;
+
     /// Check if the given labels are related via the triggering relation
     bool indirectly_triggers(const string &label1, const string &label2);
+    bool indirectly_triggers(unsigned int pos1, unsigned int pos2) const;
+
+    /// Index of the first edge whose label indirectly triggers
+    /// the label at position "pos", or labels.size() if there's none
+    /// @param labels Positions of the labels of the edges
+    size_t first_triggering(const std::vector<unsigned int> &labels,
+                            unsigned int pos) const;
 
     /// Print debug information
     void debug_matrix();
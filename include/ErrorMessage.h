@@ -46,4 +46,10 @@ public:
     string get_msg() {
         return (msg.str());
     }
+
+    void append(const ErrorMessage& other) {
+        _has_errors = _has_errors || other._has_errors;
+        _has_warnings = _has_warnings || other._has_warnings;
+        msg << other.msg.str();
+    }
 };
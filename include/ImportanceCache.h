@@ -0,0 +1,171 @@
+//==============================================================================
+//
+//  ImportanceCache.h
+//
+//  Copyleft 2026-
+//  Authors:
+//  - The FIG contributors
+//
+//------------------------------------------------------------------------------
+//
+//  This file is part of FIG.
+//
+//  The Finite Improbability Generator (FIG) project is free software;
+//  you can redistribute it and/or modify it under the terms of the GNU
+//  General Public License as published by the Free Software Foundation;
+//  either version 3 of the License, or (at your option) any later version.
+//
+//  FIG is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with FIG; if not, write to the Free Software Foundation,
+//	Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//==============================================================================
+
+
+#ifndef IMPORTANCECACHE_H
+#define IMPORTANCECACHE_H
+
+// C++
+#include <vector>
+#include <unordered_map>
+// FIG
+#include <core_typedefs.h>
+
+
+namespace fig
+{
+
+/// Hash for valuations, to index global states of huge models
+struct StateInstanceHash
+{
+	size_t operator()(const StateInstance& s) const noexcept
+	{
+		size_t seed(s.size());
+		for (const auto& v: s)  // boost::hash_combine
+			seed ^= std::hash<STATE_INTERNAL_TYPE>()(v) + 0x9e3779b9
+			        + (seed<<6) + (seed>>2);
+		return seed;
+	}
+};
+
+
+/**
+ * @brief Bounded memoization of the ImportanceValue of global valuations
+ *
+ *        Fixed-capacity map from StateInstance to ImportanceValue (possibly
+ *        mixed with Event masks), meant to hold the values computed on the
+ *        fly by an ImportanceFunction that can't afford storing the whole
+ *        concrete state space.
+ *        When full, entries are evicted following the CLOCK policy
+ *        (aka "second chance"), which approximates LRU without needing to
+ *        reorder anything on a hit.
+ *
+ * @note <b>Not thread safe</b>: a hit costs a single hash and lookup,
+ *       without any synchronisation
+ * @see ImportanceFunctionConcreteLazy
+ */
+class ImportanceCache
+{
+public:
+
+	/// Default maximum number of entries held
+	static constexpr size_t DEFAULT_CAPACITY = 1ul<<20;
+
+private:
+
+	/// Cached entry with its CLOCK reference bit
+	struct Slot
+	{
+		StateInstance key;
+		ImportanceValue value;
+		bool referenced;
+	};
+
+	/// Cached entries (reference bits are updated on lookups)
+	mutable std::vector< Slot > slots_;
+
+	/// Position in slots_ of each cached valuation
+	std::unordered_map< StateInstance, size_t, StateInstanceHash > index_;
+
+	/// CLOCK hand: next candidate for eviction
+	size_t hand_;
+
+	/// Max number of entries
+	size_t capacity_;
+
+	/// Successful lookups since last clear()
+	mutable size_t hits_;
+
+	/// Failed lookups since last clear()
+	mutable size_t misses_;
+
+public:  // Ctors
+
+	/// Data ctor
+	/// @param capacity Max number of entries to hold
+	explicit ImportanceCache(const size_t& capacity = DEFAULT_CAPACITY);
+
+	/// Avoid accidental copies
+	ImportanceCache(const ImportanceCache&) = delete;
+
+	/// Avoid accidental copies
+	ImportanceCache& operator=(const ImportanceCache&) = delete;
+
+public:  // Accessors
+
+	/// Max number of entries this cache can hold
+	inline size_t capacity() const noexcept { return capacity_; }
+
+	/// Number of entries currently held
+	inline size_t size() const noexcept { return slots_.size(); }
+
+	/// Successful lookups since last clear()
+	inline size_t hits() const noexcept { return hits_; }
+
+	/// Failed lookups since last clear()
+	inline size_t misses() const noexcept { return misses_; }
+
+public:  // Utils
+
+	/**
+	 * Look for the value of a valuation
+	 * @param key   Valuation to look for
+	 * @param value Where the cached value is stored if found <b>(modified)</b>
+	 * @return Whether \p key was in the cache
+	 */
+	inline bool find(const StateInstance& key, ImportanceValue& value) const
+		{
+			const auto it = index_.find(key);
+			if (index_.end() == it) {
+				misses_++;
+				return false;
+			}
+			Slot& slot = slots_[it->second];
+			slot.referenced = true;
+			value = slot.value;
+			hits_++;
+			return true;
+		}
+
+	/**
+	 * Store the value of a valuation, evicting some other entry if full
+	 * @param key   Valuation to store
+	 * @param value Value to map \p key to
+	 * @note If \p key was already cached, its value is overwritten
+	 */
+	void insert(const StateInstance& key, const ImportanceValue& value);
+
+	/// Release all entries and reset the hit/miss counters
+	/// @param capacity <i>(Optional)</i> New max number of entries to hold
+	void clear(const size_t& capacity = 0ul);
+
+};
+
+} // namespace fig
+
+#endif // IMPORTANCECACHE_H
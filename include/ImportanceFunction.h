@@ -115,7 +115,7 @@ public:  // Class attributes
 	/// Long story short: number of concrete derived classes.
 	/// More in detail this is the size of the array returned by names(), i.e.
 	/// how many ImportanceFunction implementations are offered to the end user.
-	static constexpr size_t NUM_NAMES = 3ul;
+	static constexpr size_t NUM_NAMES = 4ul;
 
 	/// Size of the array returned by strategies() as a constexpr, i.e.
 	/// how many importance assessment strategies are offered to the end user.
@@ -190,6 +190,18 @@ protected:  // Attributes for derived classes
 	 */
 	ThresholdsVec importance2threshold_;
 
+	/**
+	 * @brief Lower ImportanceValue of each threshold level, stored contiguously
+	 *
+	 *        Holds the first components of threshold2importance_, i.e.
+	 *        thresholdsBounds_[i] == threshold2importance_[i].first.
+	 *        Used to search the level of an ImportanceValue when the
+	 *        importance range is too big to build importance2threshold_.
+	 *
+	 * @see level_of(const ImportanceValue&)
+	 */
+	ImportanceVec thresholdsBounds_;
+
 	/// Minimum splitting/effort selected among all threshold levels
 	unsigned long minThresholdsEffort_;
 
@@ -370,6 +382,12 @@ public:  // Accessors
 	/// @note concrete_simulation() => concrete()
 	virtual bool concrete_simulation() const noexcept = 0;
 
+	/// @brief Whether importance_of() and state_info() can be invoked
+	///        concurrently, e.g. to simulate in several threads at once
+	/// @details False for instances that query through internal buffers,
+	///          e.g. to evaluate an algebraic formula
+	virtual inline bool concurrent_queries() const noexcept { return false; }
+
 	/**
 	 * Tell the pre-computed importance of the given StateInstance.
 	 * @return ImportanceValue requested
@@ -412,6 +430,35 @@ public:  // Accessors
 	/// @copydetails level_of(const StateInstance&)
 	ImportanceValue level_of(const ImportanceValue& imp) const;
 
+	/**
+	 * @brief Threshold level of the StateInstance, marked with the
+	 *        RARE and STOP events which \p property defines for it.
+	 *
+	 *        This yields in a single pass what the simulation engines need
+	 *        to watch the events of a Traial, for any kind of importance
+	 *        function. Concrete importance functions with a reliable
+	 *        \ref ImportanceFunctionConcrete::info_of() "info_of()" answer
+	 *        from their precomputed vectors; the rest compute the
+	 *        importance of \p state, translate it to its threshold level
+	 *        and mark the events by querying \p property.
+	 *
+	 * @param state    Valuation whose level and events are requested
+	 * @param property Property defining the RARE and STOP events
+	 *
+	 * @return Threshold level (or importance if the thresholds aren't built)
+	 *         possibly mixed with Event information
+	 *
+	 * \ifnot NDEBUG
+	 *   @throw FigException if there's no \ref has_importance_info()
+	 *                       "importance information" currently
+	 * \endif
+	 *
+	 * @see level_of()
+	 * @see ImportanceFunctionConcrete::info_of()
+	 */
+	virtual ImportanceValue state_info(const StateInstance& state,
+	                                   const Property& property) const;
+
 	/**
 	 * Splitting/effort associated with this ("threshold-") level
 	 * @param lvl  Threshold-level whose associated effort is queried
@@ -34,17 +34,20 @@
 #include <vector>
 #include <string>
 #include <tuple>
+#include <functional>  // std::function<>
 // FIG
 #include <core_typedefs.h>
 #include <State.h>
 #include <PropertyProjection.h>
 #include <ImportanceFunction.h>
+#include <ImportanceMDD.h>
 
 
 namespace fig
 {
 
 class Module;
+class ModuleNetwork;
 class Property;
 class Transition;
 
@@ -141,6 +144,17 @@ public:  // Accessors
 	 */
 	virtual ImportanceValue info_of(const StateInstance& state) const = 0;
 
+	/// @copydoc ImportanceFunction::state_info()
+	/// @note Resorts to info_of() whenever concrete_simulation() allows it,
+	///       skipping the evaluation of \p property altogether
+	inline ImportanceValue state_info(const StateInstance& state,
+	                                  const Property& property) const override
+		{
+			return concrete_simulation()
+			        ? info_of(state)
+			        : ImportanceFunction::state_info(state, property);
+		}
+
 public:  // Utils
 
 	/**
@@ -241,6 +255,47 @@ protected:  // Utils for the class and its kin
 	                       const PropertyProjection& clauses = PropertyProjection(),
 	                       const Indices& relevant = Indices());
 
+	/**
+	 * @brief Assess importance of all reachable global states, storing it
+	 *        symbolically in a decision diagram
+	 *
+	 *        Alternative to the "auto" strategy of assess_importance() for
+	 *        models whose concrete state space is too big to be held in a
+	 *        vector. Only the <i>reachable</i> global valuations of \p model
+	 *        are explored and labelled according to \p property; the
+	 *        distance to the rare states is then computed over them, and the
+	 *        resulting importance (masked with events) is stored in \p mdd.
+	 *        Unreachable valuations are assigned null importance.
+	 *
+	 *        The reachable set and the distance layers are decision diagrams
+	 *        themselves, filled in bounded batches, so memory depends on
+	 *        the structure of those sets rather than on their size.
+	 *        Successors are still computed one valuation at a time, and each
+	 *        distance layer revisits the unlabelled reachable valuations.
+	 *
+	 * @param model    System model whose reachable states will be assessed
+	 * @param property Logical property identifying the special states
+	 * @param mdd      Decision diagram where the importance will be stored <b>(modified)</b>
+	 *
+	 * @return Whether the model is relevant to importance splitting,
+	 *         i.e. if some rare state is reachable
+	 *
+	 * @warning The values of the internal inherited attributes minValue_,
+	 *          maxValue_, initialValue_ and minRareValue_ are updated.
+	 *
+	 * @throw bad_alloc    if system's memory wasn't enough for the exploration
+	 * @throw FigException if there are too many importance levels
+	 */
+	bool assess_importance_symbolic(const ModuleNetwork& model,
+	                                const Property& property,
+	                                ImportanceMDD& mdd);
+
+	/// Change each ImportanceValue stored for its image through \p f
+	/// @note Event masks are kept: \p f receives and returns unmasked values
+	/// @see post_process()
+	virtual void transform_values(
+	    const std::function<ImportanceValue(const ImportanceValue&)>& f);
+
 	/**
 	 * @brief Apply a post-processing to the information stored
 	 *
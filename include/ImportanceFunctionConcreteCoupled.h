@@ -31,6 +31,7 @@
 #define IMPORTANCEFUNCTIONCONCRETECOUPLED_H
 
 #include <ImportanceFunctionConcrete.h>
+#include <ImportanceMDD.h>
 #include <State.h>
 #include <FigException.h>
 
@@ -62,6 +63,18 @@ class ImportanceFunctionConcreteCoupled : public ImportanceFunctionConcrete
 	/// Single location used from ImportanceFunctionConcrete::
 	const unsigned importanceInfoIndex_;
 
+	/// Is the importance stored symbolically in symbolicImportance_
+	/// rather than in the concrete vector?
+	bool symbolic_;
+
+	/// Use the symbolic storage for the "auto" strategy regardless of the
+	/// size of the concrete state space
+	bool forceSymbolic_;
+
+	/// Symbolic storage for models whose concrete state space is too big
+	/// to hold in a vector. @see ImportanceFunctionConcrete::assess_importance_symbolic()
+	ImportanceMDD symbolicImportance_;
+
 public:  // Ctor/Dtor
 
 	/// @brief Data ctor
@@ -82,6 +95,13 @@ public:  // Accessors
 
 	inline bool concrete_simulation() const noexcept override final { return true; }
 
+	/// Queries only read the importance vector (or decision diagram)
+	inline bool concurrent_queries() const noexcept override final { return true; }
+
+	/// Whether the importance is currently stored in a decision diagram,
+	/// i.e. if the concrete state space was too big for the vector storage
+	inline bool symbolic() const noexcept { return symbolic_; }
+
 	/// @copydoc ImportanceFunctionConcrete::info_of()
 	/// @note Attempted inline in a desperate need for speed
 	/// @note <b>Complexity:</b> <i>O(size(state)<sup>2</sup>)</i>
@@ -91,12 +111,14 @@ public:  // Accessors
 			if (!has_importance_info())
 				throw_FigException("importance function \"" + name() + "\" "
 								   "doesn't hold importance information.");
-			globalStateCopy.copy_from_state_instance(state, true);
-#       else
-			globalStateCopy.copy_from_state_instance(state, false);
 #       endif
+			if (symbolic_) {
+				const auto info = symbolicImportance_(state);
+				return ready() ? (MASK(info) | level_of(UNMASK(info)))
+				               : info;
+			}
 			auto info = modulesConcreteImportance[importanceInfoIndex_]
-												 [globalStateCopy.encode()];
+												 [globalStateCopy.encode(state)];
 			return ready() ? (MASK(info) | level_of(UNMASK(info)))
 						   : info;
 		}
@@ -110,17 +132,23 @@ public:  // Accessors
 			if (!has_importance_info())
 				throw_FigException("importance function \"" + name() + "\" "
 								   "doesn't hold importance information.");
-			globalStateCopy.copy_from_state_instance(state, true);
-#       else
-			globalStateCopy.copy_from_state_instance(state, false);
 #       endif
+			if (symbolic_)
+				return UNMASK(symbolicImportance_(state));
 			return UNMASK(modulesConcreteImportance[importanceInfoIndex_]
-												   [globalStateCopy.encode()]);
+												   [globalStateCopy.encode(state)]);
 		}
 
 	void print_out(std::ostream& out,
 	               State<STATE_INTERNAL_TYPE> s = State<STATE_INTERNAL_TYPE>()) const override;
 
+public:  // Modifiers
+
+	/// Store the importance of the "auto" strategy in a decision diagram
+	/// even if the concrete state space fits in a vector
+	/// @note Takes effect on the next call to assess_importance()
+	inline void force_symbolic(bool force) noexcept { forceSymbolic_ = force; }
+
 public:  // Utils
 
 	void assess_importance(const Property& prop,
@@ -130,6 +158,13 @@ public:  // Utils
 	void assess_importance(const Property& prop,
 						   const std::string& formulaExprStr,
 						   const std::vector<std::string>& varnames) override;
+
+	void clear() noexcept override;
+
+protected:  // Utils for the class and its kin
+
+	void transform_values(
+	    const std::function<ImportanceValue(const ImportanceValue&)>& f) override;
 };
 
 } // namespace fig
@@ -0,0 +1,222 @@
+//==============================================================================
+//
+//  ImportanceFunctionConcreteLazy.h
+//
+//  Copyleft 2026-
+//  Authors:
+//  - The FIG contributors
+//
+//------------------------------------------------------------------------------
+//
+//  This file is part of FIG.
+//
+//  The Finite Improbability Generator (FIG) project is free software;
+//  you can redistribute it and/or modify it under the terms of the GNU
+//  General Public License as published by the Free Software Foundation;
+//  either version 3 of the License, or (at your option) any later version.
+//
+//  FIG is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with FIG; if not, write to the Free Software Foundation,
+//	Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//==============================================================================
+
+
+#ifndef IMPORTANCEFUNCTIONCONCRETELAZY_H
+#define IMPORTANCEFUNCTIONCONCRETELAZY_H
+
+// C++
+#include <functional>  // std::function<>
+// FIG
+#include <ImportanceFunctionConcrete.h>
+#include <ImportanceCache.h>
+#include <State.h>
+#include <FigException.h>
+
+
+namespace fig
+{
+
+/**
+ * @brief ImportanceFunction for the on-the-fly importance assessment
+ *        of a fully coupled ModuleNetwork.
+ *
+ *        Yields the same values than the "auto" strategy of
+ *        ImportanceFunctionConcreteCoupled, viz. the distance from the
+ *        initial state to the rare set minus the distance from the state
+ *        queried to the rare set, but without ever exploring the whole
+ *        concrete state space. Instead, the importance of a state is
+ *        computed when it is first queried, via a forward breadth-first
+ *        search bounded by the distance of the initial state.
+ *
+ *        Computed values are memoized in a bounded ImportanceCache: states
+ *        on the shortest path found to the rare set are stored as well,
+ *        since their distance comes for free. This trades the memory
+ *        (and precomputation time) of the concrete storage for CPU time
+ *        on cache misses, which pays off when simulations visit only a
+ *        small part of a huge state space.
+ *        The search of a cache miss first visits up to MAX_MISS_STATES
+ *        states; only if that doesn't settle the distance it is resumed
+ *        with the MAX_SEARCH_STATES bound of the initial state's search.
+ *
+ * @note Queries are <b>not</b> thread safe: cache misses fill the cache
+ *       and use the model's evaluators without synchronisation
+ * @see ImportanceFunctionConcreteCoupled
+ * @see ImportanceCache
+ */
+class ImportanceFunctionConcreteLazy : public ImportanceFunctionConcrete
+{
+public:
+
+	/// Max number of states the search from the initial state may visit
+	static constexpr size_t MAX_SEARCH_STATES = 1ul<<24;
+
+	/// Max number of states the search of a cache miss may visit
+	static constexpr size_t MAX_MISS_STATES = 1ul<<12;
+
+private:
+
+	/// User's \ref ModuleNetwork "system model", i.e. the network of modules
+	const ModuleNetwork& model_;
+
+	/// Property whose rare states are searched for on cache misses
+	const Property* property_;
+
+	/// Distance from the initial state to the rare set
+	ImportanceValue maxDistance_;
+
+	/// Post-processing to apply to the (unmasked) values computed
+	std::function< ImportanceValue(const ImportanceValue&) > valueMap_;
+
+	/// Memoization of the states' information, i.e. their importance
+	/// mixed with Event masks
+	mutable ImportanceCache cache_;
+
+public:  // Ctor/Dtor
+
+	/// @brief Data ctor
+	/// @param model System model, whose current state is taken as initial
+	ImportanceFunctionConcreteLazy(const ModuleNetwork& model);
+
+	/// Dtor
+	~ImportanceFunctionConcreteLazy() override;
+
+	/// Avoid accidental copies
+	ImportanceFunctionConcreteLazy(const ImportanceFunctionConcreteLazy&) = delete;
+
+	/// Avoid accidental copies
+	ImportanceFunctionConcreteLazy&
+	operator=(const ImportanceFunctionConcreteLazy&) = delete;
+
+public:  // Accessors
+
+	inline bool concrete_simulation() const noexcept override final { return true; }
+
+	/// Max number of states whose information is memoized
+	inline size_t cache_capacity() const noexcept { return cache_.capacity(); }
+
+	/// Number of queries answered from the cache
+	inline size_t cache_hits() const noexcept { return cache_.hits(); }
+
+	/// Number of queries which required a search in the model
+	inline size_t cache_misses() const noexcept { return cache_.misses(); }
+
+	/// @copydoc ImportanceFunctionConcrete::info_of()
+	/// @note Attempted inline in a desperate need for speed
+	/// @note <b>Complexity:</b> amortized <i>O(size(state))</i> on cache hits
+	inline ImportanceValue info_of(const StateInstance& state) const override
+		{
+#       ifndef NDEBUG
+			if (!has_importance_info())
+				throw_FigException("importance function \"" + name() + "\" "
+								   "doesn't hold importance information.");
+#       endif
+			const auto info = cached_info_of(state);
+			return ready() ? (MASK(info) | level_of(UNMASK(info)))
+			               : info;
+		}
+
+	/// @copydoc ImportanceFunction::importance_of()
+	/// @note Attempted inline in a desperate need for speed
+	/// @note <b>Complexity:</b> amortized <i>O(size(state))</i> on cache hits
+	inline ImportanceValue importance_of(const StateInstance& state) const override
+		{
+#       ifndef NDEBUG
+			if (!has_importance_info())
+				throw_FigException("importance function \"" + name() + "\" "
+								   "doesn't hold importance information.");
+#       endif
+			return UNMASK(cached_info_of(state));
+		}
+
+	void print_out(std::ostream& out,
+	               State<STATE_INTERNAL_TYPE> s = State<STATE_INTERNAL_TYPE>()) const override;
+
+public:  // Modifiers
+
+	/// Change the max number of states whose information is memoized
+	/// @note Discards all currently memoized information
+	void set_cache_capacity(const size_t& capacity);
+
+public:  // Utils
+
+	void assess_importance(const Property& prop,
+						   const std::string& strategy = "flat",
+						   const PostProcessing& postProc = PostProcessing()) override;
+
+	void assess_importance(const Property& prop,
+						   const std::string& formulaExprStr,
+						   const std::vector<std::string>& varnames) override;
+
+	void clear() noexcept override;
+
+protected:  // Utils for the class and its kin
+
+	void transform_values(
+	    const std::function<ImportanceValue(const ImportanceValue&)>& f) override;
+
+private:  // Class utils
+
+	/// Importance of \p state mixed with its Event masks,
+	/// computed via compute_info() on cache misses
+	inline ImportanceValue cached_info_of(const StateInstance& state) const
+		{
+			ImportanceValue info;
+			if (!cache_.find(state, info))
+				info = compute_info(state);
+			return info;
+		}
+
+	/// Compute the info of \p state from scratch and memoize it,
+	/// together with the info of all states in the shortest path
+	/// from \p state to the rare set
+	ImportanceValue compute_info(const StateInstance& state) const;
+
+	/**
+	 * @brief Breadth-first search for the rare set from the given state
+	 * @param state     Valuation where the search begins
+	 * @param maxStates Max number of states to visit
+	 * @param giveUp    Whether to give up, rather than throw,
+	 *                  when more than \p maxStates would be visited
+	 * @param path      <i>(Optional)</i> Where to store the shortest path found,
+	 *                  from \p state to the first rare state <b>(modified)</b>
+	 * @return Distance from \p state to the rare set, maxDistance_
+	 *         if it wasn't found closer than that, or UNREACHABLE
+	 *         if the search gave up
+	 * @throw FigException if more than \p maxStates states would be visited
+	 *                     and \p giveUp is false
+	 */
+	ImportanceValue distance_to_rare(const StateInstance& state,
+	                                 const size_t& maxStates,
+	                                 bool giveUp,
+	                                 std::vector< StateInstance >* path = nullptr) const;
+};
+
+} // namespace fig
+
+#endif // IMPORTANCEFUNCTIONCONCRETELAZY_H
@@ -242,6 +242,55 @@ private:  // Class utils
 	 *         empty vector if the module needs no local ifun
 	 */
 	Indices special_case(const ModuleInstance& module) const;
+
+	/// Set \p f to a private copy of the composition function,
+	/// e.g. for concurrent evaluations
+	/// @see set_composition_fun()
+	void pin_composition_fun(Formula& f) const;
+
+	/**
+	 * @brief Importance of a global state, composed from those of the modules
+	 * @param state       Global state whose importance is computed
+	 * @param f           Composition function
+	 * @param localStates Copies of the modules local states <b>(modified)</b>
+	 * @param localValues Storage for the modules importance <b>(modified)</b>
+	 * @note Uses no internal storage besides the arguments, so that
+	 *       concurrent calls with private arguments are safe
+	 */
+	inline ImportanceValue
+	compose_importance(const StateInstance& state,
+	                   const Formula& f,
+	                   std::vector< State< STATE_INTERNAL_TYPE > >& localStates,
+	                   ImportanceVec& localValues) const
+		{
+			for (size_t i = 0ul ; i < numModules_ ; i++) {
+				if (!isRelevant_[i]) {
+					localValues[i] = neutralElement_;
+				} else {
+					auto& localState = localStates[i];
+#ifndef NDEBUG
+					localState.extract_from_state_instance(state, globalVarsIPos.at(i), true);
+#else
+					localState.extract_from_state_instance(state, globalVarsIPos[i], false);
+#endif
+					localValues[i] = UNMASK(modulesConcreteImportance[i][localState.encode()]);
+				}
+			}
+			return f(localValues);
+		}
+
+	/**
+	 * @brief Find extreme importance values by brute force
+	 *
+	 *        Like ImportanceFunction::find_extreme_values() for the global
+	 *        state, but partitioning the concrete state space among all
+	 *        available threads.
+	 *
+	 * @param property Property identifying the rare states
+	 *
+	 * @throw FigException if the global state space is too big for this
+	 */
+	void scan_extreme_values(const Property& property);
 };
 
 } // namespace fig
@@ -0,0 +1,211 @@
+//==============================================================================
+//
+//  ImportanceMDD.h
+//
+//  Copyleft 2026-
+//  Authors:
+//  - The FIG contributors
+//
+//------------------------------------------------------------------------------
+//
+//  This file is part of FIG.
+//
+//  The Finite Improbability Generator (FIG) project is free software;
+//  you can redistribute it and/or modify it under the terms of the GNU
+//  General Public License as published by the Free Software Foundation;
+//  either version 3 of the License, or (at your option) any later version.
+//
+//  FIG is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with FIG; if not, write to the Free Software Foundation,
+//	Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//==============================================================================
+
+
+#ifndef IMPORTANCEMDD_H
+#define IMPORTANCEMDD_H
+
+// C++
+#include <vector>
+#include <functional>  // std::function<>
+// FIG
+#include <core_typedefs.h>
+#include <State.h>
+
+
+namespace fig
+{
+
+/**
+ * @brief Multi-valued decision diagram mapping global valuations
+ *        to \ref ImportanceValue "importance values"
+ *
+ *        The diagram has one level per Variable of the State it is built for,
+ *        in the same order, plus a terminal level holding the distinct
+ *        ImportanceValue (possibly mixed with Event masks) stored.
+ *        Each node of the i-th level has one child per value in the range
+ *        of the i-th Variable. Nodes are hash-consed during construction,
+ *        so isomorphic sub-diagrams are shared and the memory required is
+ *        proportional to the <i>structure</i> of the function stored,
+ *        not to the size of the concrete state space.
+ *
+ *        The diagram is quasi-reduced: no level is skipped, so evaluating
+ *        a StateInstance takes exactly one (contiguous) array access per
+ *        Variable.
+ *
+ *        Diagrams over the same State can be combined pointwise with
+ *        apply(), so they can also represent sets of valuations (mapped to
+ *        non-default values) which are built incrementally, in batches.
+ *
+ * @note Valuations not explicitly given during construction are mapped
+ *       to a default value. The first terminal is always the default value,
+ *       and the first node of every level is the sub-diagram constantly
+ *       mapped to it.
+ * @see ImportanceFunctionConcreteCoupled
+ */
+class ImportanceMDD
+{
+public:
+
+	/// Node identifier within a level of the diagram
+	typedef unsigned NodeId;
+
+	/// Valuation of all the variables and the value it is mapped to
+	typedef std::pair< StateInstance, ImportanceValue > Entry;
+
+private:
+
+	/// Offset to translate variable values into child positions, per level
+	std::vector< STATE_INTERNAL_TYPE > offset_;
+
+	/// Number of children of each node, per level
+	std::vector< size_t > width_;
+
+	/// Children of the nodes, per level: the j-th child of node 'n'
+	/// from level 'l' is at children_[l][n*width_[l]+j]
+	std::vector< std::vector< NodeId > > children_;
+
+	/// Distinct values stored, indexed by the nodes of the last level
+	ImportanceVec terminals_;
+
+	/// Node of the first level where evaluations start
+	NodeId root_;
+
+public:  // Ctors
+
+	/// Empty ctor: evaluating an empty diagram is an error
+	ImportanceMDD() : root_(0u) {}
+
+	/// Default copy ctor
+	ImportanceMDD(const ImportanceMDD&) = default;
+
+	/// Default move ctor
+	ImportanceMDD(ImportanceMDD&&) = default;
+
+	/// Default copy assignment
+	ImportanceMDD& operator=(const ImportanceMDD&) = default;
+
+	/// Default move assignment
+	ImportanceMDD& operator=(ImportanceMDD&&) = default;
+
+public:  // Accessors
+
+	/// Whether the diagram holds no information
+	inline bool empty() const noexcept { return terminals_.empty(); }
+
+	/// Total number of (non-terminal) nodes in the diagram
+	size_t num_nodes() const noexcept;
+
+	/// Number of distinct values stored in the diagram
+	inline size_t num_terminals() const noexcept { return terminals_.size(); }
+
+	/// Distinct values stored in the diagram
+	inline const ImportanceVec& terminals() const noexcept { return terminals_; }
+
+	/// Whether all valuations are mapped to the default value
+	inline bool trivial() const noexcept { return !empty() && 0u == root_; }
+
+	/**
+	 * Value the diagram maps the given valuation to
+	 * @param s Valuation of all the variables of the State the diagram was built for
+	 * @note <b>Complexity:</b> <i>O(size(s))</i>
+	 * @warning No bounds checking is performed
+	 */
+	inline ImportanceValue operator()(const StateInstance& s) const
+		{
+			assert(!empty());
+			assert(s.size() == children_.size());
+			NodeId node(root_);
+			for (size_t l = 0ul ; l < children_.size() ; l++)
+				node = children_[l][node*width_[l] + (s[l]-offset_[l])];
+			return terminals_[node];
+		}
+
+public:  // Utils
+
+	/**
+	 * @brief Build the diagram mapping each valuation in \p entries to its value
+	 *
+	 *        Any previously held information is discarded.
+	 *
+	 * @param state    State whose variables define the levels of the diagram
+	 * @param entries  Valuations and their values <b>(sorted, modified)</b>
+	 * @param defaultValue Value for all valuations not ocurring in \p entries
+	 *
+	 * @throw FigException if some valuation in \p entries doesn't match \p state
+	 * @throw FigException if \p entries has repeated valuations
+	 * @throw FigException if the diagram grows beyond the NodeId capacity
+	 */
+	void build(const State<STATE_INTERNAL_TYPE>& state,
+	           std::vector< Entry >& entries,
+	           const ImportanceValue& defaultValue = static_cast<ImportanceValue>(0u));
+
+	/**
+	 * @brief Combine pointwise with another diagram
+	 *
+	 *        Each valuation 's' is mapped to op(this(s), that(s)) afterwards,
+	 *        and so is the default value. Isomorphic sub-diagrams of the
+	 *        result are shared as in build().
+	 *
+	 * @param that Diagram built for the same State as this one
+	 * @param op   Binary operation on the values of both diagrams
+	 *
+	 * @note <b>Complexity:</b> <i>O(num_nodes() * that.num_nodes())</i>
+	 *       in the worst case; usually linear in the size of the result
+	 *
+	 * @throw FigException if the diagrams were built for different States
+	 * @throw FigException if the diagram grows beyond the NodeId capacity
+	 */
+	void apply(const ImportanceMDD& that,
+	           const std::function<ImportanceValue(const ImportanceValue&,
+	                                               const ImportanceValue&)>& op);
+
+	/**
+	 * @brief Visit every valuation mapped to a non-default value
+	 *
+	 *        Sub-diagrams constantly mapped to the default value are skipped,
+	 *        so the cost is proportional to the number of valuations visited
+	 *        (times the number of variables) rather than to the size of the
+	 *        concrete state space.
+	 *
+	 * @param visit Receives each such valuation and the value mapped to it
+	 */
+	void for_each(const std::function<void(const StateInstance&,
+	                                       const ImportanceValue&)>& visit) const;
+
+	/// Change each stored value for its image through \p f
+	/// @note <b>Complexity:</b> <i>O(num_terminals())</i>
+	void transform(const std::function<ImportanceValue(const ImportanceValue&)>& f);
+
+	/// Release all memory and leave the diagram empty()
+	void clear() noexcept;
+};
+
+} // namespace fig
+
+#endif // IMPORTANCEMDD_H
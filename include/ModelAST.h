@@ -34,6 +34,7 @@
 #include <cassert>
 #include <map>
 #include <set>
+#include <vector>
 #include <memory>
 #include <iostream>
 #include <sstream>
@@ -73,6 +74,111 @@ class location; //file location api generated by bison
 
 using ModelParserGen::location;
 
+/**
+ * @brief Identifier of a module, label, variable, clock... of the model
+ * @details Identifiers are interned in a table shared by all nodes of the
+ *          AST, so copies share the characters and comparisons for equality
+ *          are pointer comparisons. Converts implicitly to and from string.
+ * @note The table is not thread safe: build ASTs from one thread at a time
+ */
+class Identifier {
+	/// Interned characters
+	const string* str_;
+
+	/// Entry of the table for this string, created if missing
+	static const string& intern(const string& str);
+
+public:
+	Identifier() : str_(&intern(string())) {}
+	Identifier(const string& str) : str_(&intern(str)) {}
+	Identifier(const char* str) : str_(&intern(str)) {}
+
+	inline const string& str() const noexcept { return *str_; }
+	inline operator const string&() const noexcept { return *str_; }
+
+	inline bool operator==(const Identifier& that) const noexcept
+		{ return str_ == that.str_; }
+	inline bool operator!=(const Identifier& that) const noexcept
+		{ return str_ != that.str_; }
+};
+
+/**
+ * @brief Monotonic memory arena for the nodes of an AST
+ * @details Nodes built with make_node() while an ASTArena::Scope lives
+ *          are bump-allocated from big blocks of the arena, instead of
+ *          one heap allocation each. Memory is only released when the
+ *          arena dies, i.e. when the last node allocated from it dies.
+ */
+class ASTArena {
+	/// Size of the blocks requested to the heap
+	static constexpr size_t BLOCK_SIZE = 1ul<<16ul;
+
+	/// Memory blocks: the last one is being filled
+	std::vector< std::unique_ptr<char[]> > blocks_;
+
+	/// Bytes used from the last block
+	size_t used_;
+
+	/// Arena where this thread is currently building nodes, if any
+	static std::shared_ptr<ASTArena>& current_arena() noexcept;
+
+public:
+	ASTArena() : used_(BLOCK_SIZE) {}
+	ASTArena(const ASTArena&) = delete;
+	ASTArena& operator=(const ASTArena&) = delete;
+
+	/// Arena where make_node() is currently building nodes, maybe null
+	static inline const std::shared_ptr<ASTArena>& current() noexcept
+		{ return current_arena(); }
+
+	/// Get \p size bytes aligned to \p alignment (a power of two)
+	void* allocate(size_t size, size_t alignment);
+
+	/// Build nodes in a new arena during the lifetime of this object
+	class Scope {
+		std::shared_ptr<ASTArena> previous_;
+	public:
+		Scope() : previous_(current_arena())
+			{ current_arena() = std::make_shared<ASTArena>(); }
+		~Scope() { current_arena() = previous_; }
+		Scope(const Scope&) = delete;
+		Scope& operator=(const Scope&) = delete;
+	};
+};
+
+/// STL allocator drawing from an ASTArena, which it keeps alive
+template< typename T >
+class ASTArenaAllocator {
+	template< typename U > friend class ASTArenaAllocator;
+	std::shared_ptr<ASTArena> arena_;
+public:
+	typedef T value_type;
+	explicit ASTArenaAllocator(std::shared_ptr<ASTArena> arena) noexcept :
+		arena_(std::move(arena)) {}
+	template< typename U >
+	ASTArenaAllocator(const ASTArenaAllocator<U>& that) noexcept :
+		arena_(that.arena_) {}
+	inline T* allocate(size_t n)
+		{ return static_cast<T*>(arena_->allocate(n*sizeof(T), alignof(T))); }
+	inline void deallocate(T*, size_t) noexcept { /* freed with the arena */ }
+	template< typename U >
+	inline bool operator==(const ASTArenaAllocator<U>& that) const noexcept
+		{ return arena_ == that.arena_; }
+	template< typename U >
+	inline bool operator!=(const ASTArenaAllocator<U>& that) const noexcept
+		{ return arena_ != that.arena_; }
+};
+
+/// Build an AST node in the current ASTArena, if any, or else in the heap
+template< typename Node, typename... Args >
+std::shared_ptr<Node> make_node(Args&&... args) {
+	const auto& arena(ASTArena::current());
+	if (nullptr == arena)
+		return std::make_shared<Node>(std::forward<Args>(args)...);
+	return std::allocate_shared<Node>(ASTArenaAllocator<Node>(arena),
+	                                  std::forward<Args>(args)...);
+}
+
 /**
  * @brief The ModelAST class. This class represents an abstract syntax tree of
  * the model.
@@ -366,7 +472,7 @@ public:
 class ModuleAST : public ModelAST {
 private:
 	/// Module Name
-	string id;
+	Identifier id;
 
 	/// Local declarations of the model.
 	shared_vector<Decl> local_decls;
@@ -414,7 +520,7 @@ public:
 	}
 
 	/// Returns the name of the module
-	string get_name() {
+	const string& get_name() const {
 		return (id);
 	}
 
@@ -513,7 +619,7 @@ private:
 	Type type;
 
 	/// Declaration identifier (the variable or constant being declared)
-	string id;
+	Identifier id;
 
 	/// Vector of qualifiers (currently only DeclQualifier::constant)
 	std::vector<DeclQualifier> qualifiers;
@@ -552,7 +658,7 @@ public:
 	}
 
 	/// Return the identifier of this declaration
-	string get_id() const {
+	const string& get_id() const {
 		return (id);
 	}
 
@@ -785,7 +891,7 @@ public:
 class TransitionAST : public ModelAST {
 protected:
 	/// Name of the label.
-	string id;
+	Identifier id;
 	/// Type of the transition (input, output, commited)
 	LabelType type;
 	/// Precondition of the transition
@@ -808,7 +914,7 @@ public:
 	virtual void accept(Visitor& visit) override;
 
 	/// Returns the label of the module
-	string get_label() {
+	const string& get_label() const {
 		return (id);
 	}
 
@@ -1188,7 +1294,7 @@ public:
 class Location : public ModelAST {
 private:
 	/// The identifier
-	string id;
+	Identifier id;
 
 	/// Convenient pointer to identifier declaration
 	/// @note set by ModelReductor
@@ -1204,7 +1310,7 @@ public:
 	virtual void accept(Visitor& visit) override;
 
 	/// The identifier
-	string get_identifier() const {
+	const string& get_identifier() const {
 		return (id);
 	}
 
@@ -1458,7 +1564,7 @@ private:
 public:
 	/// Create a location expression
 	LocExp(std::shared_ptr<Location> location) : location {location} {}
-	LocExp(string id) : location(make_shared<Location>(std::forward<string>(id))) {}
+	LocExp(string id) : location(make_node<Location>(std::forward<string>(id))) {}
 
 	LocExp(const LocExp &) = delete;
 	void operator=(const LocExp &) = delete;
@@ -1539,7 +1645,7 @@ public:
 	/// conjuction of the given arguments
 	static std::shared_ptr<Exp> make_andd(std::shared_ptr<Exp> exp1,
 									 std::shared_ptr<Exp> exp2) {
-		return make_shared<BinOpExp>(ExpOp::andd, exp1, exp2);
+		return make_node<BinOpExp>(ExpOp::andd, exp1, exp2);
 	}
 
 	std::shared_ptr<Exp> get_first_argument() {
@@ -1627,7 +1733,7 @@ public:
 
 	/// Create a expression that represents the negation of the given argument
 	static std::shared_ptr<Exp> make_nott(std::shared_ptr<Exp> exp) {
-		return make_shared<UnOpExp>(ExpOp::nott, exp);
+		return make_node<UnOpExp>(ExpOp::nott, exp);
 	}
 
 	void set_inferred_type(UnaryOpTy type) {
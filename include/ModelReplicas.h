@@ -0,0 +1,187 @@
+//==============================================================================
+//
+//  ModelReplicas.h
+//
+//  Copyleft 2026-
+//  Authors:
+//  - The FIG contributors
+//
+//------------------------------------------------------------------------------
+//
+//  This file is part of FIG.
+//
+//  The Finite Improbability Generator (FIG) project is free software;
+//  you can redistribute it and/or modify it under the terms of the GNU
+//  General Public License as published by the Free Software Foundation;
+//  either version 3 of the License, or (at your option) any later version.
+//
+//  FIG is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with FIG; if not, write to the Free Software Foundation,
+//	Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//==============================================================================
+
+
+#ifndef MODELREPLICAS_H
+#define MODELREPLICAS_H
+
+// C++
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <exception>
+// External code
+#include <omp.h>
+// FIG
+#include <ModuleNetwork.h>
+#include <CancellationToken.h>
+#include <Property.h>
+#include <Clock.h>
+
+
+namespace fig
+{
+
+class ImportanceFunction;
+
+/**
+ * @brief Per-thread copies of the system model, to simulate in parallel
+ *
+ *        Simulations change the internal state of the guards and
+ *        postconditions of the model, and of the property checked,
+ *        so threads can't share them. This class holds a copy of both
+ *        for each thread but the first, which uses the originals,
+ *        and runs batches of independent simulations among all threads.
+ *        Each thread samples the clocks from its own RNG substream, and the
+ *        \ref ModuleNetwork::num_steps() "steps" taken by the copies are
+ *        added to those of the original model after each run.
+ *
+ *        Copies are only made when several threads are available and the
+ *        ImportanceFunction queried by the simulations supports
+ *        \ref ImportanceFunction::concurrent_queries() "concurrent queries".
+ *        Otherwise run() simulates sequentially, as usual.
+ *
+ * @note The Traials simulated must be taken from the TraialPool beforehand,
+ *       which isn't thread safe
+ */
+class ModelReplicas
+{
+	/// System model, simulated by the first thread
+	const ModuleNetwork& network_;
+
+	/// Property checked by the first thread, if any
+	const Property* property_;
+
+	/// Copies of the model for the other threads
+	std::vector< std::shared_ptr< ModuleNetwork > > networks_;
+
+	/// Copies of the property for the other threads
+	std::vector< std::shared_ptr< Property > > properties_;
+
+public:  // Ctors
+
+	/**
+	 * @brief Prepare the copies needed to simulate in parallel
+	 * @param network  System model to simulate
+	 * @param impFun   ImportanceFunction queried during the simulations
+	 * @param property <i>(Optional)</i> Property checked during the simulations
+	 */
+	ModelReplicas(const ModuleNetwork& network,
+	              const ImportanceFunction& impFun,
+	              const Property* property = nullptr);
+
+	/// Copies are heavy and bound to the originals
+	ModelReplicas(const ModelReplicas&) = delete;
+
+	/// Copies are heavy and bound to the originals
+	ModelReplicas& operator=(const ModelReplicas&) = delete;
+
+public:  // Accessors
+
+	/// Number of threads which will simulate in run()
+	inline size_t num_threads() const noexcept { return networks_.size() + 1ul; }
+
+	/// Whether run() simulates in parallel
+	inline bool parallel() const noexcept { return !networks_.empty(); }
+
+public:  // Utils
+
+	/**
+	 * @brief Run \p numSims independent simulations, in parallel if possible
+	 *
+	 *        The i-th simulation is <tt>simulate(i, network, property)</tt>,
+	 *        where \p network and \p property are the copies (or originals)
+	 *        of the thread running it, \p property being null if none was
+	 *        given at construction. Simulations must only touch data of
+	 *        their own, e.g. the i-th of a vector of Traials.
+	 *
+	 * @param numSims  Number of simulations to run
+	 * @param halt     For external signalling: skip the simulations left,
+	 *                 also checked against its deadline in between simulations
+	 * @param simulate Simulation to run, as described above
+	 *
+	 * @throw Whatever the first simulation failing threw,
+	 *        after the simulations running at the time finished
+	 */
+	template< typename Simulation >
+	void run(const size_t& numSims,
+	         const CancellationToken& halt,
+	         Simulation simulate) const;
+};
+
+
+template< typename Simulation >
+void
+ModelReplicas::run(const size_t& numSims,
+                   const CancellationToken& halt,
+                   Simulation simulate) const
+{
+	const long NUM_SIMS(static_cast<long>(numSims));
+	if (!parallel() || numSims < 2ul) {
+		for (long i = 0l ; i < NUM_SIMS && !halt.expired() ; i++)
+			simulate(static_cast<size_t>(i), network_, property_);
+		return;
+	}
+	const unsigned long round(Clock::new_parallel_round());
+	std::atomic<bool> failed(false);
+	std::exception_ptr failure = nullptr;
+	unsigned long steps(0ul);
+	#pragma omp parallel default(shared) num_threads(num_threads()) reduction(+:steps)
+	{
+		const size_t tid(static_cast<size_t>(omp_get_thread_num()));
+		const ModuleNetwork& network(0ul == tid ? network_ : *networks_[tid-1ul]);
+		const unsigned long stepsBefore(network.num_steps());
+		const Property* property(0ul == tid || nullptr == property_
+		                         ? property_ : properties_[tid-1ul].get());
+		Clock::thread_rng(round, static_cast<unsigned>(tid));
+		#pragma omp for schedule(dynamic)
+		for (long i = 0l ; i < NUM_SIMS ; i++) {
+			if (failed || halt.expired())
+				continue;  // skip the simulations left
+			try {
+				simulate(static_cast<size_t>(i), network, property);
+			} catch (...) {
+				#pragma omp critical (fig_model_replicas_failure)
+				if (!failed) {
+					failure = std::current_exception();
+					failed = true;
+				}
+			}
+		}
+		Clock::shared_rng();
+		if (0ul < tid)
+			steps += network.num_steps() - stepsBefore;
+	}
+	network_.numSteps_ += steps;
+	if (failed)
+		std::rethrow_exception(failure);
+}
+
+} // namespace fig
+
+#endif // MODELREPLICAS_H
@@ -36,6 +36,7 @@
 #include <memory>
 #include <chrono>
 #include <iterator>     // std::begin(), std::end(), std::distance()
+#include <algorithm>    // std::find()
 #include <type_traits>  // std::is_constructible<>
 #include <unordered_map>
 #include <functional>
@@ -45,6 +46,7 @@
 #include <ImportanceFunctionConcrete.h>
 #include <ThresholdsBuilder.h>
 #include <SimulationEngine.h>
+#include <StoppingConditions.h>
 
 #if __cplusplus < 201103L
 #  error "C++11 standard required, please compile with -std=c++11\n"
@@ -61,7 +63,6 @@ namespace fig
 
 class Property;
 class ThresholdsBuilder;
-class StoppingConditions;
 class ConfidenceIntervalResult;
 class SignalSetter;
 
@@ -146,6 +147,46 @@ class ModelSuite
 	/// Wall-clock-time execution limit for simulations (in seconds)
 	static std::chrono::seconds timeout_;
 
+	/// Whether RESTART engines re-tune the splitting of the threshold
+	/// levels in between batches during estimations
+	static bool retuneEffort_;
+
+	/// Max number of Traials alive at once in RESTART simulations,
+	/// or zero for no limit
+	static size_t maxTraials_;
+
+	/// Whether process_batch() warm starts the adaptive thresholds builders
+	/// from the thresholds built for the previous global effort
+	static bool warmThresholds_;
+
+	/// Whether thresholds builders that measure the cost of simulating
+	/// each level choose efforts minimising variance per CPU time
+	static bool costAwareThresholds_;
+
+	/// Whether estimate() runs a single simulation stream for all the
+	/// stopping conditions requested, rather than one per condition
+	static bool singlePass_;
+
+	/// Whether process_batch() estimates all transient properties at once
+	/// with the "nosplit" engine, from a single stream of simulations
+	static bool sharedTrajectories_;
+
+	/// Whether rate properties are estimated from independent regeneration
+	/// cycles rather than with batch means, when the engine and model
+	/// (which must be Markovian) support it
+	static bool regenerative_;
+
+	/// Whether confidence criteria are checked with anytime-valid
+	/// confidence sequences, which allow stopping as soon as they're met
+	static bool anytimeValid_;
+
+	/// Whether the "nosplit" engine simulates in antithetic pairs
+	static bool antithetic_;
+
+	/// Whether the "nosplit" engine uses common random numbers,
+	/// viz. an RNG substream per independent simulation
+	static bool commonRandomNumbers_;
+
 	/// Confidence intervals produced during the last call to estimate()
 	static std::vector< ConfidenceIntervalResult > lastEstimates_;
 
@@ -160,8 +201,8 @@ class ModelSuite
 	/// Signal handler for when we're terminated (e.g. kill) mid-estimation
 	static SignalSetter SIGTERMhandler_;
 
-	/// ConfidenceInterval to show currently reached estimation if interrupted
-	static const ConfidenceInterval* interruptCI_;
+	/// ConfidenceIntervals to show currently reached estimations if interrupted
+	static std::vector< const ConfidenceInterval* > interruptCIs_;
 
 	/// Practical confidence coefficients to show if interrupted
 	static const std::vector< float > confCoToShow_;
@@ -332,6 +373,46 @@ public:  // Populating facilities and other modifyers
 	/// Set (high) verbosity output printing in logs
 	static void set_verbosity(bool verboseOutput) noexcept;
 
+	/// @copydoc retuneEffort_
+	/// @note Applies to the engines prepared after this call
+	/// @see SimulationEngineRestart::set_effort_retuning()
+	static void set_effort_retuning(bool retune) noexcept;
+
+	/// @copydoc maxTraials_
+	/// @note Applies to the engines prepared after this call
+	/// @see SimulationEngineRestart::set_max_traials()
+	static void set_max_traials(size_t maxTraials) noexcept;
+
+	/// @copydoc warmThresholds_
+	/// @see ThresholdsBuilderAdaptive::set_prior()
+	static void set_thresholds_warm_start(bool warm) noexcept;
+
+	/// @copydoc costAwareThresholds_
+	/// @see ThresholdsBuilderES::set_cost_aware()
+	static void set_cost_aware_thresholds(bool costAware) noexcept;
+
+	/// @copydoc singlePass_
+	static void set_single_pass_estimation(bool singlePass) noexcept;
+
+	/// @copydoc sharedTrajectories_
+	/// @see estimate_shared()
+	static void set_shared_trajectories(bool shared) noexcept;
+
+	/// @copydoc regenerative_
+	/// @see SimulationEngine::regenerative_simulations()
+	static void set_regenerative(bool regenerative) noexcept;
+
+	/// @copydoc anytimeValid_
+	/// @see ConfidenceInterval::sequence_quantile()
+	static void set_anytime_valid(bool anytimeValid) noexcept;
+
+	/// Choose the variance reduction of the "nosplit" engine
+	/// @param antithetic @copybrief antithetic_
+	/// @param crn        @copybrief commonRandomNumbers_
+	/// @note Takes effect in the following prepare_simulation_engine()
+	/// @see SimulationEngineNosplit::set_variance_reduction()
+	static void set_variance_reduction(bool antithetic, bool crn) noexcept;
+
 public:  // Accessors
 
 	/// Is output printing in logs highly verbose?
@@ -809,6 +890,37 @@ public:  // Simulation utils
 	              const StoppingConditions& bounds,
 	              const ImpFunSpec ifunSpec = ImpFunSpec("null","null")) const;
 
+	/**
+	 * @brief Estimate the value of several transient properties
+	 *        from a single stream of standard Monte Carlo simulations
+	 *
+	 *        Each simulation runs until all properties still being estimated
+	 *        have decided their value on it, and each property stops as soon
+	 *        as its confidence interval meets the criterion requested.
+	 *        Results are reported per property as they converge.
+	 *
+	 * @param properties Transient properties to estimate
+	 * @param engine     \ref SimulationEngineNosplit "nosplit" engine
+	 *                   already tied to an ImportanceFunction
+	 * @param bounds     List of stopping conditions to experiment with
+	 *
+	 * @throw FigException if engine isn't a ready "nosplit" engine
+	 * @throw FigException if some property isn't transient
+	 * @throw FigException if single-pass estimation was requested
+	 *                     for several stopping conditions
+	 *
+	 * @note The variance reduction of the engine (antithetic variates,
+	 *       common random numbers) applies to the shared simulations
+	 * @note Resets previous estimations as returned by get_last_estimates():
+	 *       for each stopping condition these hold one interval per property,
+	 *       in the order the properties were given
+	 * @see SimulationEngineNosplit::simulate_shared()
+	 */
+	void estimate_shared(const std::vector< std::shared_ptr< const Property > >& properties,
+	                     SimulationEngine& engine,
+	                     const StoppingConditions& bounds,
+	                     const ImpFunSpec ifunSpec = ImpFunSpec("null","null")) const;
+
 	/**
 	 * @brief Estimate the value of all \ref Property "stored properties"
 	 *        using the specified mechanisms.
@@ -865,6 +977,25 @@ private:  // Class utils
 							const SimulationEngine& engine,
 							const StoppingConditions& bounds) const;
 
+	/// Specialization of estimate() running one simulation stream for all
+	/// stopping conditions: each confidence criterion is reported as soon as
+	/// it's met, and each time budget as soon as it elapses
+	/// @see set_single_pass_estimation()
+	void estimate_single_pass(const Property& property,
+	                          const SimulationEngine& engine,
+	                          const StoppingConditions& bounds) const;
+
+	/// If \p warm and warm starts are \ref set_thresholds_warm_start()
+	/// "enabled", make the adaptive thresholds builder \p thrSpec refine
+	/// the thresholds it built last; otherwise make it start from scratch
+	void warm_start_thresholds(const std::string& thrSpec, bool warm) const;
+
+	/// Whether rate properties are estimated with \p engine from regeneration
+	/// cycles: upon request for "nosplit" on Markovian models, and always
+	/// for "is" (which requires them)
+	/// @see set_regenerative()
+	static bool regenerative_for(const SimulationEngine& engine) noexcept;
+
 public: // Debug
         void print_info(std::ostream &out) const;
 		void print_importance_function(std::ostream &out, const ImportanceFunction &imf) const;
@@ -939,7 +1070,7 @@ ModelSuite::process_batch(const std::string& engineName,
 		throw_FigException("aborting execution since no estimation bounds "
 						   "were specified.");
 	} else if (distance(begin(globalEffortValues), end(globalEffortValues))
-			   == 0ul && "nosplit" != engineName) {
+			   == 0ul && simulators[engineName]->isplit()) {
 		log("Can't estimate: no global effort value was specified for engine \""
 			+ engineName + "\"\n");
 		throw_FigException("aborting execution since no global effort values "
@@ -947,9 +1078,45 @@ ModelSuite::process_batch(const std::string& engineName,
 						   engineName + "\"");
 	}
 
+	// Transient properties may share the simulations of standard Monte Carlo
+	std::vector< std::shared_ptr<const Property> > shared;
+	const bool singlePass(singlePass_ && std::any_of(begin(estimationBounds),
+	                                                 end(estimationBounds),
+	                                                 [](const StoppingConditions& b)
+	                                                 { return b.size() > 1ul; }));
+	if (sharedTrajectories_ && "nosplit" == engineName && singlePass)
+		techLog_ << "[WARNING] Shared simulations can't be combined with "
+		         << "single-pass estimation: estimating each property apart\n";
+	else if (sharedTrajectories_ && "nosplit" == engineName)
+		for (std::shared_ptr<const Property> property: properties)
+			if (PropertyType::TRANSIENT == property->type)
+				shared.push_back(property);
+	if (shared.size() > 1ul) {
+		const auto& property(shared.front());
+		if ("flat" == impFunSpec.strategy)
+			build_importance_function_flat(impFunSpec.name, *property, true);
+		else if ("auto" == impFunSpec.strategy)
+			build_importance_function_auto(impFunSpec, *property, true);
+		else if ("adhoc" == impFunSpec.strategy)
+			build_importance_function_adhoc(impFunSpec, *property, true);
+		auto engine = prepare_simulation_engine(engineName,
+		                                        impFunSpec.name,
+		                                        thrSpec,
+		                                        property);
+		assert(engine->ready());
+		for (const StoppingConditions& bounds: estimationBounds)
+			estimate_shared(shared, *engine, bounds, impFunSpec);
+	} else {
+		shared.clear();
+	}
+
 	// For each property ...
 	for (std::shared_ptr<const Property> property: properties) {
 
+		// ... unless it was estimated in the shared simulations ...
+		if (end(shared) != std::find(begin(shared), end(shared), property))
+			continue;
+
 		// ... build the importance function ...
 		if ("flat" == impFunSpec.strategy)
 			build_importance_function_flat(impFunSpec.name, *property, true);
@@ -960,6 +1127,7 @@ ModelSuite::process_batch(const std::string& engineName,
 		assert(impFuns[impFunSpec.name]->has_importance_info());
 
 		// ... and for each global effort specified ...
+		warm_start_thresholds(thrSpec, false);
 		for (auto ge: globalEffortValues) {
 
 			// ... choose thresholds, bind engine and ifun, etc ...
@@ -975,9 +1143,13 @@ ModelSuite::process_batch(const std::string& engineName,
 			for (const StoppingConditions& bounds: estimationBounds)
 				estimate(*property, *engine, bounds, impFunSpec);
 
-			if ("flat" == impFunSpec.strategy)
+			if ("flat" == impFunSpec.strategy || !engine->isplit())
 				break;  // no splits are used, avoid repetitions
+
+			// ... refining these thresholds for the next global effort
+			warm_start_thresholds(thrSpec, true);
 		}
+		warm_start_thresholds(thrSpec, false);
 	}
 }
 
@@ -4,6 +4,8 @@
 
 #include <functional>
 #include <set>
+#include <map>
+#include <vector>
 #include <memory>
 
 #include "ModelTC.h"
@@ -64,6 +66,10 @@ public:
  *       Condition 6: "general input-enabled" => ensured by backend
  *       Condition 7: @see ModelVerifier::check_input_determinism_all
  * @note Checking are done without "reachability analisis"
+ * @note The pairs of transitions of a module are checked in parallel, by
+ *       workers with their own z3::context. Pairs whose guards fix some
+ *       state-variable to different constants are discarded without
+ *       calling the solver.
  */
 class ModelVerifier : public Visitor {
 private: // Members
@@ -76,9 +82,22 @@ private: // Members
     /// Z3 solver used to check that the conditions hold.
     unique_ptr<z3::solver> solver;
 
-public:
-	/// Modules with more than this # of transitions can't be verified
-	static constexpr size_t NTRANS_BOUND = 1ul<<7ul;  // from test cases
+    /// Guards already converted in this context, with their state-variables
+    std::map<shared_ptr<Exp>, std::pair<z3::expr, std::set<string>>> guards;
+
+    /// Range constraints already built in this context, per state-variable
+    std::map<string, z3::expr> limits;
+
+    /// Transition "first" must be checked against each transition
+    /// in "seconds", all of them sharing the clock (or label) "id"
+    struct Batch {
+        string id;
+        shared_ptr<TransitionAST> first;
+        std::vector<shared_ptr<TransitionAST>> seconds;
+    };
+
+    /// Worker for the parallel checks: has its own z3::context
+    explicit ModelVerifier(shared_ptr<ModuleScope> scope);
 
 private: // Auxiliar functions
     /// Adds to the solvers assertions to ensure that the
@@ -97,6 +116,18 @@ private: // Auxiliar functions
     /// state variables that occur in the expression inside the given set.
     z3::expr convert(shared_ptr<Exp> exp, std::set<string>& names);
 
+    /// Like convert(exp, names) but converting each guard only once
+    const z3::expr& guard(shared_ptr<Exp> exp, std::set<string>& names);
+
+    /// Run the given check on every batch, in parallel, and collect the
+    /// messages produced in the order of the batches.
+    /// If "stopOnWarning" only the messages up to (and including) the first
+    /// batch with warnings are kept, like a sequential check that stops
+    /// as soon as it finds a warning.
+    void run_batches(const std::vector<Batch>& batches,
+                     void (ModelVerifier::*check)(const Batch&),
+                     bool stopOnWarning);
+
     /// Check if the postconditions of the given transitions are equivalent
     /// (i.e, each state-variable changes in the same way in both transitions)
     void check_rhs(shared_ptr<TransitionAST> a1, shared_ptr<TransitionAST> a2);
@@ -141,6 +172,9 @@ private: // Auxiliar functions
     /// 4 - there is no transition waiting for "clock_id" whose precondition
     /// hold, or "a2" waits for "clock_id".
     /// That means that a1 is enables by a2 with a potentially exhausted clock
+    /// @note If "a2" changes none of the state-variables in the precondition
+    ///       of "a1" then 2 and 3 contradict each other: this is detected
+    ///       without calling the solver.
     bool enables_exhausted(shared_ptr<TransitionAST> a1, shared_ptr<TransitionAST> a2,
                            const string &clock_id);
 
@@ -160,7 +194,7 @@ private:
     /// That means that if two transitions are enabled with the same clock,
     /// there is no observable difference if one or the other transition is
     /// executed.
-    void check_output_determinism(const string &clock_id);
+    void check_output_determinism(const Batch& batch);
     void check_output_determinism_all();
 private:
     /// Check condition 7 of IOSA.
@@ -168,7 +202,7 @@ private:
     /// input label "a".
     /// If b1 & b2 hold => reseted_clocks(e1) = reseted_clocks(e2)
     ///                    & same_state(e1, e2)
-    void check_input_determinism(const string &label_id);
+    void check_input_determinism(const Batch& batch);
     void check_input_determinism_all();
 private:
     /// Check condition 4 of IOSA
@@ -187,7 +221,7 @@ private:
     /// Here OR(W(T1)) is the disjunction of the preconditions of the transitions
     /// waiting for W(T1)
     /// @see enables_exhausted
-    void check_exhausted_clocks(const string &clock_id);
+    void check_exhausted_clocks(const Batch& batch);
     void check_exhausted_clocks_all();
 
     /// Evaluate expression to a constant (IConst, BConst or FConst)
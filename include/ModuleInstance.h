@@ -271,10 +271,11 @@ public:  // Ctors/Dtor and populating facilities
 				   Iterator< ValueTypeIterator, OtherIteratorArgs... > from,
 				   Iterator< ValueTypeIterator, OtherIteratorArgs... > to);
 
-	/// Default copy ctor
-	/// @note This shares the transitions with 'that', which should be safe
-	///       since Transition doesn't have an internal state
-	ModuleInstance(const ModuleInstance& that) = default;
+	/// Copy ctor
+	/// @note The copy owns its transitions, whose guards and postconditions
+	///       keep an internal state, so that it can simulate concurrently
+	///       with 'that'
+	ModuleInstance(const ModuleInstance& that);
 
 	/// Default move ctor
 	ModuleInstance(ModuleInstance&& that) = default;
@@ -408,6 +409,7 @@ public:  // Utils
 	 * @param clockName    Name of the clock (from this model!) which expires
 	 * @param elapsedTime  Time lapse for the clock to expire
 	 * @param traial       Instance of Traial to update
+	 * @param sample       How to sample the clocks reset, e.g. a Clock::Sampler
 	 *
 	 * @return Output label fired by the transition taken.
 	 *         If none was enabled then a "should_ignore" label is returned.
@@ -429,8 +431,10 @@ public:  // Utils
 	 * @see jump(const Label&, const CLOCK_INTERNAL_TYPE&, Traial&)
 	 * @see jump_committed(Traial&)
 	 */
+	template< class Sampler = SampleClock >
 	const Label& jump(const Traial::Timeout& to,
-					  Traial& traial) const;
+					  Traial& traial,
+					  const Sampler& sample = Sampler()) const;
 
 	/**
 	 * @brief Passive module jump following a <i>timed</i> input \p label
@@ -438,6 +442,7 @@ public:  // Utils
 	 * @param label        Output label triggered by current active jump
 	 * @param elapsedTime  Time lapse for the clock to expire
 	 * @param traial       Instance of Traial to update
+	 * @param sample       How to sample the clocks reset, e.g. a Clock::Sampler
 	 *
 	 * @note <b>Complexity:</b> <i>O(t*v+c)</i>, where
 	 *       <ul>
@@ -456,9 +461,11 @@ public:  // Utils
 	 * @see jump(const Traial::Timeout&, Traial&)
 	 * @see jump_committed(const Label&, Traial&)
 	 */
+	template< class Sampler = SampleClock >
 	void jump(const Label& label,
 			  const CLOCK_INTERNAL_TYPE& elapsedTime,
-			  Traial& traial) const;
+			  Traial& traial,
+			  const Sampler& sample = Sampler()) const;
 
 	/**
 	 * Basically the same as the \ref jump(const Label&, const float&, Traial&)
@@ -490,6 +497,7 @@ public:  // Utils
 	 *        Otherwise nothing is done.
 	 *
 	 * @param traial  Instance of Traial to update
+	 * @param sample  How to sample the clocks reset, e.g. a Clock::Sampler
 	 *
 	 * @return Output-committed label fired by the transition taken.
 	 *         If none was enabled then a \ref Label::should_ignore()
@@ -503,7 +511,9 @@ public:  // Utils
 	 * @see jump_committed(const Label&, Traial&)
 	 * @see jump(const Traial::Timeout&, Traial&)
 	 */
-	 const Label& jump_committed(Traial& traial);
+	template< class Sampler = SampleClock >
+	const Label& jump_committed(Traial& traial,
+	                            const Sampler& sample = Sampler());
 
 	/**
 	 * @brief Passive module jump executing an input-committed transition
@@ -516,6 +526,7 @@ public:  // Utils
 	 *
 	 * @param label   Output-committed label triggered by current active jump
 	 * @param traial  Instance of Traial to update
+	 * @param sample  How to sample the clocks reset, e.g. a Clock::Sampler
 	 *
 	 * @warning seal() must have been called beforehand
 	 * \ifnot NDEBUG
@@ -525,7 +536,10 @@ public:  // Utils
 	 * @see jump_committed(Traial&)
 	 * @see jump(const Label&, const CLOCK_INTERNAL_TYPE&, Traial&)
 	 */
-	void jump_committed(const Label& label, Traial& traial) const;
+	template< class Sampler = SampleClock >
+	void jump_committed(const Label& label,
+	                    Traial& traial,
+	                    const Sampler& sample = Sampler()) const;
 
 private:  // Class utils
 
@@ -538,13 +552,16 @@ private:  // Class utils
 	 *
 	 * @param traial       Instance of Traial to update
 	 * @param transitions  Transitions to consider
+	 * @param sample       How to sample the clocks reset
 	 *
 	 * @return Label of the matching transition if one was enabled,
 	 *         a \ref Label::should_ignore() "label to ignore" otherwise.
 	 */
+	template< class Sampler >
 	const Label&
 	apply_postcondition(Traial &traial,
-	                    const transition_vector_t &transitions) const;
+	                    const transition_vector_t &transitions,
+	                    const Sampler& sample) const;
 
 	/// Apply postcondition of the (first) enabled transition, if any.
 	/// @param state        State to update
@@ -69,6 +69,8 @@ class ModuleNetwork : public Module
 {
 	friend class Traial;
 	friend class ImportanceFunctionConcreteSplit;  // grant access to the modules
+	friend class SimulationEngineIS;  // grant access to the clocks
+	friend class ModelReplicas;  // gather the steps of the copies
 
 private:  // Attributes shared with our friends
 
@@ -92,6 +94,11 @@ private:
 	/// Whether the system model has already been sealed for simulations
 	bool sealed_;
 
+	/// Number of jumps performed by simulation_step() so far.
+	/// Each copy counts its own: ModelReplicas adds the steps
+	/// of its copies here after each parallel run
+	mutable unsigned long numSteps_;
+
 public:  // Ctors/Dtor
 
 	/// No data ctor, only empty ctor provided
@@ -143,6 +150,9 @@ public:  // Accessors
 
 	inline bool sealed() const noexcept override { return sealed_; }
 
+	/// @copydoc numSteps_
+	inline unsigned long num_steps() const noexcept { return numSteps_; }
+
 	/// @copydoc gState
 	inline const State<STATE_INTERNAL_TYPE>& global_state() const noexcept { return gState; }
 
@@ -169,6 +179,16 @@ public:  // Utils
 	 */
 	std::forward_list<size_t> adjacent_states(const size_t& s) const override;
 
+	/**
+	 * @brief Valuations reachable in one step from the given global valuation
+	 * @param s Valuation of all the variables of the system's global state
+	 * @details Same as adjacent_states(const size_t&) but without encoding
+	 *          the states, so it can be used when the concrete state space
+	 *          is too big to be indexed by a size_t
+	 * @note <b>Complexity:</b> same as adjacent_states(const size_t&)
+	 */
+	std::forward_list<StateInstance> adjacent_states(const StateInstance& s) const;
+
 	/**
 	 * @brief Shut the network and fill in internal global data.
 	 *
@@ -207,6 +227,7 @@ public:  // Utils
 	 * @param traial   Traial instance keeping track of the simulation <b>(modified)</b>
 	 * @param property Property whose value is currently being estimated
 	 * @param watch_events Function telling when does a simulation step finish
+	 * @param sample   How to sample the clocks reset, e.g. a Clock::Sampler
 	 *
 	 * @return Events observed/marked by the 'watch_event' member function
 	 *         when a finishing event for this simulation step is triggered.
@@ -217,10 +238,12 @@ public:  // Utils
 	 * @warning seal() must have been called beforehand
 	 */
 	template< typename DerivedProperty,
-	          class TraialMonitor >
+	          class TraialMonitor,
+	          class Sampler = SampleClock >
 	Event simulation_step(Traial& traial,
 	                      const DerivedProperty& property,
-	                      const TraialMonitor& watch_events) const;
+	                      const TraialMonitor& watch_events,
+	                      const Sampler& sample = Sampler()) const;
 
 	/**
 	 * @brief Advance a traial and keep track of maximum importance reached
@@ -259,8 +282,10 @@ private:  // Committed actions processing
      * @note This will choose *the first* enabled transition.
      * Assuming the model is confluent this choice is safe.
      * @param Traial that receives the changes in the state.
+     * @param sample How to sample the clocks reset
      */
-	bool process_committed_once(Traial &traial) const;
+	template< class Sampler >
+	bool process_committed_once(Traial &traial, const Sampler& sample) const;
 
     /**
      * @brief Process all the committed actions repeatedly until
@@ -269,8 +294,11 @@ private:  // Committed actions processing
      * enable another committed transition that should be executed inmmediately,
      * and that is why this method is necessary.
      * @param Traial that receives the changes in the state.
+     * @param sample How to sample the clocks reset
      */
-	void process_committed(Traial &Traial) const;
+	template< class Sampler = SampleClock >
+	void process_committed(Traial &Traial,
+	                       const Sampler& sample = Sampler()) const;
 
 public:  // Debug
 
@@ -303,7 +331,7 @@ ModuleNetwork::peak_simulation(Traial& traial,
 			const float elapsedTime(to.value);
 			assert(0.0f <= elapsedTime);
 			// Active jump in the module whose clock timed-out:
-			const Label& label = to.module->jump(to, traial);
+			const Label& label = modules[to.module->global_index()]->jump(to, traial);
 			// Passive jumps in the modules listening to label:
 			for (auto module_ptr: modules)
 				if (module_ptr->name != to.module->name)
@@ -0,0 +1,176 @@
+//==============================================================================
+//
+//  PerfCounters.h
+//
+//  Copyleft 2026-
+//  Authors:
+//  - The FIG contributors
+//
+//------------------------------------------------------------------------------
+//
+//  This file is part of FIG.
+//
+//  The Finite Improbability Generator (FIG) project is free software;
+//  you can redistribute it and/or modify it under the terms of the GNU
+//  General Public License as published by the Free Software Foundation;
+//  either version 3 of the License, or (at your option) any later version.
+//
+//  FIG is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with FIG; if not, write to the Free Software Foundation,
+//	Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//==============================================================================
+
+
+#ifndef PERFCOUNTERS_H
+#define PERFCOUNTERS_H
+
+// C++
+#include <array>
+#include <string>
+#include <ostream>
+#include <algorithm>  // std::min()
+
+
+namespace fig
+{
+
+/// Events in the hot path of simulations which can be counted
+enum class PerfEvent : unsigned
+{
+	STEP = 0,        ///< Jump performed by ModuleNetwork::simulation_step()
+	COMMITTED_LOOP,  ///< Round of committed actions processed
+	GUARD_EVAL,      ///< Evaluation of a transition's precondition
+	CLOCK_SAMPLE,    ///< Clock sampled, indexed by distribution
+	SPLIT,           ///< Traial created by splitting, indexed by level
+	KILL,            ///< Traial discarded, indexed by level
+	TRAIAL_COPY,     ///< Contents of a Traial copied into another
+	POOL_GROWTH,     ///< New Traials allocated by the TraialPool
+	NUM_EVENTS
+};
+
+
+/**
+ * @brief Built-in counters of the simulations' hot path
+ *
+ *        Each thread counts into its own block of (non-atomic) counters,
+ *        which collect() sums up, e.g. at the end of an estimation.
+ *        Some events are also counted per index, viz. per threshold level
+ *        or per clock distribution; indices beyond MAX_INDEX are lumped
+ *        together in the last slot.
+ *
+ *        Counting is only compiled in if the preprocessor macro
+ *        PERF_COUNTERS is defined (see the CMake option of the same name).
+ *        Otherwise the FIG_PERF_COUNT* macros expand to nothing,
+ *        and thus cost nothing at all.
+ *
+ * @warning collect() and reset() must not run concurrently with simulations
+ */
+class PerfCounters
+{
+public:
+
+#ifdef PERF_COUNTERS
+	static constexpr bool ENABLED = true;
+#else
+	static constexpr bool ENABLED = false;
+#endif
+
+	/// Number of indices counted separately for indexed events
+	static constexpr size_t MAX_INDEX = 64ul;
+
+	static constexpr size_t NUM_EVENTS = static_cast<size_t>(PerfEvent::NUM_EVENTS);
+
+	/// Block of counters
+	struct Counts
+	{
+		/// Total count per event
+		std::array< unsigned long, NUM_EVENTS > total;
+
+		/// Count per event and index
+		std::array< std::array< unsigned long, MAX_INDEX >, NUM_EVENTS > indexed;
+
+		/// All zeros
+		Counts();
+
+		/// Accumulate the counts of 'that' block
+		Counts& operator+=(const Counts& that);
+	};
+
+private:
+
+	/// Counters of this thread
+	static thread_local Counts* local_;
+
+	/// Create and register the counters of this thread
+	static Counts* register_thread();
+
+	/// Counters of the calling thread
+	static inline Counts& local()
+		{
+			if (nullptr == local_)
+				local_ = register_thread();
+			return *local_;
+		}
+
+public:  // Counting
+
+	/// Count \p n occurrences of event \p e
+	static inline void count(const PerfEvent& e, const unsigned long& n = 1ul)
+		{ local().total[static_cast<size_t>(e)] += n; }
+
+	/// Count \p n occurrences of event \p e at index \p idx
+	static inline void count_at(const PerfEvent& e,
+	                            const size_t& idx,
+	                            const unsigned long& n = 1ul)
+		{
+			auto& counts(local());
+			const auto i(static_cast<size_t>(e));
+			counts.total[i] += n;
+			counts.indexed[i][std::min(idx, MAX_INDEX-1ul)] += n;
+		}
+
+	/// Index of the clock distribution \p distName for CLOCK_SAMPLE events
+	static size_t distribution_index(const std::string& distName);
+
+public:  // Aggregation
+
+	/// Sum of the counters of all threads
+	static Counts collect();
+
+	/// Zero the counters of all threads
+	static void reset();
+
+	/**
+	 * @brief Print counts in human-readable form
+	 * @param out    Where to print
+	 * @param counts Counts to print, e.g. as returned by collect()
+	 * @param title  Heading of the printout, e.g. naming the engine used
+	 */
+	static void print(std::ostream& out,
+	                  const Counts& counts,
+	                  const std::string& title);
+};
+
+} // namespace fig
+
+
+#ifdef PERF_COUNTERS
+#  define FIG_PERF_COUNT(event) \
+	fig::PerfCounters::count(fig::PerfEvent::event)
+#  define FIG_PERF_COUNT_N(event, n) \
+	fig::PerfCounters::count(fig::PerfEvent::event, (n))
+#  define FIG_PERF_COUNT_AT(event, idx, n) \
+	fig::PerfCounters::count_at(fig::PerfEvent::event, (idx), (n))
+#else
+#  define FIG_PERF_COUNT(event)
+#  define FIG_PERF_COUNT_N(event, n)
+#  define FIG_PERF_COUNT_AT(event, idx, n)
+#endif
+
+#endif // PERFCOUNTERS_H
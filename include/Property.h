@@ -76,8 +76,7 @@ public:  // Ctors/Dtor
 	    type(thetype)
 	{}
 
-    // Copy/Move constructor deleted to avoid dealing with the unique id.
-    Property(const Property& that) = delete;
+    // Move constructor deleted to avoid dealing with the unique id.
     Property(Property&& that)      = delete;
 
     /// Can't have empty ctor due to const data members
@@ -89,6 +88,25 @@ public:  // Ctors/Dtor
 
 	inline virtual ~Property() {}
 
+protected:
+
+	/// Copy ctor, only for clone(): the copy is the same property
+	/// and thus keeps the unique id of 'that'
+	Property(const Property& that) :
+	    instance_id(that.instance_id),
+	    type(that.type)
+	{}
+
+public:  // Copies
+
+	/**
+	 * @brief Copy of this property with its own expression evaluators,
+	 *        e.g. to check it from several threads concurrently
+	 * @note The copy keeps the \ref get_id() "id" of this instance,
+	 *       and is prepared for the same global state
+	 */
+	virtual shared_ptr<Property> clone() const = 0;
+
 public:  // Utils
 
 	/// @brief Is this state considered "rare" for importance simulation?
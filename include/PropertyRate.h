@@ -78,9 +78,8 @@ public:  // Ctors
 	    condition_(expr)
 	{ /* Not much to do around here... */ }
 
-    /// Copy/Move constructor deleted to avoid dealing with the unique id.
-    PropertyRate(const PropertyRate& that) = delete;
-    PropertyRate(PropertyRate&& that)      = delete;
+    /// Move constructor deleted to avoid dealing with the unique id.
+    PropertyRate(PropertyRate&& that) = delete;
 
 	/// No empty ctor due to const data members from Property
 	PropertyRate()                                    = delete;
@@ -91,6 +90,16 @@ public:  // Ctors
 
 	inline ~PropertyRate() override {}
 
+private:
+
+	/// Copy ctor, only for clone()
+	PropertyRate(const PropertyRate& that) = default;
+
+public:  // Copies
+
+	inline shared_ptr<Property> clone() const override
+	    { return shared_ptr<Property>(new PropertyRate(*this)); }
+
 public:  // Utils
 
 	void prepare(const State<STATE_INTERNAL_TYPE>& state) override
@@ -92,9 +92,8 @@ public:  // Ctors
 		assert(tbound_low_ < tbound_upp_);
 	}
 
-	/// Copy/Move constructor deleted to avoid dealing with the unique id.
-	PropertyTBoundSS(const PropertyTBoundSS& that) = delete;
-	PropertyTBoundSS(PropertyTBoundSS&& that)      = delete;
+	/// Move constructor deleted to avoid dealing with the unique id.
+	PropertyTBoundSS(PropertyTBoundSS&& that) = delete;
 
 	/// No empty ctor due to const data members from Property
 	PropertyTBoundSS()                                        = delete;
@@ -105,6 +104,16 @@ public:  // Ctors
 
 	inline ~PropertyTBoundSS() override {}
 
+private:
+
+	/// Copy ctor, only for clone()
+	PropertyTBoundSS(const PropertyTBoundSS& that) = default;
+
+public:  // Copies
+
+	inline shared_ptr<Property> clone() const override
+	    { return shared_ptr<Property>(new PropertyTBoundSS(*this)); }
+
 public:  // Utils
 
 	inline void prepare(const State<STATE_INTERNAL_TYPE>& state) override
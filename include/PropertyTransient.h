@@ -86,10 +86,8 @@ public:  // Ctors/Dtor
 	    expr2_(expr2)
 	{ /* Not much to do around here... */ }
 
-
-	// Copy/Move constructor deleted to avoid dealing with the unique id.
-	PropertyTransient(const PropertyTransient& that) = delete;
-	PropertyTransient(PropertyTransient&& that)	  = delete;
+	/// Move constructor deleted to avoid dealing with the unique id.
+	PropertyTransient(PropertyTransient&& that) = delete;
 
 	/// No empty ctor due to const data members from Property
 	PropertyTransient()										 = delete;
@@ -100,6 +98,16 @@ public:  // Ctors/Dtor
 
 	inline ~PropertyTransient() override {}
 
+private:
+
+	/// Copy ctor, only for clone()
+	PropertyTransient(const PropertyTransient& that) = default;
+
+public:  // Copies
+
+	inline shared_ptr<Property> clone() const override
+	    { return shared_ptr<Property>(new PropertyTransient(*this)); }
+
 public:  // Utils
 
 	inline void prepare(const PositionsMap& globalVars) override
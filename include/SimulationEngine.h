@@ -35,9 +35,13 @@
 #include <array>
 #include <string>
 #include <memory>
+#include <vector>
+#include <utility>
+#include <functional>
 #include <ostream>
 // FIG
 #include <State.h>
+#include <CancellationToken.h>
 
 
 namespace fig
@@ -53,6 +57,7 @@ class ModuleNetwork;
 class Traial;
 class ConfidenceInterval;
 class ConfidenceIntervalRate;
+class ConfidenceIntervalRegenerative;
 class ConfidenceIntervalTransient;
 
 /**
@@ -71,7 +76,7 @@ public:
     /// Long story short: number of concrete derived classes.
     /// More in detail this is the size of the array returned by names(), i.e.
     /// how many SimualtionEngine implementations are offered to the end user.
-	static constexpr size_t NUM_NAMES = 10;
+	static constexpr size_t NUM_NAMES = 11;
 
 protected:  // Attributes for simulation update policies
 
@@ -96,6 +101,20 @@ protected:  // Attributes for simulation update policies
     /// @warning Value is arbitrary af
 	static constexpr long MAX_CPU_TIME = 8l;
 
+	/// Wall-clock time (seconds) each batch of simulations should last,
+	/// when the batch size isn't \ref batch_size() "user-defined".
+	/// Long enough to amortise the interval updates and the checks
+	/// of the stopping conditions, short enough to stop timely.
+	static constexpr double TARGET_BATCH_TIME = 0.25;
+
+	/// Largest batch size / run length chosen by tune_batch_size()
+	static constexpr size_t MAX_BATCH_SIZE = 1ul<<24ul;
+
+	/// Max number of jumps of a regeneration cycle, after which the initial
+	/// state is deemed absorbing or too rarely revisited to regenerate
+	/// @see regenerative_simulations()
+	static constexpr size_t MAX_CYCLE_STEPS = 1ul<<24ul;
+
 	/// @todo TODO delete deprecated code below
 //    /// Maximum simulation-time units any Traial is allowed to accumulate
 //    /// before having its lifetime reset
@@ -136,7 +155,9 @@ protected:
 	std::shared_ptr< const ImportanceFunctionConcrete > cImpFun_;
 
 	/// Were we just interrupted in an estimation timeout?
-	mutable bool interrupted;
+	/// @note Simulations poll it without reading the clock: deadlines
+	///       must be enforced by a Watchdog on this token
+	mutable CancellationToken interrupted;
 
 	/// The engine is intended to be used by a ThresholdsBuilder
 	const bool toBuildThresholds_;
@@ -156,6 +177,12 @@ public:
 	/// @see transient_event(), rate_event()
 	typedef std::function<bool(const Property&, Traial&, Event&)> EventWatcher;
 
+	/// Intervals fed with the same samples as the one passed to simulate()
+	typedef std::vector< std::shared_ptr< ConfidenceInterval > > FollowerCIs;
+
+	/// Invoked by simulate() after each batch, with the interval updated
+	typedef std::function<void(const ConfidenceInterval&)> BatchMonitor;
+
 protected:
 
 	/// How many Traials reached each threshold level in the last simulation
@@ -240,6 +267,29 @@ public:  // Accessors
 	/// @copydoc userDefinedBatchSize_
 	inline size_t batch_size() const noexcept { return userDefinedBatchSize_; }
 
+	/// Number of consecutive simulations per batch for transient-like
+	/// properties: the \ref batch_size() "user-defined" one if any,
+	/// or else a default tuned for this engine and importance function
+	/// @warning The engine must be \ref bound() "bound"
+	size_t transient_batch_size() const;
+
+	/**
+	 * @brief Batch size (or run length) to use next, according to the
+	 *        wall-clock time the last batch took
+	 *
+	 *        Aims at batches lasting TARGET_BATCH_TIME seconds, changing
+	 *        the size at most by a factor of two each time, and never going
+	 *        below \p minSize. If the batch size is \ref batch_size()
+	 *        "user-defined" it's returned unchanged.
+	 *
+	 * @param batchSize Size of the last batch
+	 * @param wallTime  Seconds the last batch took
+	 * @param minSize   Smallest batch size allowed
+	 */
+	size_t tune_batch_size(const size_t& batchSize,
+	                       const double& wallTime,
+	                       const size_t& minSize) const;
+
 	/// Names of the simulation engines offered to the user,
 	/// as he should requested them through the CLI/GUI.
 	/// @note Implements the <a href="https://goo.gl/yhTgLq"><i>Construct On
@@ -325,6 +375,31 @@ public:  // Simulation functions
      */
     void simulate(const Property& property, ConfidenceInterval& ci) const;
 
+	/**
+	 * @brief Run simulation in model feeding several intervals at once
+	 *
+	 *        Like simulate(const Property&, ConfidenceInterval&), but every
+	 *        sample that updates \p ci also updates each of the \p followers
+	 *        which isn't \ref ConfidenceInterval::is_valid() "valid" yet.
+	 *        Thus each follower freezes as soon as it meets its own
+	 *        confidence criterion, and the estimation finishes when either
+	 *        \p ci or all followers are valid (or on interruption).
+	 *
+	 * @param property  Property whose probability value is to be estimated
+	 * @param ci        ConfidenceInterval driving the estimation
+	 * @param followers Intervals of the same kind than \p ci to feed
+	 *                  with the same samples <b>(modified)</b>
+	 * @param monitor   <i>(Optional)</i> Called after each batch with \p ci
+	 *
+	 * @throw FigException if the engine isn't \ref bound() "bound" to any
+	 *                     ImportanceFunction, or if simulations are marked
+	 *                     \ref interrupted "interrupted" from the start
+	 */
+	void simulate(const Property& property,
+	              ConfidenceInterval& ci,
+	              const FollowerCIs& followers,
+	              const BatchMonitor& monitor = BatchMonitor()) const;
+
 protected:  // Simulation helper functions
 
 	/**
@@ -408,6 +483,62 @@ protected:  // Simulation helper functions
 	virtual double
 	tbound_ss_simulation(const PropertyTBoundSS& property) const = 0;
 
+	/**
+	 * @brief Perform regenerative simulations to estimate the value of a
+	 *        \ref PropertyRate "rate property"
+	 *
+	 *        Run 'numCycles' independent regeneration cycles: each cycle
+	 *        starts from the system's initial state and ends when the
+	 *        simulation returns to that state. For each cycle the amount of
+	 *        simulation-time spent on states satisfying "expr" is tracked
+	 *        together with the cycle's total simulation-time.
+	 *
+	 * @param property  PropertyRate with the event of interest (expr)
+	 * @param numCycles Number of regeneration cycles to simulate
+	 *
+	 * @return Pairs (simulation-time on rare states, cycle length) for each
+	 *         cycle completed, viz. less than 'numCycles' if the engine was
+	 *         \ref interrupted "interrupted"
+	 *
+	 * @note The initial state is a regeneration point only if returning
+	 *       to it renews all clocks, viz. for Markovian models: ModelSuite
+	 *       uses batch means for any other model.
+	 * @warning Implementations are currently <b>not thread-safe</b>.
+	 *
+	 * @throw FigException if the engine doesn't support regenerative simulation
+	 * @throw FigException if a cycle takes over MAX_CYCLE_STEPS jumps
+	 *
+	 * @see ConfidenceIntervalRegenerative
+	 */
+	virtual std::vector< std::pair< double, double > >
+	regenerative_simulations(const PropertyRate& property,
+	                         const size_t& numCycles) const;
+
+	/**
+	 * @brief Hook invoked by simulate() after each batch has been
+	 *        incorporated into the ConfidenceInterval
+	 *
+	 *        Engines may use the statistics gathered so far to tune
+	 *        their simulation parameters for the following batches.
+	 *        Each batch is then simulated with fixed parameters,
+	 *        and hence yields an unbiased estimate on its own.
+	 *
+	 * @note Default implementation does nothing
+	 */
+	virtual void end_of_batch() const {}
+
+	/**
+	 * @brief Hook invoked by ModelSuite before the estimation of \p property,
+	 *        outside of the wall-clock budget of its simulations
+	 *
+	 *        Engines whose simulation parameters must be tuned for each
+	 *        Property can do it here, so that the tuning doesn't eat up
+	 *        the time of the first batch.
+	 *
+	 * @note Default implementation does nothing
+	 */
+	virtual void prepare(const Property&) const {}
+
 protected:  // Traial observers/updaters
 
     /**
@@ -463,6 +594,23 @@ protected:  // Traial observers/updaters
 	 */
 	bool kill_time(const Property&, Traial& traial, Event&) const;
 
+protected:  // Telemetry
+
+	/// Report to the \ref Telemetry "telemetry stream" the start of the
+	/// estimation of \p property
+	/// @return Identifier of the estimation in the stream, if it's open
+	unsigned telemetry_start(const Property& property) const;
+
+	/// Report to the \ref Telemetry "telemetry stream" the last batch
+	/// incorporated into \p ci, and the simulations that reached each
+	/// threshold level so far if this engine \ref isplit() "splits"
+	/// @note Does nothing if the stream isn't open
+	void telemetry_batch(const unsigned& id, const ConfidenceInterval& ci) const;
+
+	/// Report to the \ref Telemetry "telemetry stream" the end of an estimation
+	/// @note Does nothing if the stream isn't open
+	void telemetry_end(const unsigned& id, const ConfidenceInterval& ci) const;
+
 private:  // Class utils
 
 	/**
@@ -486,16 +634,19 @@ private:  // Class utils
 	 * @param ci       ConfidenceInterval to update <b>(modified)</b>
 	 * @param rareTime Simulation-time units spent on rare states in the last simulation
 	 * @param simTime  Total simulation-time units spent in last simulation <b>(modified)</b>
+	 * @param wallTime Seconds the last simulation took
 	 *
-	 * @note Current policy discards the first "not-steady-state" trace
-	 *       (check source for details)
+	 * @note Current policy discards the first "not-steady-state" traces,
+	 *       increasing the run length after each one according to the
+	 *       wall-clock time it took (check source for details)
 	 * @note Simulations can be truncated by external updates to the
 	 *       \ref interrupted "interrupted flag": <b>nothing will be done
 	 *       if such flag is set</b>
 	 */
 	void rate_update(ConfidenceIntervalRate& ci,
 	                 const double& rareTime,
-	                 size_t& simTime) const;
+	                 size_t& simTime,
+	                 const double& wallTime) const;
 
 	/**
 	 * @brief Update the ConfidenceInterval and the simulation effort
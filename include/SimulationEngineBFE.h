@@ -107,12 +107,13 @@ private:  // Traial observers/updaters
 	inline bool
 	transient_event(const Property& property, Traial& traial, Event&) const override
 		{
-			const ImportanceValue newLvl = impFun_->level_of(traial.state);
+			const auto newStateInfo = impFun_->state_info(traial.state, property);
+			const ImportanceValue newLvl = UNMASK(newStateInfo);
 			traial.depth -= newLvl - traial.level;
 			traial.level = newLvl;
 			return /* level-up:   */ traial.depth < 0 ||
-				   /* rare event: */ property.is_rare(traial.state) ||
-				   /* stop event: */ property.is_stop(traial.state);
+				   /* rare event: */ IS_RARE_EVENT(newStateInfo) ||
+				   /* stop event: */ IS_STOP_EVENT(newStateInfo);
 		}
 
 	/// @todo TODO implement
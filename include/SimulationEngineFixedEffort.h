@@ -30,6 +30,7 @@
 #define SIMULATIONENGINEFIXEDEFFORT_H
 
 // C++
+#include <memory>
 #include <vector>
 #include <functional>
 // FIG
@@ -44,6 +45,7 @@ namespace fig
 {
 
 class PropertyRate;
+class ModelReplicas;
 
 /**
  * @brief Engine for Fixed Effort importance-splitting simulations
@@ -86,12 +88,46 @@ protected:
 	/// When the engine is intended for threshold building, this might be used
 	unsigned long arbitraryMaxLevel;
 
+	/// When the engine is intended for threshold building: whether
+	/// fixed_effort() should checkpoint the entry Traials of each level
+	/// @see resumeFromCheckpoint
+	bool keepCheckpoint;
+
+	/// When the engine is intended for threshold building: whether the next
+	/// fixed_effort() should pick up from the last level checkpointed,
+	/// instead of running afresh from the initial system state
+	/// @see keepCheckpoint
+	bool resumeFromCheckpoint;
+
+	/// Level checkpointed, i.e. the last one entered
+	mutable ImportanceValue checkpointLevel_;
+
+	/// Conditional probabilities estimated before the checkpointed level
+	mutable ThresholdsPathProb checkpointPath_;
+
+	/// Traials that entered the checkpointed level, which are never simulated:
+	/// the simulations of the level run on copies of them
+	mutable std::vector< Reference< Traial > > checkpointTraials_;
+
+	/// When the engine is intended for threshold building: mean cost of a
+	/// simulation launched from each level in the path of the last
+	/// fixed_effort() run, as (# of simulation steps, wall-clock seconds)
+	mutable std::vector< std::pair< double, double > > levelCost_;
+
+	/// Costs measured before the checkpointed level
+	/// @see levelCost_
+	mutable std::vector< std::pair< double, double > > checkpointCost_;
+
 	/// Stack of \ref Traial "traials" for a batch means mechanism
 	mutable std::vector< Reference< Traial > > traials_;
 
 	/// Property currently being estimated
 	mutable const Property* property_;
 
+	/// Copies of the model and property_ to run the simulations of each level
+	/// in parallel; built on demand, discarded if either of them changes
+	mutable std::shared_ptr< ModelReplicas > replicas_;
+
 public:
 
 	/// Default ctor
@@ -118,6 +154,18 @@ protected:  // Engine setup
 
 	void bind(std::shared_ptr< const ImportanceFunction >) override;
 
+	/// Overwrite the checkpoint with the Traials entering a new \p level,
+	/// and the path of level-up probabilities (and the \ref levelCost_
+	/// "costs") leading there. The Traials are moved, not copied:
+	/// \p entry is left empty
+	/// @see keepCheckpoint
+	void save_checkpoint(const ThresholdsPathProb& path,
+	                     const ImportanceValue& level,
+	                     std::vector< Reference< Traial > >& entry) const;
+
+	/// Discard the checkpoint, returning its Traials to the TraialPool
+	void clear_checkpoint() const;
+
 private:  // Simulation helper functions
 
 	std::vector<double>
@@ -156,12 +204,15 @@ protected:  // Utils for the class and its kin
 	 *        which states represent a stop/rare event.<br>
 	 *        When the uppermost threshold is reached (rare event boundary),
 	 *        or when there are no initial states to start the Traials from in
-	 *        the current step, computations stop.
+	 *        the current step, computations stop.<br>
+	 *        The simulations of a level are independent, and run in parallel
+	 *        whenever the \ref replicas_ "model copies" allow it.
 	 *
 	 * @param result     Array where the estimated conditional probabilities
 	 *                   of threshold-level-up will be stored.
 	 * @param watch_events Function determining when concludes a
-	 *                     \ref ModuleNetwork::simulation_step "simulation step"
+	 *                     \ref ModuleNetwork::simulation_step "simulation step",
+	 *                     which may be invoked concurrently
 	 *
 	 * @note What exactly is meant by <i>next</i> or <i>upper threshold level</i>
 	 *       depends on the class implementing this method
@@ -0,0 +1,233 @@
+//==============================================================================
+//
+//  SimulationEngineIS.h
+//
+//  Copyleft 2026-
+//  Authors:
+//  - The FIG contributors
+//
+//------------------------------------------------------------------------------
+//
+//  This file is part of FIG.
+//
+//  The Finite Improbability Generator (FIG) project is free software;
+//  you can redistribute it and/or modify it under the terms of the GNU
+//  General Public License as published by the Free Software Foundation;
+//  either version 3 of the License, or (at your option) any later version.
+//
+//  FIG is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with FIG; if not, write to the Free Software Foundation,
+//	Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//==============================================================================
+
+
+#ifndef SIMULATIONENGINEIS_H
+#define SIMULATIONENGINEIS_H
+
+// C++
+#include <tuple>
+#include <vector>
+#include <functional>
+#include <unordered_map>
+// FIG
+#include <SimulationEngine.h>
+#include <ModuleNetwork.h>
+#include <Property.h>
+#include <ImportanceFunction.h>
+
+
+namespace fig
+{
+
+class Clock;
+class PropertyRate;
+class PropertyTBoundSS;
+class PropertyTransient;
+
+/**
+ * @brief Engine for importance sampling simulations of Markovian models
+ *
+ *        This engine samples the \ref Clock "clocks" with exponential
+ *        distribution from <i>tilted</i> rates, which depend on the
+ *        threshold level where the Traial is when the clock is reset.
+ *        Each tilted sample multiplies the Traial's likelihood ratio,
+ *        kept in Traial::logWeight, so that weighing the observations by
+ *        it yields unbiased estimates in spite of the change of measure.<br>
+ *        The tilting is tuned with the multilevel cross-entropy method:
+ *        pilot simulations are run, the ones reaching the highest threshold
+ *        levels are kept, and the rates are moved to those which maximise
+ *        their weighed likelihood, until the rare event is reached often.
+ *        The importance function thus guides the tilting, and no splitting
+ *        is ever performed.
+ *
+ * @note Clocks with other (memoryless) distributions are sampled as usual
+ * @note Rate properties can only be estimated from regeneration cycles,
+ *       since the likelihood ratio of batch means grows without bound
+ *
+ * @see ModuleNetwork::is_markovian()
+ */
+class SimulationEngineIS : public SimulationEngine
+{
+public:
+
+	/// Number of pilot simulations in each iteration of the tuning
+	static constexpr size_t PILOT_RUNS = 1ul<<10ul;
+
+	/// Max number of iterations of the tuning
+	static constexpr unsigned MAX_PILOT_ITERATIONS = 20u;
+
+	/// Fraction of the pilot simulations kept (as the <i>elite</i>)
+	/// to tilt the rates in each iteration of the tuning
+	static constexpr double ELITE_FRACTION = 0.1;
+
+	/// Weight of the new rates w.r.t. the last ones in each tuning iteration
+	static constexpr double SMOOTHING = 0.7;
+
+	/// Max factor by which a rate can be tilted, either up or down
+	static constexpr double MAX_TILT = 1.0e3;
+
+private:
+
+	/// Tilted sample: threshold level, clock index in rates_, and value
+	typedef std::tuple< ImportanceValue, size_t, double > Sample;
+
+	/// Index in rates_ of each \ref Clock "clock" with exponential
+	/// distribution in the model
+	std::unordered_map< const Clock*, size_t > expClocks_;
+
+	/// Original rate of each clock with exponential distribution
+	std::vector< double > rates_;
+
+	/// Tilted rates of the clocks with exponential distribution,
+	/// for each threshold level of the importance function bound
+	mutable std::vector< std::vector< double > > tilts_;
+
+	/// Id of the Property the tilts_ were tuned for, zero if untuned
+	mutable int tunedFor_;
+
+	/// Threshold level of the model's initial state
+	mutable ImportanceValue initialLevel_;
+
+	/// Where to record the tilted samples of a pilot simulation, if any
+	mutable std::vector< Sample >* pilot_;
+
+public:  // Ctor
+
+	/// Data ctor
+	SimulationEngineIS(std::shared_ptr<const ModuleNetwork> model,
+	                   bool thresholds = false);
+
+	~SimulationEngineIS() override;
+
+public:  // Accessors
+
+	inline bool isplit() const noexcept override final { return false; }
+
+	inline unsigned global_effort_default() const noexcept override { return 1u; }
+
+	/// Tilted rates of the clocks with exponential distribution, for each
+	/// threshold level, as last tuned (or the original rates if untuned)
+	inline const std::vector< std::vector< double > >& tilts() const noexcept
+		{ return tilts_; }
+
+protected:  // Engine setup (by ModelSuite)
+
+	/// @copydoc SimulationEngine::bind()
+	/// @throw FigException if the model isn't Markovian
+	void bind(std::shared_ptr< const ImportanceFunction > ifun) override;
+
+	/// @copydoc SimulationEngine::prepare()
+	/// @note Tunes the tilting for \p property, unless already tuned for it
+	void prepare(const Property& property) const override;
+
+protected:  // Simulation helper functions
+
+	std::vector<double>
+	transient_simulations(const PropertyTransient& property,
+	                      const size_t& numRuns) const override;
+
+	/// @throw FigException always: batch means can't be used with
+	///                     importance sampling, use regeneration cycles
+	double rate_simulation(const PropertyRate& property,
+	                       const size_t& runLength,
+	                       bool reinit = false) const override;
+
+	/// @throw FigException always: not supported
+	double tbound_ss_simulation(const PropertyTBoundSS& property) const override;
+
+	/// @copydoc SimulationEngine::regenerative_simulations()
+	/// @note Both the reward and the length of each cycle
+	///       are weighed by the cycle's likelihood ratio
+	std::vector< std::pair< double, double > >
+	regenerative_simulations(const PropertyRate& property,
+	                         const size_t& numCycles) const override;
+
+private:  // Importance sampling utils
+
+	/**
+	 * @brief Tune the tilting for the estimation of \p property
+	 *
+	 *        Run the multilevel cross-entropy method with pilot simulations
+	 *        that end at a rare state or at a stop state of the \p property,
+	 *        or if \p cycles is true, when regenerating the initial state.
+	 *
+	 * @note Interrupting the engine stops the tuning,
+	 *       leaving the tilting of the last iteration completed
+	 */
+	void tune(const Property& property, bool cycles) const;
+
+	/// Sampler of the clocks reset by \p traial: sample_tilted() on it
+	Clock::Sampler tilted_sampler(Traial& traial) const;
+
+	/// Initialise \p traial in the model's initial state, sampling the
+	/// initial clocks with \p sample from the rates tilted for that state
+	void start(Traial& traial, const Clock::Sampler& sample) const;
+
+	/// Sample \p clock, from its tilted rate if it has exponential distribution,
+	/// updating the weight of the \p traial whose clock is being reset
+	CLOCK_INTERNAL_TYPE sample_tilted(const Clock& clock, Traial& traial) const;
+
+public:  // Traial observers/updaters
+
+	/// @copydoc SimulationEngine::transient_event()
+	/// @note Keeps the Traial level updated for the tilting
+	inline bool transient_event(const Property& property,
+	                            Traial& traial,
+	                            Event& e) const override
+		{
+			traial.level = impFun_->level_of(traial.state);
+			e = property.is_stop(traial.state) ? EventType::STOP
+			                                   : EventType::NONE;
+			if (property.is_rare(traial.state))
+				SET_RARE_EVENT(e);
+			return interrupted ||
+			(
+			    EventType::NONE != e
+			);
+		}
+
+	/// @copydoc SimulationEngine::rate_event()
+	/// @note Keeps the Traial level updated for the tilting
+	inline bool rate_event(const Property& property,
+	                       Traial& traial,
+	                       Event& e) const override
+		{
+			traial.level = impFun_->level_of(traial.state);
+			e = property.is_rare(traial.state) ? EventType::RARE
+			                                   : EventType::NONE;
+			return interrupted ||
+			(
+			    traial.lifeTime > simsLifetime || IS_RARE_EVENT(e)
+			);
+		}
+};
+
+} // namespace fig
+
+#endif // SIMULATIONENGINEIS_H
@@ -58,6 +58,15 @@ class SimulationEngineNosplit : public SimulationEngine
 	Traial& oTraial_;
 //	thread_local Traial& oTraial_;
 
+	/// Whether independent simulations come in pairs driven by
+	/// antithetic random numbers, each pair yielding one sample
+	bool antithetic_;
+
+	/// Whether each independent simulation uses its own RNG substream,
+	/// synchronising the random numbers across estimations (e.g. of
+	/// two variants of a model) for a sharper comparison
+	bool commonRandomNumbers_;
+
 public:  // Ctor
 
 	/// Data ctor
@@ -74,6 +83,12 @@ public:  // Accessors
 
 	inline unsigned global_effort_default() const noexcept override { return 1u; }
 
+	/// @copydoc antithetic_
+	inline bool antithetic() const noexcept { return antithetic_; }
+
+	/// @copydoc commonRandomNumbers_
+	inline bool common_random_numbers() const noexcept { return commonRandomNumbers_; }
+
 public:  // Engine setup
 
 //	void bind(...) override;  // We can hook up with any, no check needed
@@ -81,6 +96,54 @@ public:  // Engine setup
 //	/// Irrelevant for standard Monte Carlo
 //	void set_global_effort(unsigned) override {}
 
+	/**
+	 * @brief Choose the variance reduction applied to independent simulations,
+	 *        viz. those of transient properties (also when they share the
+	 *        simulations) and of regeneration cycles
+	 *
+	 * @param antithetic @copybrief antithetic_
+	 * @param crn        @copybrief commonRandomNumbers_
+	 *
+	 * @note Antithetic pairs also use common random numbers, since both
+	 *       simulations of a pair must be driven by the same substream
+	 * @note Each independent simulation re-seeds the RNG, which is cheapest
+	 *       for the "pcg64" RNG
+	 *
+	 * @throw FigException if the engine is currently \ref locked() "locked"
+	 */
+	void set_variance_reduction(bool antithetic, bool crn);
+
+public:  // Simulation functions
+
+	/**
+	 * @brief Estimate several transient properties from a single stream
+	 *        of standard Monte Carlo simulations
+	 *
+	 *        Each simulation is pushed forward until all the properties still
+	 *        being estimated have observed either their stop or their rare
+	 *        event, so every trace yields one sample per pending property.
+	 *        A property stops receiving samples as soon as its confidence
+	 *        interval is valid, and simulations end when all intervals are
+	 *        valid or the engine is \ref interrupted "interrupted".
+	 *
+	 * @param properties Transient properties to estimate
+	 * @param cis        ConfidenceIntervalTransient of each property
+	 *                   <i>(same order as 'properties')</i>
+	 * @param monitor    <i>(Optional)</i> Called after each batch with the
+	 *                   index of every property whose interval was updated
+	 *
+	 * @throw FigException if the engine isn't \ref bound() "bound"
+	 *                     or was called already interrupted
+	 * @note The importance function bound is only used to initialise the
+	 *       Traials: the properties are checked directly on each state
+	 * @note Antithetic pairs and common random numbers are used
+	 *       as \ref set_variance_reduction() "chosen for the engine"
+	 */
+	void simulate_shared(const std::vector< const PropertyTransient* >& properties,
+	                     const FollowerCIs& cis,
+	                     const std::function<void(const size_t&)>& monitor
+	                         = std::function<void(const size_t&)>()) const;
+
 protected:  // Simulation helper functions
 
 	std::vector<double>
@@ -93,6 +156,10 @@ protected:  // Simulation helper functions
 
 	double tbound_ss_simulation(const PropertyTBoundSS &property) const override;
 
+	std::vector< std::pair< double, double > >
+	regenerative_simulations(const PropertyRate& property,
+	                         const size_t& numCycles) const override;
+
 public:  // Traial observers/updaters
 
 	/// @copydoc SimulationEngine::transient_event()
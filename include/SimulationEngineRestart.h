@@ -29,6 +29,7 @@
 #ifndef SIMULATIONENGINERESTART_H
 #define SIMULATIONENGINERESTART_H
 
+#include <vector>
 #include <SimulationEngine.h>
 #include <core_typedefs.h>
 #include <Traial.h>
@@ -77,6 +78,31 @@ class SimulationEngineRestart : public SimulationEngine
 	/// For fp manipulations intended to reduce precision loss
 	mutable CLOCK_INTERNAL_TYPE currentSimLength_;
 
+	/// Whether the splitting of each threshold level is re-tuned online,
+	/// in between batches, from the level-up frequencies observed
+	bool retuneEffort_;
+
+	/// Splitting currently applied on each threshold level,
+	/// initially taken from the bound ImportanceFunction
+	mutable std::vector< unsigned long > effort_;
+
+	/// (Virtual) Traials that crossed each threshold level upwards
+	/// since the current ImportanceFunction was bound
+	mutable std::vector< double > levelUps_;
+
+	/// (Virtual) Traials that started a simulation on each threshold level,
+	/// i.e. the level-ups times the splitting performed there
+	mutable std::vector< double > levelStarts_;
+
+	/// Min number of Traials started on a threshold level
+	/// to consider its level-up frequency for effort re-tuning
+	static constexpr double MIN_RETUNE_SAMPLES = 256.0;
+
+	/// Max number of Traials alive at once during a simulation,
+	/// or zero for no limit
+	/// @see handle_lvl_up()
+	size_t maxTraials_;
+
 public:  // Ctor
 
 	/// Data ctor
@@ -97,6 +123,12 @@ public:  // Accessors
 	/// @copydoc dieOutDepth_
 	inline const decltype(dieOutDepth_)& die_out_depth() const noexcept { return dieOutDepth_; }
 
+	/// @copydoc retuneEffort_
+	inline bool effort_retuning() const noexcept { return retuneEffort_; }
+
+	/// @copydoc maxTraials_
+	inline size_t max_traials() const noexcept { return maxTraials_; }
+
 public:  // Engine setup
 
 	/// @copydoc SimulationEngine::bind()
@@ -109,15 +141,57 @@ public:  // Engine setup
 	/// @throw FigException if the engine was \ref lock() "locked"
 	void set_die_out_depth(unsigned dieOutDepth);
 
+	/// @see effort_retuning()
+	/// @throw FigException if the engine was \ref lock() "locked"
+	void set_effort_retuning(bool retune);
+
+	/// @see max_traials()
+	/// @throw FigException if the value is invalid, viz. 1: the main Traial
+	///                     of batch means must always have room for a copy
+	/// @throw FigException if the engine was \ref lock() "locked"
+	void set_max_traials(size_t maxTraials);
+
 private:  // Simulation helper functions
 
+	/// Splitting to perform on threshold level \p lvl,
+	/// as currently (re-)tuned by this engine
+	inline unsigned long effort_of(const ImportanceValue& lvl) const
+		{ assert(lvl < effort_.size()); return effort_[lvl]; }
+
+	/// Take the splitting of every threshold level from the bound
+	/// ImportanceFunction if not done yet, and reset the level-up statistics
+	void init_effort() const;
+
+	/**
+	 * @brief Re-balance the splitting of the threshold levels
+	 *
+	 *        Following the <i>balanced growth</i> criterion the splitting
+	 *        of level 'l' is tuned to the inverse of the probability of
+	 *        reaching level 'l+1' from 'l', as observed in all simulations
+	 *        run since the engine was bound.
+	 *        As safeguards, only levels where enough Traials were started
+	 *        are considered, and their splitting can at most halve or double
+	 *        per batch, staying within [2, ThresholdsBuilder::MAX_EFFORT].
+	 *
+	 * @note Only has effect when effort_retuning() is on
+	 * @note Runs in between batches, so that every batch is simulated
+	 *       with a fixed splitting and its estimate remains unbiased
+	 * @note When the effort changes, the retrials kept for batch means
+	 *       (rate properties) are discarded: they were split with the
+	 *       previous effort. The next batch continues from the main Traial.
+	 */
+	void end_of_batch() const override;
+
 	/// Do a clean in the \ref ssstack_ "internal ADT" used for batch means,
 	/// forcing the next simulation to be <i>fresh</i>.
 	void reinit_stack() const;
 
 	/// Fill \a stack with clones of \a traial due to level-up splitting
 	/// @note Can handle several-levels-up situations
-	void handle_lvl_up(const Traial &traial,
+	/// @note If the clones would exceed max_traials() then fewer are made,
+	///       and their Traial::logWeight compensates for the missing ones.
+	///       With no room left at all, \a traial itself carries that weight.
+	void handle_lvl_up(Traial &traial,
 					   TraialPool& tpool,
 					   std::stack< Reference< Traial > >& stack) const;
 
@@ -150,7 +224,8 @@ private:  // Simulation helper functions
 private:  // Traial observers/updaters
 
 	/// @copydoc SimulationEngine::transient_event()
-	/// @note Makes no assumption about the ImportanceFunction altogether
+	/// @note Makes no assumption about the ImportanceFunction altogether:
+	///       level and events come from ImportanceFunction::state_info()
 	/// @note Attempted inline in a desperate need for speed
 	inline bool transient_event(const Property& property,
 								Traial& traial,
@@ -158,20 +233,18 @@ private:  // Traial observers/updaters
 		{
 			// Event marking is done in accordance with the checks performed
 			// in the transient_simulations() overriden member function
-		    e = EventType::NONE;
-			if (property.is_stop(traial.state)) {
-				e = EventType::STOP;
-			} else {
-				const auto newThrLvl = static_cast<long>(impFun_->level_of(traial.state));
+			const auto newStateInfo = impFun_->state_info(traial.state, property);
+			e = MASK(newStateInfo);
+			if (!IS_STOP_EVENT(e)) {
+				const auto newThrLvl = static_cast<long>(UNMASK(newStateInfo));
 				traial.numLevelsCrossed = static_cast<int>(newThrLvl - static_cast<long>(traial.level));
 				traial.depth -= traial.numLevelsCrossed;
 				traial.level = static_cast<decltype(traial.level)>(newThrLvl);
 				if (traial.numLevelsCrossed < 0 && traial.depth > dieOutDepth_)
-					e = EventType::THR_DOWN;
+					SET_THR_DOWN_EVENT(e);
 				else if (traial.numLevelsCrossed > 0 && traial.depth < 0)
-					e = EventType::THR_UP;
-				else if (property.is_rare(traial.state))
-					e = EventType::RARE;
+					SET_THR_UP_EVENT(e);
+				// else: rare event info is already marked inside 'e'
 			}
 			return interrupted ||
 			(
@@ -209,38 +282,39 @@ private:  // Traial observers/updaters
 	    }
 
 	/// @copydoc SimulationEngine::rate_event()
-	/// @note Makes no assumption about the ImportanceFunction altogether
+	/// @note Makes no assumption about the ImportanceFunction altogether:
+	///       level and events come from ImportanceFunction::state_info()
 	inline bool rate_event(const Property& property,
 						   Traial& traial,
 						   Event& e) const override
 		{
 			// Event marking is done in accordance with the checks performed
 			// in the rate_simulation() overriden member function
-		    e = EventType::NONE;
-			const auto newThrLvl = static_cast<long>(impFun_->level_of(traial.state));
+			const auto newStateInfo = impFun_->state_info(traial.state, property);
+			e = MASK(newStateInfo);
+			const auto newThrLvl = static_cast<long>(UNMASK(newStateInfo));
 			traial.numLevelsCrossed = static_cast<int>(newThrLvl - static_cast<long>(traial.level));
 			traial.depth -= traial.numLevelsCrossed;
 			traial.level = static_cast<decltype(traial.level)>(newThrLvl);
 			if (0 < traial.numLevelsCrossed &&
 			        traial.nextSplitLevel <= static_cast<int>(traial.level)) {
-					e = EventType::THR_UP;  // event B_i
+					SET_THR_UP_EVENT(e);  // event B_i
 					traial.nextSplitLevel = static_cast<int>(traial.level) + 1;
 			} else if (traial.numLevelsCrossed < 0) {
 				if (traial.level == impFun_->min_value()) {
 					if (traial.depth > 0)
-						e = EventType::THR_DOWN;  // retrials that reach "threshold 0" die
+						SET_THR_DOWN_EVENT(e);  // retrials that reach "threshold 0" die
 					else
 						traial.nextSplitLevel = 1;  // the original traial instead gets reborn
 				} else if (traial.depth > die_out_depth()) {
-					e = EventType::THR_DOWN;  // D_i-j event in traial [B_i,D_i-j) of RESTART-Pj
+					SET_THR_DOWN_EVENT(e);  // D_i-j event in traial [B_i,D_i-j) of RESTART-Pj
 				} else {
 					traial.nextSplitLevel =  // can generate new events B_k
 					        std::min(traial.nextSplitLevel,
 					                 static_cast<int>(traial.level)+die_out_depth()+1);
 				}
-			} else if (property.is_rare(traial.state)) {
-				e = EventType::RARE;
 			}
+			// else: rare event info is already marked inside 'e'
 			return interrupted ||
 			(
 			    traial.lifeTime > simsLifetime || EventType::NONE != e
@@ -90,6 +90,8 @@ protected:  // Utils for the class and its kin
 	/// @note If no path is found to the rare event, \p result
 	///	   will contain a single path whose last element.second == 0.0,
 	///	   meaning there is zero probability to reach further up
+	/// @note When building thresholds the run can be checkpointed and resumed,
+	///	   see SimulationEngineFixedEffort::keepCheckpoint
 	void fixed_effort(ThresholdsPathCandidates& result,
 	                  const EventWatcher& watch_events) const override;
 
@@ -100,14 +102,15 @@ private:  // Traial observers/updaters
 	inline bool
 	transient_event(const Property& property, Traial& traial, Event&) const override
 		{
-			const ImportanceValue newLvl = impFun_->level_of(traial.state);
+			const auto newStateInfo = impFun_->state_info(traial.state, property);
+			const ImportanceValue newLvl = UNMASK(newStateInfo);
 			traial.depth -= newLvl - traial.level;
 			traial.level = newLvl;
 			return interrupted ||
 			(
 			    /* level-up:   */  traial.depth < 0 ||
-			    /* rare event: */  property.is_rare(traial.state) ||
-			    /* stop event: */  property.is_stop(traial.state)
+			    /* rare event: */  IS_RARE_EVENT(newStateInfo) ||
+			    /* stop event: */  IS_STOP_EVENT(newStateInfo)
 			);
 		}
 
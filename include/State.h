@@ -349,6 +349,17 @@ public:  // Encode/Decode between symbolic and concrete representations
 	 */
 	size_t encode() const;
 
+	/**
+	 * @brief Encode the valuation \p s as a number, i.e. as encode() would
+	 *        after copying \p s into our variables, but leaving these intact.
+	 *        Thus this can be invoked concurrently.
+	 * @note <b>Complexity:</b> <i>O(size()<sup>2</sup>)</i>
+	 * \ifnot NDEBUG
+	 *   @throw FigException if \p s has an invalid value for some Variable
+	 * \endif
+	 */
+	size_t encode(const StateInstance& s) const;
+
 	/**
 	 * @brief Decode \a n as vector of Variables values and apply to self,
 	 *        i.e. store <i>symbolically</i> the <i>concrete state</i> \a n.
@@ -0,0 +1,270 @@
+//==============================================================================
+//
+//  Telemetry.h
+//
+//  Copyleft 2026-
+//  Authors:
+//  - The FIG contributors
+//
+//------------------------------------------------------------------------------
+//
+//  This file is part of FIG.
+//
+//  The Finite Improbability Generator (FIG) project is free software;
+//  you can redistribute it and/or modify it under the terms of the GNU
+//  General Public License as published by the Free Software Foundation;
+//  either version 3 of the License, or (at your option) any later version.
+//
+//  FIG is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with FIG; if not, write to the Free Software Foundation,
+//	Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//==============================================================================
+
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+// C++
+#include <mutex>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <ostream>
+#include <utility>        // std::pair<>
+#include <unordered_map>
+#include <condition_variable>
+
+
+namespace fig
+{
+
+class ConfidenceInterval;
+
+/**
+ * @brief Fixed-size entry of the telemetry stream
+ *
+ *        Records are filled in by the simulations' thread and formatted
+ *        by the telemetry writer thread. They hold no dynamic memory,
+ *        so buffering them involves no allocations.
+ */
+struct TelemetryRecord
+{
+	/// What happened
+	enum Kind : char
+	{
+		START = 0,  ///< Estimation launched, 'label' describes it
+		BATCH,      ///< Batch of simulations incorporated into the estimate
+		LEVEL,      ///< Simulations reaching a threshold level so far
+		END         ///< Estimation finished
+	} kind;
+
+	/// Estimation this record belongs to
+	unsigned estimation;
+
+	/// Seconds since the telemetry stream was opened
+	double time;
+
+	/// Samples in the estimation's interval
+	long samples;
+
+	/// Point estimate, variance, and half-width of the interval
+	double estimate, variance, halfWidth;
+
+	/// Simulation steps performed by the model so far
+	unsigned long steps;
+
+	/// Traials in use and created by the TraialPool
+	unsigned long traialsAlive, poolSize;
+
+	/// Threshold level and number of simulations that reached it
+	unsigned level;
+	unsigned long reachCount;
+
+	/// Description of the estimation (START records only)
+	char label[96];
+};
+
+
+/**
+ * @brief Machine-readable stream of estimation events
+ *
+ *        Offers the progress of estimations (per-batch samples, estimate,
+ *        variance and half-width, simulation steps per second, Traials
+ *        alive and pool size, simulations reaching each threshold level,
+ *        and resident memory) as JSON lines or CSV rows, to a file or to
+ *        a standard stream.
+ *
+ *        The simulations' thread only copies fixed-size records into a
+ *        lock-free single-producer/single-consumer ring buffer; a background
+ *        thread formats and writes them every FLUSH_PERIOD. Records are
+ *        dropped rather than blocking the simulations if the buffer fills up.
+ *        When the stream isn't open every report is a single relaxed load.
+ *
+ * @note Records must be produced from a single thread at a time
+ * @note Follows the singleton design pattern, like the TraialPool
+ */
+class Telemetry
+{
+public:
+
+	/// Output formats available
+	enum class Format { JSON, CSV };
+
+	/// Number of records buffered for the writer thread
+	static constexpr size_t BUFFER_SIZE = 1ul<<12ul;
+
+	/// Time the writer thread sleeps in between flushes
+	static constexpr std::chrono::milliseconds FLUSH_PERIOD
+	    = std::chrono::milliseconds(100);
+
+private:
+
+	typedef std::chrono::steady_clock Clock;
+
+	/// Whether the stream is open and reports should be recorded
+	static std::atomic< bool > enabled_;
+
+	/// Output file, if the stream isn't a standard one
+	std::unique_ptr< std::ostream > file_;
+
+	/// Where the records are written
+	std::ostream* out_;
+
+	/// How the records are written
+	Format format_;
+
+	/// Lock-free ring buffer between the simulations and the writer thread
+	std::unique_ptr< std::array< TelemetryRecord, BUFFER_SIZE > > buffer_;
+
+	/// Next slot to write into (owned by the producer)
+	std::atomic< size_t > head_;
+
+	/// Next slot to read from (owned by the writer thread)
+	std::atomic< size_t > tail_;
+
+	/// Records lost because the buffer was full
+	std::atomic< unsigned long > dropped_;
+
+	/// Identifier of the next estimation started
+	unsigned nextEstimation_;
+
+	/// Time origin of the stream
+	Clock::time_point origin_;
+
+	/// Writer thread
+	std::thread writer_;
+
+	/// Guards 'stop_'
+	std::mutex mutex_;
+
+	/// Used to wake up the writer thread on close()
+	std::condition_variable wakeUp_;
+
+	/// Should the writer thread finish?
+	bool stop_;
+
+	/// Steps and time of the last record written for each estimation
+	/// @note Accessed by the writer thread only
+	std::unordered_map< unsigned, std::pair< unsigned long, double > > last_;
+
+	/// Private ctor (singleton design pattern)
+	Telemetry();
+
+public:  // Access to the Telemetry instance
+
+	/// Global access point to the unique instance of the telemetry stream
+	static Telemetry& get_instance();
+
+	/// Close the stream on destruction
+	~Telemetry();
+
+	Telemetry(const Telemetry&) = delete;
+	Telemetry& operator=(const Telemetry&) = delete;
+
+public:  // Accessors
+
+	/// Is the telemetry stream open?
+	static inline bool enabled() noexcept
+	    { return enabled_.load(std::memory_order_relaxed); }
+
+	/// @copydoc dropped_
+	inline unsigned long dropped() const noexcept { return dropped_; }
+
+public:  // Stream handling
+
+	/**
+	 * @brief Start writing telemetry records
+	 * @param target "stdout", "stderr", or the path of the file to write
+	 * @param format How to write the records
+	 * @throw FigException if the file can't be opened
+	 * @note Closes any previously opened stream
+	 */
+	void open(const std::string& target, Format format = Format::JSON);
+
+	/// Write all pending records and stop the writer thread
+	void close();
+
+public:  // Reports
+
+	/**
+	 * @brief Record the start of an estimation
+	 * @param label Description of the estimation
+	 * @param steps Simulation steps performed by the model so far
+	 * @return Identifier of the estimation for later reports
+	 */
+	unsigned start(const std::string& label, const unsigned long& steps);
+
+	/**
+	 * @brief Record a batch of simulations incorporated into an interval
+	 * @param estimation Identifier returned by start()
+	 * @param ci         Interval updated with the batch
+	 * @param steps      Simulation steps performed by the model so far
+	 */
+	void batch(const unsigned& estimation,
+	           const ConfidenceInterval& ci,
+	           const unsigned long& steps);
+
+	/// Record how many simulations of an estimation reached a threshold level
+	void level(const unsigned& estimation,
+	           const unsigned& level,
+	           const unsigned long& reachCount);
+
+	/// Record the end of an estimation, with the final state of its interval
+	/// and the simulation steps performed by the model so far
+	void end(const unsigned& estimation,
+	         const ConfidenceInterval& ci,
+	         const unsigned long& steps);
+
+private:  // Class utils
+
+	/// Record of given kind stamped with the current time and pool sizes
+	TelemetryRecord new_record(const TelemetryRecord::Kind& kind,
+	                           const unsigned& estimation) const;
+
+	/// Enqueue a record for the writer thread, or drop it if there's no room
+	void push(const TelemetryRecord& record);
+
+	/// Write all records available in the buffer
+	/// @note Called by the writer thread only
+	void flush();
+
+	/// Write a single record in the chosen format,
+	/// with \p rss the resident memory of the process in kB
+	void write(const TelemetryRecord& record, const unsigned long& rss);
+
+	/// Seconds elapsed since the stream was opened
+	double now() const;
+};
+
+} // namespace fig
+
+#endif // TELEMETRY_H
@@ -46,6 +46,12 @@ namespace fig
  *        simulation run traversing the i-th level upwards, that is, going up
  *        the i-th importance threshold having started at the (i-1)-th threshold.
  *
+ * @note Only the selection of the importance quantile of each iteration
+ *       runs in parallel (see ThresholdsBuilderAdaptive::select_quantile()).
+ *       The simulations are run one after the other: they share the
+ *       ModuleNetwork and the ImportanceFunction, whose expression
+ *       evaluators and state copies are not thread safe.
+ *
  * @see ThresholdsBuilderAdaptiveSimple
  * @see ThresholdsBuilderSMC
  */
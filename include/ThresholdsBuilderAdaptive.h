@@ -34,6 +34,7 @@
 // FIG
 #include <ThresholdsBuilder.h>
 #include <core_typedefs.h>
+#include <CancellationToken.h>
 
 
 namespace fig
@@ -81,8 +82,24 @@ protected:
 	/// and the effort to perform on each ("threshold-") level
 	ThresholdsVec thresholds_;
 
-	/// Allow derived classes to halt computations via parallel threads
-	bool halted_;
+	/// Allow derived classes to halt computations via parallel threads,
+	/// or by imposing a deadline checked in between simulations
+	CancellationToken halted_;
+
+	/// Lower ImportanceValue of each level built in the last run
+	ImportanceVec lastLevels_;
+
+	/// Probability of going from each level built in the last run to the
+	/// next one, or zero if unknown
+	std::vector< double > lastPup_;
+
+	/// Levels to warm start from, given as in lastLevels_
+	/// @see set_prior()
+	ImportanceVec priorLevels_;
+
+	/// Level-up probabilities to warm start from, given as in lastPup_
+	/// @see set_prior()
+	std::vector< double > priorPup_;
 
 public:
 
@@ -101,6 +118,63 @@ public:
 	/// @copydoc MAX_N
 	static inline unsigned max_n() noexcept { return MAX_N; }
 
+	/// @copydoc lastLevels_
+	inline const ImportanceVec& last_levels() const noexcept { return lastLevels_; }
+
+	/// @copydoc lastPup_
+	inline const std::vector< double >& last_level_up_probs() const noexcept { return lastPup_; }
+
+	/**
+	 * @brief Warm start the next build_thresholds() from a previous run
+	 *
+	 *        Instead of selecting thresholds from scratch, the next calls to
+	 *        build_thresholds() will refine the given levels, using the
+	 *        level-up probabilities observed for them.
+	 *        Typically these come from last_levels() and last_level_up_probs()
+	 *        after thresholds were built for the same property and
+	 *        ImportanceFunction, e.g. for a different global effort.
+	 *
+	 * @param levels Lower ImportanceValue of each level, in increasing order
+	 * @param Pup    Probability of going from each level to the next one,
+	 *               or zero if unknown
+	 *
+	 * @throw FigException if the sizes of \p levels and \p Pup differ
+	 * @see clear_prior()
+	 */
+	void set_prior(const ImportanceVec& levels, const std::vector< double >& Pup);
+
+	/// Forget about any previous run: build the next thresholds from scratch
+	/// @see set_prior()
+	void clear_prior() noexcept;
+
+	/// Whether the next build_thresholds() will warm start from a previous run
+	/// @see set_prior()
+	inline bool has_prior() const noexcept { return !priorLevels_.empty(); }
+
+	/**
+	 * @brief Select the Traial with the n-th lowest importance
+	 *
+	 *        Rearrange the range [first,last) so that the Traial pointed to
+	 *        by 'nth' is the one that would be there if the range were sorted
+	 *        by importance, all Traials before it have lower or equal
+	 *        importance, and all after it higher or equal importance.
+	 *        Runs in linear time, using all available threads if the STL
+	 *        offers a parallel version of the algorithm.
+	 *
+	 * @param first Beginning of the range of Traials <b>(modified)</b>
+	 * @param nth   Position of the quantile to select
+	 * @param last  End of the range of Traials
+	 */
+	static void select_quantile(TraialsVec::iterator first,
+	                            TraialsVec::iterator nth,
+	                            TraialsVec::iterator last);
+
+	/// Fraction of the Traials in the range [first,last) whose importance
+	/// is at least \p imp, e.g. those which went up to a threshold \p imp
+	static double fraction_reached(TraialsVec::const_iterator first,
+	                               TraialsVec::const_iterator last,
+	                               const ImportanceValue& imp);
+
 protected:  // Utils for the class and its kin
 
 	/**
@@ -127,6 +201,33 @@ protected:  // Utils for the class and its kin
 	get_traials(const unsigned& numTraials,
 	            const fig::ImportanceFunction& impFun,
 	            bool initialise = true) const;
+
+	/**
+	 * @brief Select thresholds from the \ref set_prior() "prior levels"
+	 *
+	 *        Assuming the probability of level-up decays uniformly with the
+	 *        importance within each prior level, place the thresholds where
+	 *        the probability of reaching them from the previous threshold
+	 *        is (approximately) \p pUp.
+	 *
+	 * @param impFun     ImportanceFunction for which thresholds are selected
+	 * @param pUp        Target probability of level-up, in (0.0, 1.0)
+	 * @param thresholds Initial importance followed by the thresholds selected
+	 *                   <b>(modified)</b>
+	 *
+	 * @return Whether the prior covers all the way up to its topmost level;
+	 *         if not then \p thresholds only reaches as far as the prior
+	 *         level-up probabilities are known
+	 */
+	bool thresholds_from_prior(const ImportanceFunction& impFun,
+	                           const double& pUp,
+	                           ImportanceVec& thresholds) const;
+
+	/// Record the \p thresholds just built as last_levels(), whose
+	/// last_level_up_probs() are the fractions \p pUp measured for the
+	/// lowest levels, and unknown for the levels above those
+	void record_levels(const ImportanceVec& thresholds,
+	                   const std::vector< double >& pUp);
 };
 
 } // namespace fig
@@ -72,6 +72,10 @@ protected:
 	/// @note Intentionally obscures ThresholdsBuilderAdaptive::thresholds_
 	ImportanceVec thresholds_;
 
+	/// Fraction of the simulations which went up from each level in
+	/// thresholds_ to the next one, as measured while building them
+	std::vector< double > levelUpFracs_;
+
 public:
 
 	/// Data & default ctor
@@ -117,6 +121,28 @@ protected:  // Utils for the class and its kin
 	virtual void
 	build_thresholds_vector(const ImportanceFunction& impFun) = 0;
 
+	/**
+	 * @brief Validate and refine thresholds selected from the prior levels
+	 *
+	 *        Run a short pilot of ThresholdsBuilderAdaptive::MIN_N
+	 *        simulations through \p thresholds, splitting the ones that
+	 *        reach each threshold to replace the ones that don't, and
+	 *        store in levelUpFracs_ the fraction that went up each level.
+	 *        Consecutive levels that together turn out no rarer than
+	 *        \p pUp are then merged into a single level.
+	 *
+	 * @param impFun     ImportanceFunction for which thresholds were selected
+	 * @param pUp        Target probability of level-up, in (0.0, 1.0)
+	 * @param thresholds Initial importance followed by the thresholds selected,
+	 *                   as given by thresholds_from_prior() <b>(modified)</b>
+	 *
+	 * @return Whether the pilot made it to the max importance of \p impFun;
+	 *         if not then \p thresholds is cut at the highest one reached
+	 */
+	bool pilot_thresholds(const ImportanceFunction& impFun,
+	                      const double& pUp,
+	                      ImportanceVec& thresholds);
+
 	/// Choose values for n_ and k_, following Garvels' <i>balanced growth</i>
 	/// @copydetails ThresholdsBuilderAdaptive::tune()
 	void
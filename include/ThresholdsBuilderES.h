@@ -74,6 +74,11 @@ class ThresholdsBuilderES : public ThresholdsBuilderAdaptive
 	/// Max # steps allowed for each internal Fixed Effort pilot run
 	static constexpr decltype(Traial::numLevelsCrossed) MAX_SIM_LEN = (1ul)<<(10ul);
 
+public:
+
+	/// Max factor by which cost-awareness can change the effort of a level
+	static constexpr float MAX_COST_RESCALE = 4.0f;
+
 protected:
 
 	/// #(FE-sims) launched per iteration of the internal Fixed Effort
@@ -101,6 +106,15 @@ protected:
 	/// storing the thresholds currently under consideration
 	mutable ThresholdsVec currentThresholds_;
 
+	/// Whether efforts are chosen to minimise variance per CPU time,
+	/// rather than per simulation launched
+	bool costAware_;
+
+	/// Mean cost of a simulation launched from each level of the
+	/// \ref currentThresholds_ "current thresholds", measured during the
+	/// internal Fixed Effort runs (0.0 where unmeasured)
+	std::vector< double > levelCost_;
+
 public:
 
 	/// Data & default ctor
@@ -110,6 +124,23 @@ public:
 
 	bool uses_global_effort() const noexcept override final { return false; }
 
+	/// @copydoc costAware_
+	inline bool cost_aware() const noexcept { return costAware_; }
+
+	/**
+	 * @brief Make the efforts account for the cost of simulating each level
+	 *
+	 *        The effort chosen from the level-up probabilities is rescaled by
+	 *        the inverse square root of the mean cost of a simulation in each
+	 *        level, as measured by the internal Fixed Effort runs. This is the
+	 *        allocation minimising the variance for a fixed amount of work
+	 *        (rather than for a fixed number of simulations) and keeps the
+	 *        total expected work of the original allocation.
+	 *
+	 * @param costAware Whether to rescale efforts by the cost of each level
+	 */
+	inline void set_cost_aware(bool costAware) noexcept { costAware_ = costAware; }
+
 	/// Register the Property being estimated, which may affect
 	/// the internal Fixed Effort runs of the thresholds selection algorithm.
 	void
@@ -118,6 +149,24 @@ public:
 	ThresholdsVec
 	build_thresholds(std::shared_ptr<const ImportanceFunction>) override;
 
+	/**
+	 * @brief Rescale efforts to minimise variance per unit of work
+	 *
+	 *        Multiply each effort by the inverse square root of its level's
+	 *        cost, normalising so that the total expected work stays the
+	 *        same. Changes are bounded to a factor of MAX_COST_RESCALE
+	 *        either way, to shield from noisy measurements.
+	 *
+	 * @param effort    Efforts chosen per level <b>(modified)</b>
+	 * @param levelCost Mean cost of a simulation launched from each level
+	 *                  (0.0 where unmeasured)
+	 *
+	 * @note Levels without splitting are left untouched
+	 * @see set_cost_aware()
+	 */
+	static void cost_aware_effort(std::vector< float >& effort,
+	                              const std::vector< double >& levelCost);
+
 private:  // Class utils
 
 	/**
@@ -145,6 +194,9 @@ private:  // Class utils
 	 *        by the \p reachableImportanceValues.
 	 *
 	 * @param reachableImportanceValues Result from reachable_importance_values()
+	 * @param warm Whether \p reachableImportanceValues are the levels of a
+	 *             \ref set_prior() "previous run", whose level-up probabilities
+	 *             spare the search of paths to the rare event
 	 *
 	 * @return Probabilities of going from each reachable importance value to the next
 	 *
@@ -157,7 +209,7 @@ private:  // Class utils
 	 * @warning Hardcoded to work with SimulationEngineSFE as internalSimulator_
 	 */
 	std::vector<float>
-	FE_for_ES(const ImportanceVec& reachableImportanceValues);
+	FE_for_ES(const ImportanceVec& reachableImportanceValues, bool warm = false);
 
 	/**
 	 * @brief Selection/deletion of artificially chosen thresholds
@@ -32,6 +32,7 @@
 
 // C++
 #include <string>
+#include <deque>
 #include <vector>
 #include <memory>     // std::shared_ptr<>
 #include <algorithm>  // std::swap(), std::find()
@@ -42,6 +43,7 @@
 #include <FigLog.h>
 #include <State.h>
 #include <Clock.h>
+#include <PerfCounters.h>
 
 #if __cplusplus < 201103L
 #  error "C++11 standard required, please compile with -std=c++11\n"
@@ -70,7 +72,7 @@ class Traial
 	friend class TraialPool;  // to instantiate (ctor)
 
 	/// @todo TODO maybe remove following and use copy elision in TraialPool::ensure_resources()?
-	friend class std::vector< Traial >;
+	friend class std::deque< Traial >;
 	friend class __gnu_cxx::new_allocator<Traial>;
 
 public:
@@ -112,6 +114,12 @@ public:  // Attributes
 	/// Time span this Traial has been running around the system model
 	CLOCK_INTERNAL_TYPE lifeTime;
 
+	/// Logarithm of the weight accumulated along the path, viz. the
+	/// likelihood ratio of importance sampling, or the compensation for
+	/// the retrials not split by RESTART under a memory budget
+	/// @note Zero (i.e. weight 1.0) for plain simulations
+	double logWeight;
+
 	/// \ref Variable "Variables" values instantiation
 	/// (same order as in the system global state)
 	StateInstance state;
@@ -188,10 +196,12 @@ public:  // Copy/Assign/Dtor
 			depth            = that.depth;
 			numLevelsCrossed = that.numLevelsCrossed;
 			lifeTime         = that.lifeTime;
+			logWeight        = that.logWeight;
 			state            = that.state;
 			clocks_          = that.clocks_;
 			orderedIndex_    = that.orderedIndex_;
 			nextClock_       = that.nextClock_;
+			FIG_PERF_COUNT(TRAIAL_COPY);
 			return *this;
 	    }
 
@@ -234,6 +244,7 @@ public:  // Utils
 	 *
 	 * @param network ModuleNetwork already sealed
 	 * @param impFun  ImportanceFunction currently on use for simulations
+	 * @param sample  How to sample the initial clocks, e.g. a Clock::Sampler
 	 *
 	 * @return Reference to self
 	 *
@@ -242,9 +253,11 @@ public:  // Utils
 	 *                       or the ImportanceFunction has no importance info
 	 * \endif
 	 */
+	template< class Sampler = SampleClock >
 	Traial&
 	initialise(const ModuleNetwork& network,
-	           const ImportanceFunction& impFun);
+	           const ImportanceFunction& impFun,
+	           const Sampler& sample = Sampler());
 
 	/**
 	 * @brief Retrieve next expiring clock
@@ -31,6 +31,7 @@
 #define TRAIALPOOL_H
 
 // C++
+#include <deque>
 #include <forward_list>
 #include <type_traits>  // std::is_same<>
 #include <memory>       // std::unique_ptr<>
@@ -73,11 +74,16 @@ class TraialPool
 	static std::once_flag singleInstance_;
 
 	/// Container with the actual resources (i.e. Traial instances)
-	static std::vector< Traial > traials_;
+	/// @note A deque grows and shrinks at the back without moving the other
+	///       instances, so the references held by the users remain valid
+	static std::deque< Traial > traials_;
 
 	/// Resources not currently in use and thus available to users
 	static std::forward_list< Reference< Traial > > available_traials_;
 
+	/// Size of available_traials_, kept to query it in constant time
+	static size_t numAvailable_;
+
 public:
 
 	/// Size of available_traials_ on pool creation
@@ -198,13 +204,32 @@ public:  // Utils
 
 	/// Make sure at least 'requiredResources' \ref Traial "traials" are
 	/// available, without the need for in-between allocations when requested.
-	/// @note <b>Complexity:</b> <i>O(max(requiredResources,num_resources()))</i>
+	/// @note <b>Complexity:</b> <i>O(requiredResources)</i>
 	void ensure_resources(const size_t& requiredResources);
 
+	/**
+	 * @brief Free the memory of the \ref Traial "traials" created last,
+	 *        as long as they're available, so that at most \p maxTraials
+	 *        remain in the pool
+	 * @details Meant to run in between estimations, so that the resources
+	 *          taken by a burst of splitting are given back to the system
+	 * @note <b>Complexity:</b> <i>O(num_traials())</i>
+	 */
+	void shrink(const size_t& maxTraials = INITIAL_SIZE);
+
 	/// How many \ref Traial "traials" are currently available?
-	/// @note <b>Complexity:</b> <i>O(num_resources())</i>
+	/// @note <b>Complexity:</b> <i>O(1)</i>
 	size_t num_resources() const noexcept;
 
+	/// How many \ref Traial "traials" were created, in use or available?
+	/// @note <b>Complexity:</b> <i>O(1)</i>
+	inline size_t num_traials() const noexcept { return traials_.size(); }
+
+	/// How many \ref Traial "traials" are currently in use?
+	/// @note <b>Complexity:</b> <i>O(1)</i>
+	inline size_t num_traials_in_use() const noexcept
+	    { return num_traials() - num_resources(); }
+
 	/// Allow our friend ModuleNetwork to get the time-state of a Traial
 	/// @return (a copy of) The Timeouts vector of the Traial, i.e. its active clocks
 	/// @note Used by ModuleNetwork::peak_simulation()
@@ -144,7 +144,10 @@ public:  // Ctors/Dtor
 	Transition(const Transition&);
 
 	/// Move ctor
-	Transition(Transition&&);
+	/// @note noexcept so that vectors of Transitions move them when
+	///       reallocating, instead of copying them, which would
+	///       recompile their pre and postconditions
+	Transition(Transition&&) noexcept;
 
 	/// Can't copy assign due to Label's const string
 	Transition& operator=(const Transition&) = delete;
@@ -105,6 +105,9 @@ public:  // Accessors
 	virtual T_ val() const noexcept = 0;
 	/// Value corresponding to passed offset
 	virtual T_ val(const size_t& offset) const = 0;
+	/// Offset corresponding to passed value, which must be valid
+	/// @see is_valid_value()
+	virtual size_t offset(const T_& value) const = 0;
 
 public:  // Modifiers
 
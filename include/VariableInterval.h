@@ -99,6 +99,8 @@ public:  // Accessors
 		{ return Variable<T_>::min_ + static_cast<T_>(Variable<T_>::offset_); }
 	inline T_ val(const size_t& offset) const override final
 		{ return Variable<T_>::min_ + static_cast<T_>(offset); }
+	inline size_t offset(const T_& value) const override final
+		{ return static_cast<size_t>(value - Variable<T_>::min_); }
 
 public:  // Modifiers
 
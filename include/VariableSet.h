@@ -125,6 +125,7 @@ public:  // Accessors
 		{ return values_[Variable<T_>::offset_]; }
 	inline T_ val(const size_t& offset) const override final
 		{ return values_[offset]; }
+	size_t offset(const T_& value) const override final;
 
 public:  // Modifiers
 
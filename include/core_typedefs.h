@@ -201,6 +201,9 @@ struct ImpFunSpec
 	const ImportanceValue maxValue;
 	/// <i>(Optional)</i> Neutral element fot the user-defined composition function
 	const ImportanceValue neutralElement;
+	/// <i>(Optional)</i> Max number of states memoized by on-the-fly
+	///                   importance functions (0 for the default)
+	const size_t cacheCapacity;
 	/// Data ctor needs at least a name and a strategy
 	ImpFunSpec(const std::string& theName,
 			   const std::string& theStrategy,
@@ -208,14 +211,16 @@ struct ImpFunSpec
 			   const PostProcessing& thePostProcessing = PostProcessing(),
 			   const ImportanceValue& theMinValue = static_cast<ImportanceValue>(0u),
 			   const ImportanceValue& theMaxValue = static_cast<ImportanceValue>(0u),
-			   const ImportanceValue& theNeutralElement = static_cast<ImportanceValue>(0u)) :
+			   const ImportanceValue& theNeutralElement = static_cast<ImportanceValue>(0u),
+			   const size_t& theCacheCapacity = 0ul) :
 		name(theName),
 		strategy(theStrategy),
 		algebraicFormula(theAlgebraicFormula),
 		postProcessing(thePostProcessing),
 		minValue(theMinValue),
 		maxValue(theMaxValue),
-		neutralElement(theNeutralElement) {}
+		neutralElement(theNeutralElement),
+		cacheCapacity(theCacheCapacity) {}
 };
 
 //
@@ -112,8 +112,11 @@
 #include "ConfidenceIntervalMean.h"
 #include "ConfidenceIntervalProportion.h"
 #include "ConfidenceIntervalRate.h"
+#include "ConfidenceIntervalRegenerative.h"
 #include "ConfidenceIntervalTransient.h"
 #include "ConfidenceIntervalWilson.h"
+#include "ConfidenceSequenceRate.h"
+#include "ConfidenceSequenceTransient.h"
 // Importance functions
 #include "ImportanceFunction.h"
 #include "ImportanceFunctionAlgebraic.h"
@@ -132,14 +135,17 @@
 // Simulation engines
 #include "SimulationEngine.h"
 #include "SimulationEngineNosplit.h"
+#include "SimulationEngineIS.h"
 #include "SimulationEngineRestart.h"
 #include "SimulationEngineFixedEffort.h"
 // High level ADTs
 #include "Transition.h"
 #include "ModuleInstance.h"
 #include "ModuleNetwork.h"
+#include "ModelReplicas.h"
 #include "ModelSuite.h"
 #include "TraialPool.h"
+#include "Telemetry.h"
 // Lexer & Parser
 #include "Type.h"
 #include "Graph.h"
@@ -116,6 +116,36 @@ extern bool forceOperation;
 /// Run algorithm to check confluence of committed actions
 extern bool confluenceCheck;
 
+/// Re-tune online the splitting of the threshold levels in RESTART
+extern bool retuneEffort;
+
+/// Max number of Traials alive at once in RESTART (0 for no limit)
+extern size_t maxTraials;
+
+/// Warm start the thresholds building for every global effort after the first
+extern bool warmThresholds;
+
+/// Choose thresholds efforts minimising variance per CPU time
+extern bool costAwareThresholds;
+
+/// Estimate for all stopping conditions with a single simulation stream
+extern bool singlePass;
+
+/// Estimate all transient properties from the same standard MC simulations
+extern bool sharedTrajectories;
+
+/// Estimate rate properties from independent regeneration cycles
+extern bool regenerative;
+
+/// Check confidence criteria with anytime-valid confidence sequences
+extern bool anytimeValid;
+
+/// Simulate in antithetic pairs with the "nosplit" engine
+extern bool antithetic;
+
+/// Use common random numbers with the "nosplit" engine
+extern bool commonRandomNumbers;
+
 /// For models that come from a Dynamic Fault Tree description,
 /// this is the *rough and unified* probability of having a fail before a repair
 extern double failProbDFT;
@@ -0,0 +1,90 @@
+//==============================================================================
+//
+//  CancellationToken.cpp
+//
+//  Copyleft 2026-
+//  Authors:
+//  - The FIG contributors
+//
+//------------------------------------------------------------------------------
+//
+//  This file is part of FIG.
+//
+//  The Finite Improbability Generator (FIG) project is free software;
+//  you can redistribute it and/or modify it under the terms of the GNU
+//  General Public License as published by the Free Software Foundation;
+//  either version 3 of the License, or (at your option) any later version.
+//
+//  FIG is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with FIG; if not, write to the Free Software Foundation,
+//	Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//==============================================================================
+
+
+// FIG
+#include <CancellationToken.h>
+
+
+namespace fig  // // // // // // // // // // // // // // // // // // // // // //
+{
+
+Watchdog::Watchdog(CancellationToken& token,
+                   const CancellationToken::Clock::time_point& deadline,
+                   std::function<void()> onTimeout) :
+    token_(token),
+    disarmed_(false),
+    fired_(false)
+{
+	token_.set_deadline(deadline);
+	thread_ = std::thread([this, deadline, onTimeout] () {
+		std::unique_lock<std::mutex> lock(mutex_);
+		auto isDisarmed = [this]{ return disarmed_; };
+		if (deadline == CancellationToken::Clock::time_point::max()) {
+			wakeUp_.wait(lock, isDisarmed);  // no deadline: just wait
+			return;
+		}
+		if (wakeUp_.wait_until(lock, deadline, isDisarmed))
+			return;  // disarmed in time
+		lock.unlock();
+		token_.cancel();
+		fired_ = true;
+		if (onTimeout)
+			onTimeout();
+	});
+}
+
+
+Watchdog::~Watchdog()
+{
+	disarm();
+}
+
+
+bool
+Watchdog::disarm()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		disarmed_ = true;
+	}
+	wakeUp_.notify_all();
+	if (thread_.joinable())
+		thread_.join();
+	return fired_;
+}
+
+
+void
+Watchdog::wait()
+{
+	if (thread_.joinable())
+		thread_.join();
+}
+
+} // namespace fig  // // // // // // // // // // // // // // // // // // // //
@@ -28,6 +28,7 @@
 
 // C
 #include <cmath>      // std::round()
+#include <cassert>
 // C++
 #include <array>
 #include <random>
@@ -152,6 +153,23 @@ public:
 };
 
 
+/// BasicRNG which reflects the values of the current RNG, i.e. yields
+/// 'max-r+min' for each value 'r', so that the uniform variates U
+/// it induces become 1-U (antithetic variates)
+class BasicRNG_Antithetic : public BasicRNG
+{
+	typedef BasicRNG::result_type result_type;
+	std::shared_ptr< BasicRNG > rng_;
+public:  // Ctors
+	BasicRNG_Antithetic(std::shared_ptr< BasicRNG > rng) : rng_(rng) {}
+public:
+	result_type min() const  override { return rng_->min(); }
+	result_type max() const  override { return rng_->max(); }
+	result_type operator()() override { return rng_->max() - ((*rng_)() - rng_->min()); }
+	void seed(result_type s) override { rng_->seed(s); }
+};
+
+
 /// Non-deterministic random number generator for randomized seeding,
 /// used by Mersenne-Twister RNG
 std::random_device MT_nondet_RNG;
@@ -194,8 +212,42 @@ std::unordered_map< std::string, std::shared_ptr< BasicRNG > > RNGs =
 /// Current RNG
 std::string rngType(fig::Clock::DEFAULT_RNG.first);
 
-/// RNG instance
-auto rng = RNGs[rngType];
+/// RNG instance sampled by each thread: all share the same one,
+/// unless they switched to their own via fig::Clock::thread_rng()
+thread_local auto rng = RNGs[rngType];
+
+/// Replications started since the last re-seeding of the RNG
+/// @see fig::Clock::new_replication()
+unsigned long replication(0ul);
+
+/// Rounds of parallel simulations started since the last re-seeding of the RNG
+/// @see fig::Clock::new_parallel_round()
+unsigned long parallelRound(0ul);
+
+
+/// Fresh instance of the RNG named \p type, as in the keys of ::RNGs
+std::shared_ptr< BasicRNG >
+make_rng(const std::string& type)
+{
+	if ("pcg32" == type)
+		return std::make_shared< BasicRNG_PCG32 >(rngSeed);
+	else if ("pcg64" == type)
+		return std::make_shared< BasicRNG_PCG64 >(rngSeed);
+	assert("mt64" == type);
+	return std::make_shared< BasicRNG_MT64 >(rngSeed);
+}
+
+
+/// Seed of the RNG substream for a replication, via the SplitMix64 mixer
+/// (<a href="http://xoshiro.di.unimi.it/splitmix64.c">Vigna's code</a>)
+unsigned long
+substream_seed(const unsigned long& seed, const unsigned long& replication)
+{
+	uint64_t z(seed + replication * 0x9E3779B97F4A7C15ull);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return static_cast<unsigned long>(z ^ (z >> 31));
+}
 
 
 /// Random deviate ~ Uniform[a,b]<br>
@@ -423,10 +475,55 @@ void Clock::seed_rng()
 {
 	if (randomSeed_)
 		change_rng_seed(0ul);
+	rng = ::RNGs[rngType];  // drop antithetic sampling
+	replication = 0ul;
+	parallelRound = 0ul;
 	rng->seed(rngSeed);  // if non randomized, this repeats the sequence
 }
 
 
+void Clock::new_replication()
+{
+	rng = ::RNGs[rngType];
+	rng->seed(substream_seed(rngSeed, ++replication));
+}
+
+
+void Clock::antithetic_replication()
+{
+	static std::unordered_map< std::string, std::shared_ptr< BasicRNG > > antithetic;
+	auto& antitheticRNG(antithetic[rngType]);
+	if (nullptr == antitheticRNG)
+		antitheticRNG = std::make_shared< BasicRNG_Antithetic >(::RNGs[rngType]);
+	rng = antitheticRNG;
+	rng->seed(substream_seed(rngSeed, replication));
+}
+
+
+unsigned long Clock::new_parallel_round() noexcept
+{
+	return ++parallelRound;
+}
+
+
+void Clock::thread_rng(const unsigned long& round, const unsigned& thread)
+{
+	thread_local std::unordered_map< std::string, std::shared_ptr< BasicRNG > > threadRNGs;
+	auto& threadRNG(threadRNGs[rngType]);
+	if (nullptr == threadRNG)
+		threadRNG = make_rng(rngType);
+	rng = threadRNG;
+	// Complement the seed to stay clear of the replications' substreams
+	rng->seed(substream_seed(substream_seed(~rngSeed, round), thread));
+}
+
+
+void Clock::shared_rng()
+{
+	rng = ::RNGs[rngType];
+}
+
+
 std::unordered_map< std::string, Distribution > distributions_list =
 {
 	{"uniform",     uniform    },
@@ -282,4 +282,20 @@ ConfidenceInterval::confidence_quantile(const double& cc,
 	return quantile;
 }
 
+
+double
+ConfidenceInterval::sequence_quantile(const double& cc,
+                                      const long& n,
+                                      const double& nOpt)
+{
+	assert(0.0 < cc && cc < 1.0);
+	assert(0.0 < nOpt);
+	const double alpha(1.0-cc),
+	             logAlpha2(-2.0*std::log(alpha)),
+	             rho2((logAlpha2 + std::log(logAlpha2+1.0)) / nOpt),
+	             nRho2(std::max(1l,n)*rho2);
+	return std::sqrt(2.0 * (nRho2+1.0) / nRho2
+	                     * std::log(std::sqrt(nRho2+1.0)/alpha));
+}
+
 } // namespace fig  // // // // // // // // // // // // // // // // // // // //
@@ -0,0 +1,144 @@
+//==============================================================================
+//
+//  ConfidenceIntervalRegenerative.cpp
+//
+//  Copyleft 2026-
+//  Authors:
+//  - The FIG contributors
+//
+//------------------------------------------------------------------------------
+//
+//  This file is part of FIG.
+//
+//  The Finite Improbability Generator (FIG) project is free software;
+//  you can redistribute it and/or modify it under the terms of the GNU
+//  General Public License as published by the Free Software Foundation;
+//  either version 3 of the License, or (at your option) any later version.
+//
+//  FIG is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with FIG; if not, write to the Free Software Foundation,
+//	Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//==============================================================================
+
+
+// C
+#include <cmath>
+#include <cassert>
+// FIG
+#include <ConfidenceIntervalRegenerative.h>
+#include <FigException.h>
+
+
+namespace fig  // // // // // // // // // // // // // // // // // // // // // //
+{
+
+ConfidenceIntervalRegenerative::ConfidenceIntervalRegenerative(double confidence,
+                                                               double precision,
+                                                               bool dynamicPrecision,
+                                                               bool neverStop) :
+	ConfidenceInterval("regenerative", confidence, precision, dynamicPrecision, neverStop),
+	meanReward_(0.0),
+	meanLength_(0.0),
+	M2reward_(0.0),
+	M2length_(0.0),
+	M2cross_(0.0)
+{ /* Not much to do around here... */ }
+
+
+void
+ConfidenceIntervalRegenerative::update(const double&)
+{
+	throw_FigException("regenerative intervals must be fed with "
+	                   "(reward,length) pairs of the cycles simulated");
+}
+
+
+void
+ConfidenceIntervalRegenerative::update(const double& reward, const double& length)
+{
+	prevEstimate_ = estimate_;
+	// Incremental computation of means and co-moments (http://goo.gl/ytk6B)
+	assert(0.0 <= reward);
+	assert(reward <= length);
+	if (++numSamples_ <= 0l)
+		throw_FigException("numSamples_ became negative, overflow?");
+	const double deltaR(reward - meanReward_),
+	             deltaL(length - meanLength_);
+	meanReward_ += deltaR/numSamples_;
+	meanLength_ += deltaL/numSamples_;
+	M2reward_ += deltaR * (reward - meanReward_);
+	M2length_ += deltaL * (length - meanLength_);
+	M2cross_  += deltaR * (length - meanLength_);
+	update_interval();
+}
+
+
+void
+ConfidenceIntervalRegenerative::update(const std::vector< std::pair< double, double > >& cycles)
+{
+	const double prevEstimate(estimate_);
+	for (const auto& cycle: cycles)
+		update(cycle.first, cycle.second);
+	prevEstimate_ = prevEstimate;
+}
+
+
+void
+ConfidenceIntervalRegenerative::update_interval()
+{
+	if (0.0 >= meanLength_)
+		return;
+	estimate_ = meanReward_ / meanLength_;
+	if (numSamples_ < 2l)
+		return;
+	// Sample variance of "reward - estimate * length", scaled by the mean length
+	const double varZ((M2reward_ - 2.0*estimate_*M2cross_
+	                   + estimate_*estimate_*M2length_) / (numSamples_-1l));
+	variance_ = std::max(0.0, varZ) / (meanLength_*meanLength_);
+	// Half-width of the new confidence interval
+	halfWidth_ = quantile * std::sqrt(variance_/numSamples_);
+}
+
+
+bool
+ConfidenceIntervalRegenerative::min_samples_covered(bool considerEpsilon) const noexcept
+{
+	const bool
+		// The ratio estimator is biased for few cycles: be generous with the CLT
+		theoreticallySound = 100l <= numSamples_,
+		// If requested, ask also for little change w.r.t. the last estimate
+		practicallySound =
+	        considerEpsilon ? std::abs(prevEstimate_-estimate_) < 0.05*estimate_
+							: true;
+	return theoreticallySound && practicallySound;
+}
+
+
+double
+ConfidenceIntervalRegenerative::precision(const double& confco) const
+{
+	if (0.0 >= confco || 1.0 <= confco)
+		throw_FigException("requires confidence coefficient ∈ (0.0, 1.0)");
+	return 2.0 * confidence_quantile(confco)
+			   * std::sqrt(variance_/numSamples_);
+}
+
+
+void
+ConfidenceIntervalRegenerative::reset(bool fullReset) noexcept
+{
+	ConfidenceInterval::reset(fullReset);
+	meanReward_ = 0.0;
+	meanLength_ = 0.0;
+	M2reward_ = 0.0;
+	M2length_ = 0.0;
+	M2cross_ = 0.0;
+}
+
+}  // namespace fig  // // // // // // // // // // // // // // // // // // // //
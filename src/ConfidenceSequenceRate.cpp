@@ -0,0 +1,72 @@
+//==============================================================================
+//
+//  ConfidenceSequenceRate.cpp
+//
+//  Copyleft 2026-
+//  Authors:
+//  - The FIG contributors
+//
+//------------------------------------------------------------------------------
+//
+//  This file is part of FIG.
+//
+//  The Finite Improbability Generator (FIG) project is free software;
+//  you can redistribute it and/or modify it under the terms of the GNU
+//  General Public License as published by the Free Software Foundation;
+//  either version 3 of the License, or (at your option) any later version.
+//
+//  FIG is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with FIG; if not, write to the Free Software Foundation,
+//	Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//==============================================================================
+
+
+// C
+#include <cmath>  // sqrt()
+// FIG
+#include <ConfidenceSequenceRate.h>
+#include <FigException.h>
+
+
+namespace fig  // // // // // // // // // // // // // // // // // // // // // //
+{
+
+ConfidenceSequenceRate::ConfidenceSequenceRate(double conf,
+                                               double precision,
+                                               bool dynamicPrecision,
+                                               bool neverStop,
+                                               double optimalSamples) :
+	ConfidenceInterval("rate", conf, precision, dynamicPrecision, neverStop),
+	ConfidenceIntervalRate(conf, precision, dynamicPrecision, neverStop),
+	optimalSamples_(optimalSamples)
+{
+	if (0.0 >= optimalSamples)
+		throw_FigException("a confidence sequence requires optimal samples > 0");
+}
+
+
+void
+ConfidenceSequenceRate::update(const double& newMean)
+{
+	ConfidenceIntervalRate::update(newMean);
+	halfWidth_ = sequence_quantile(confidence, numSamples_, optimalSamples_)
+	             * std::sqrt(variance_/numSamples_);
+}
+
+
+double
+ConfidenceSequenceRate::precision(const double& confco) const
+{
+	if (0.0 >= confco || 1.0 <= confco)
+		throw_FigException("requires confidence coefficient ∈ (0.0, 1.0)");
+	return 2.0 * sequence_quantile(confco, numSamples_, optimalSamples_)
+	           * std::sqrt(variance_/numSamples_);
+}
+
+} // namespace fig  // // // // // // // // // // // // // // // // // // // //
@@ -4,8 +4,20 @@
 
 #include "ConfluenceChecker.h"
 
+namespace {
+
+constexpr size_t WORD_BITS = 64ul;
+
+inline size_t num_words(size_t numBits) {
+    return ((numBits + WORD_BITS - 1ul) / WORD_BITS);
+}
+
+} // namespace
+
 namespace iosa {
 
+constexpr unsigned int ConfluenceChecker::NO_POSITION;
+
 void ConfluenceChecker::visit(std::shared_ptr<Model> node) {
     for (auto module : node->get_modules()) {
         if (module->has_arrays()) {
@@ -32,7 +44,7 @@ void ConfluenceChecker::debug_matrix() {
     unsigned int size = position.size();
     for (unsigned int i = 0 ; i < size; i++) {
         for (unsigned int j = 0; j < size; j++) {
-           std::cout << matrix[i][j] << " ";
+           std::cout << indirectly_triggers(i, j) << " ";
         }
         std::cout << std::endl;
     }
@@ -40,25 +52,36 @@ void ConfluenceChecker::debug_matrix() {
 
 //Raul's paper algorithm
 bool ConfluenceChecker::confluence_check() {
+    // Intern the labels of the edges once, the loops below only
+    // deal with their positions on the matrix
+    std::vector<unsigned int> initialPos, spontaneousPos;
+    initialPos.reserve(initials.size());
+    for (IEdge &edge : this->initials) {
+        initialPos.push_back(position_of(edge.get_data().get_label_id()));
+    }
+    spontaneousPos.reserve(spontaneous.size());
+    for (IEdge &edge : this->spontaneous) {
+        spontaneousPos.push_back(position_of(edge.get_data().get_label_id()));
+    }
     for (NonConfluentPair &pair : this->non_confluents) {
-        string a = pair.first.get_data().get_label_id();
-        string b = pair.second.get_data().get_label_id();
-        for (IEdge &edge1 : this->initials) {
-            string c = edge1.get_data().get_label_id();
-            if (indirectly_triggers(c,a)) {
-                for (IEdge &edge2 : this->initials) {
-                    string d = edge2.get_data().get_label_id();
-                    if (indirectly_triggers(d, b)) {
-                        initial_non_deterministic_msg(pair, edge1, edge2);
-                        return (true);
-                    }
-                }
+        unsigned int a = position_of(pair.first.get_data().get_label_id());
+        unsigned int b = position_of(pair.second.get_data().get_label_id());
+        if (a == NO_POSITION || b == NO_POSITION) {
+            continue;  // nothing triggers them
+        }
+        size_t edge1 = first_triggering(initialPos, a);
+        if (edge1 < initials.size()) {
+            size_t edge2 = first_triggering(initialPos, b);
+            if (edge2 < initials.size()) {
+                initial_non_deterministic_msg(pair, initials[edge1],
+                                              initials[edge2]);
+                return (true);
             }
         }
-        for (IEdge &edge1 : this->spontaneous) {
-            string c = edge1.get_data().get_label_id();
-            if (indirectly_triggers(c,a) && indirectly_triggers(c,b)) {
-                spontaneous_non_deterministic_msg(pair, edge1);
+        for (size_t edge = 0ul ; edge < spontaneous.size() ; edge++) {
+            unsigned int c = spontaneousPos[edge];
+            if (indirectly_triggers(c, a) && indirectly_triggers(c, b)) {
+                spontaneous_non_deterministic_msg(pair, spontaneous[edge]);
                 return (true);
             }
         }
@@ -66,6 +89,15 @@ bool ConfluenceChecker::confluence_check() {
     return (false);
 }
 
+size_t ConfluenceChecker::first_triggering(
+        const std::vector<unsigned int> &labels, unsigned int pos) const {
+    size_t i = 0ul;
+    while (i < labels.size() && !indirectly_triggers(labels[i], pos)) {
+        i++;
+    }
+    return (i);
+}
+
 void ConfluenceChecker::
 initial_non_deterministic_msg(NonConfluentPair& pair, IEdge& edge1,
                               IEdge& edge2) {
@@ -112,15 +144,22 @@ spontaneous_non_deterministic_msg(NonConfluentPair &pair, IEdge& edge) {
     put_error(ss.str());
 }
 
+unsigned int ConfluenceChecker::position_of(const string &label) const {
+    auto it = position.find(label);
+    return (it == position.end() ? NO_POSITION : it->second);
+}
+
 bool ConfluenceChecker::indirectly_triggers(const string &label1,
                                             const string &label2) {
-    if (position.find(label1) == position.end() ||
-            position.find(label2) == position.end()) {
+    return (indirectly_triggers(position_of(label1), position_of(label2)));
+}
+
+bool ConfluenceChecker::indirectly_triggers(unsigned int pos1,
+                                            unsigned int pos2) const {
+    if (pos1 == NO_POSITION || pos2 == NO_POSITION) {
         return (false);
     }
-    unsigned int i = position.at(label1);
-    unsigned int j = position.at(label2);
-    return matrix[i][j];
+    return ((matrix[pos1][pos2 / WORD_BITS] >> (pos2 % WORD_BITS)) & 1ul);
 }
 
 void ConfluenceChecker::prepare_matrix() {
@@ -138,32 +177,35 @@ void ConfluenceChecker::prepare_matrix() {
         }
     }
     unsigned int size = position.size();
-    matrix.resize(size);
-    for (std::vector<bool>& v : matrix) {
-        v.resize(size, false);
-    }
+    matrix.assign(size, Row(num_words(size), 0ul));
     for (TriggeringPair& entry : tr) {
-        string label1 = entry.first.get_data().get_label_id();
-        string label2 = entry.second.get_data().get_label_id();
-        unsigned int pos1 = position.at(label1);
-        unsigned int pos2 = position.at(label2);
-        matrix[pos1][pos2] = true;
+        unsigned int pos1 = position.at(entry.first.get_data().get_label_id());
+        unsigned int pos2 = position.at(entry.second.get_data().get_label_id());
+        matrix[pos1][pos2 / WORD_BITS] |= UINT64_C(1) << (pos2 % WORD_BITS);
     }
 }
 
 void ConfluenceChecker::warshall() {
-    unsigned int size = position.size();
-    //transitive closure
-    for (unsigned int k = 0; k < size; k++) {
-        for (unsigned int i = 0; i < size; i++) {
-            for (unsigned int j = 0; j < size; j++) {
-                matrix[i][j] = matrix[i][j] || (matrix[i][k] && matrix[k][j]);
+    const long size = position.size();
+    const size_t words = num_words(size);
+    //transitive closure: if "i" triggers "k" then it also triggers
+    //everything that "k" triggers, i.e. row(i) |= row(k)
+    for (long k = 0; k < size; k++) {
+        const Row &rowK = matrix[k];
+        const std::uint64_t bitK = UINT64_C(1) << (k % WORD_BITS);
+        #pragma omp parallel for default(shared) if(size > 1024l)
+        for (long i = 0; i < size; i++) {
+            Row &rowI = matrix[i];
+            if (i != k && (rowI[k / WORD_BITS] & bitK)) {
+                for (size_t w = 0ul; w < words; w++) {
+                    rowI[w] |= rowK[w];
+                }
             }
         }
     }
     //make it reflexive, sure?
-    for (unsigned int i = 0 ; i < size ; i++) {
-        matrix[i][i] = true;
+    for (long i = 0 ; i < size ; i++) {
+        matrix[i][i / WORD_BITS] |= UINT64_C(1) << (i % WORD_BITS);
     }
 }
 
@@ -92,15 +92,13 @@ ExpState<T>::ExpState(const std::vector<std::shared_ptr<Exp>> &astVec) {
 }
 
 template<typename T>
-ExpState<T>::ExpState(const ExpState& that) {
-    new (&mem_) std::vector<T>(that.mem_);
+ExpState<T>::ExpState(const ExpState& that) :
+    mem_(that.mem_),
+    vars_(that.vars_),
+    table_()
+{
     assert(mem_.size() == that.mem_.size());
-    assert(mem_ == that.mem_);
-    new (&vars_) std::unordered_map<std::string, VarData>(that.vars_);
-    //for (auto& p : vars_) {
-    //    assert(p.second == that.vars_.at(p.first));
-    //}
-    new (&table_) exprtk::symbol_table<T>();
+    // the new symbol table must refer to our own values
     fill_symbol_table();
 }
 
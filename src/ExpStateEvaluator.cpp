@@ -180,7 +180,7 @@ ExpStateEvaluator::ExpStateEvaluator(const ExpContainer& astVector) :
 ExpStateEvaluator::ExpStateEvaluator(const ExpStateEvaluator &that) :
     astVec(that.astVec),  // is deep copy because contents are shared_ptr<>
     numExp(that.numExp),
-    expState(astVec),
+    expState(that.expState),  // keep the positions projected by prepare()
     expStrings(that.expStrings),  // default is deep-copy
     prepared(that.prepared),
     valuation(that.valuation)
@@ -0,0 +1,95 @@
+//==============================================================================
+//
+//  ImportanceCache.cpp
+//
+//  Copyleft 2026-
+//  Authors:
+//  - The FIG contributors
+//
+//------------------------------------------------------------------------------
+//
+//  This file is part of FIG.
+//
+//  The Finite Improbability Generator (FIG) project is free software;
+//  you can redistribute it and/or modify it under the terms of the GNU
+//  General Public License as published by the Free Software Foundation;
+//  either version 3 of the License, or (at your option) any later version.
+//
+//  FIG is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with FIG; if not, write to the Free Software Foundation,
+//	Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//==============================================================================
+
+
+// FIG
+#include <ImportanceCache.h>
+
+
+namespace fig  // // // // // // // // // // // // // // // // // // // // // //
+{
+
+// Static variables initialization
+
+constexpr size_t ImportanceCache::DEFAULT_CAPACITY;
+
+
+ImportanceCache::ImportanceCache(const size_t& capacity) :
+    slots_(),
+    index_(),
+    hand_(0ul),
+    capacity_(1ul),
+    hits_(0ul),
+    misses_(0ul)
+{
+	clear(capacity);
+}
+
+
+void
+ImportanceCache::insert(const StateInstance& key, const ImportanceValue& value)
+{
+	const auto it = index_.find(key);
+	if (end(index_) != it) {
+		slots_[it->second].value = value;
+		return;
+	}
+	if (slots_.size() < capacity_) {
+		// Still room: no eviction needed
+		index_.emplace(key, slots_.size());
+		slots_.push_back({key, value, false});
+		return;
+	}
+	// CLOCK: sweep clearing reference bits until an unreferenced slot shows up
+	while (slots_[hand_].referenced) {
+		slots_[hand_].referenced = false;
+		hand_ = (hand_+1ul) % capacity_;
+	}
+	Slot& victim = slots_[hand_];
+	index_.erase(victim.key);
+	index_.emplace(key, hand_);
+	victim.key = key;
+	victim.value = value;
+	victim.referenced = false;
+	hand_ = (hand_+1ul) % capacity_;
+}
+
+
+void
+ImportanceCache::clear(const size_t& capacity)
+{
+	if (0ul < capacity)
+		capacity_ = capacity;
+	std::vector< Slot >().swap(slots_);
+	index_.clear();
+	hand_ = 0ul;
+	hits_ = 0ul;
+	misses_ = 0ul;
+}
+
+} // namespace fig  // // // // // // // // // // // // // // // // // // // //
@@ -39,7 +39,7 @@
 #include <limits>
 #include <numeric>    // std::numeric_limits<>()
 #include <iterator>   // std::begin(), std::end()
-#include <algorithm>  // std::find()
+#include <algorithm>  // std::find(), std::upper_bound()
 #include <functional>   // std::function<>, std::bind()
 #include <type_traits>  // std::is_assignable<>
 // FIG
@@ -254,6 +254,9 @@ ImportanceFunction::names() noexcept
 		// See ImportanceFunctionConcreteSplit class
 		"concrete_split",
 
+		// See ImportanceFunctionConcreteLazy class
+		"concrete_lazy",
+
 		// See ImportanceFunctionAlgebraic class
 		"algebraic"
 	}};
@@ -264,7 +267,7 @@ ImportanceFunction::names() noexcept
 const std::array< std::string, ImportanceFunction::NUM_STRATEGIES>&
 ImportanceFunction::strategies() noexcept
 {
-	static const std::array< std::string, NUM_NAMES > strategies=
+	static const std::array< std::string, NUM_STRATEGIES > strategies=
 	{{
 		// Flat importance, i.e. null ImportanceValue for all states
 		"flat",
@@ -406,16 +409,35 @@ ImportanceFunction::level_of(const ImportanceValue& imp) const
 	assert(imp <= maxValue_);
 	if (importance2threshold_.size() > 0ul)  // Do we have the direct map?
 		return importance2threshold_[imp].first;
-	ImportanceValue tlvl(threshold2importance_.size()/2ul), step(tlvl/2);
-	while (imp <  threshold2importance_[tlvl].first ||
-	       imp >= threshold2importance_[tlvl+1].first) {
-		if (imp < threshold2importance_[tlvl].first)
-			tlvl -= step;
-		else
-			tlvl += step;
-		step = std::max(static_cast<ImportanceValue>(1), step/2);
-	}
-	return tlvl;
+	// Search the first level whose lower bound exceeds 'imp' and step back
+	assert(thresholdsBounds_.size() == threshold2importance_.size());
+	const auto ub = std::upper_bound(begin(thresholdsBounds_),
+	                                 end(thresholdsBounds_),
+	                                 imp);
+	assert(ub != begin(thresholdsBounds_));
+	return static_cast<ImportanceValue>(
+	            std::distance(begin(thresholdsBounds_), ub) - 1l);
+}
+
+
+ImportanceValue
+ImportanceFunction::state_info(const StateInstance& state,
+                               const Property& property) const
+{
+#ifndef NDEBUG
+	if (!has_importance_info())
+		throw_FigException("importance function \"" + name_ + "\" "
+		                   "doesn't hold importance information");
+#endif
+	Event e(EventType::NONE);
+	if (property.is_stop(state))
+		SET_STOP_EVENT(e);
+	if (property.is_rare(state))
+		SET_RARE_EVENT(e);
+	const ImportanceValue imp(importance_of(state));
+	return e | (!ready() ? imp : !importance2threshold_.empty()
+	                             ? importance2threshold_[imp].first
+	                             : level_of(imp));
 }
 
 
@@ -541,6 +563,7 @@ ImportanceFunction::build_thresholds(ThresholdsBuilder& tb)
 		                   "has no importance information");
 	ThresholdsVec().swap(threshold2importance_);
 	ThresholdsVec().swap(importance2threshold_);
+	ImportanceVec().swap(thresholdsBounds_);
 	thresholdsTechnique_ = "";
     readyForSims_ = false;
     threshold2importance_ = tb.build_thresholds(shared_from_this());
@@ -568,6 +591,12 @@ ImportanceFunction::post_process_thresholds(const ThresholdsBuilder& tb)
 		assert(importance2threshold_[initialValue_].first <= importance2threshold_[minRareValue_].first);
 		assert(importance2threshold_[minRareValue_].first <= importance2threshold_[maxValue_].first);
 	}
+	// Lower bounds of the levels, contiguous for the search in level_of()
+	thresholdsBounds_.clear();
+	thresholdsBounds_.reserve(threshold2importance_.size());
+	for (const auto& p: threshold2importance_)
+		thresholdsBounds_.emplace_back(p.first);
+	assert(std::is_sorted(begin(thresholdsBounds_), end(thresholdsBounds_)));
 	// Set relevant attributes
 	using myLimits = std::numeric_limits<decltype(minThresholdsEffort_)>;  // I'm this close...
 	minThresholdsEffort_ = myLimits::max();
@@ -593,6 +622,7 @@ ImportanceFunction::clear() noexcept
 	minRareValue_ = static_cast<ImportanceValue>(0u);
 	ThresholdsVec().swap(threshold2importance_);
 	ThresholdsVec().swap(importance2threshold_);
+	ImportanceVec().swap(thresholdsBounds_);
 	userFun_.reset();
 }
 
@@ -37,6 +37,7 @@
 #include <algorithm>  // std::fill(), std::remove_if()
 // FIG
 #include <ImportanceFunctionConcrete.h>
+#include <ModuleNetwork.h>
 #include <FigLog.h>
 #include <FigException.h>
 #include <Transition.h>
@@ -69,6 +70,10 @@ using Indices = fig::ImportanceFunctionConcrete::Indices;
 typedef ImportanceVec EventVec;
 typedef unsigned STATE_T;
 
+/// Max number of valuations gathered before merging them into a decision
+/// diagram, when assessing importance symbolically
+const size_t SYMBOLIC_BATCH_SIZE(1ul<<16);
+
 
 /**
  * @brief Impose a limit on the amount of memory the user can request.
@@ -690,6 +695,143 @@ bool ImportanceFunctionConcrete::assess_importance(
 }
 
 
+bool
+ImportanceFunctionConcrete::assess_importance_symbolic(const ModuleNetwork& model,
+                                                       const Property& property,
+                                                       ImportanceMDD& mdd)
+{
+	typedef std::vector< ImportanceMDD::Entry > Entries;
+	const State<STATE_INTERNAL_TYPE>& gState(model.global_state());
+	const StateInstance INITIAL_STATE(model.initial_state().to_state_instance());
+	auto max = [] (const ImportanceValue& a, const ImportanceValue& b)
+	           { return std::max(a, b); };
+
+	// Valuations are gathered in a bounded buffer and merged into
+	// the diagrams in batches: no list of all states is ever kept
+	Entries buffer;
+	size_t numMerged(0ul);
+	buffer.reserve(SYMBOLIC_BATCH_SIZE);
+	auto reset = [&gState] (ImportanceMDD& dd) {
+		Entries none;
+		dd.build(gState, none);
+	};
+	auto flush = [&] (ImportanceMDD& dd) {
+		if (buffer.empty())
+			return;
+		std::sort(begin(buffer), end(buffer));
+		buffer.erase(std::unique(begin(buffer), end(buffer),
+		                         [] (const ImportanceMDD::Entry& e1,
+		                             const ImportanceMDD::Entry& e2)
+		                         { return e1.first == e2.first; }),
+		             end(buffer));
+		numMerged += buffer.size();
+		ImportanceMDD batch;
+		batch.build(gState, buffer);
+		dd.apply(batch, max);
+		buffer.clear();
+	};
+	auto add = [&] (const StateInstance& s, const ImportanceValue& val,
+	                ImportanceMDD& dd) {
+		buffer.emplace_back(s, val);
+		if (buffer.size() >= SYMBOLIC_BATCH_SIZE)
+			flush(dd);
+	};
+
+	// Step 1: explore the reachable valuations breadth-first; sets of
+	//         valuations are diagrams mapping their members to 1
+	ImportanceMDD reach, frontier, next;
+	reset(reach);
+	add(INITIAL_STATE, 1u, reach);
+	flush(reach);
+	frontier = reach;
+	while (!frontier.trivial()) {
+		reset(next);
+		frontier.for_each([&] (const StateInstance& s, const ImportanceValue&) {
+			for (const auto& t: model.adjacent_states(s))
+				if (0u == reach(t) && 0u == next(t))
+					add(t, 1u, next);
+		});
+		flush(next);
+		reach.apply(next, max);
+		std::swap(frontier, next);
+	}
+	frontier.clear();
+	next.clear();
+	figTechLog << "Reachable global states: " << numMerged
+	           << " (" << reach.num_nodes() << " decision diagram nodes)\n";
+
+	// Step 2: label reachable valuations with their distance to the rare
+	//         set, plus one (so that 0 means "unlabelled"), by layers of
+	//         increasing distance until the initial valuation is labelled.
+	//         Without a symbolic transition relation preimages can't be
+	//         computed: layer 'd+1' are the unlabelled valuations with
+	//         some successor in layer 'd'
+	ImportanceMDD distance, layer;
+	reset(distance);
+	reach.for_each([&] (const StateInstance& s, const ImportanceValue&) {
+		if (property.is_rare(s))
+			add(s, 1u, distance);
+	});
+	flush(distance);
+	for (ImportanceValue d = 1u ; 0u == distance(INITIAL_STATE) ; d++) {
+		reset(layer);
+		reach.for_each([&] (const StateInstance& s, const ImportanceValue&) {
+			if (0u != distance(s))
+				return;
+			for (const auto& t: model.adjacent_states(s))
+				if (d == distance(t)) {
+					add(s, d+1u, layer);
+					break;
+				}
+		});
+		flush(layer);
+		if (layer.trivial())
+			break;  // no rare state is reachable
+		distance.apply(layer, max);
+	}
+	layer.clear();
+	const ImportanceValue ALL_MASKS(EventType::RARE
+	                                |EventType::STOP
+	                                |EventType::REFERENCE
+	                                |EventType::THR_UP
+	                                |EventType::THR_DOWN);
+	const ImportanceValue maxDistance(0u == distance(INITIAL_STATE)
+	                                  ? static_cast<ImportanceValue>(0u)
+	                                  : distance(INITIAL_STATE)-1u);
+	if (maxDistance & ALL_MASKS)
+		throw_FigException("too many importance levels were found "
+		                   "(" + std::to_string(maxDistance) + ")");
+
+	// Step 3: invert the distances to obtain the importance, mix it with
+	//         the events of each valuation and store it symbolically;
+	//         unreachable valuations get null importance
+	reset(mdd);
+	reach.for_each([&] (const StateInstance& s, const ImportanceValue&) {
+		const ImportanceValue dist(distance(s));
+		ImportanceValue info(0u < dist && dist-1u < maxDistance
+		                     ? maxDistance-(dist-1u)
+		                     : static_cast<ImportanceValue>(0u));
+		if (property.is_rare(s))
+			SET_RARE_EVENT(info);
+		if (property.is_stop(s))
+			SET_STOP_EVENT(info);
+		if (static_cast<ImportanceValue>(0u) != info)
+			add(s, info, mdd);
+	});
+	flush(mdd);
+	figTechLog << "Importance decision diagram built: " << mdd.num_nodes()
+	           << " nodes, " << mdd.num_terminals() << " terminals\n";
+
+	maxValue_ = maxDistance;
+	const bool modelIsRelevant(static_cast<ImportanceValue>(0u) < maxValue_);
+	minValue_ = modelIsRelevant ? UNMASK(mdd(INITIAL_STATE)) : maxValue_;
+	initialValue_ = minValue_;
+	minRareValue_ = maxValue_;
+
+	return modelIsRelevant;
+}
+
+
 void
 ImportanceFunctionConcrete::post_process(const PostProcessing& postProc,
                                          std::vector<ExtremeValues>& extrVals)
@@ -758,9 +900,8 @@ ImportanceFunctionConcrete::pp_shift(std::vector<ExtremeValues>& extrVals,
 
 main_loop_pp_shift:
 	// Now shift importance values (disregard {under,over}flows here)
-	for (ImportanceVec& vec: modulesConcreteImportance)
-		for (ImportanceValue& val: vec)
-			val = MASK(val) | (UNMASK(val)+offset);
+	transform_values([&offset] (const ImportanceValue& imp)
+	                 { return imp + offset; });
 }
 
 
@@ -801,10 +942,18 @@ ImportanceFunctionConcrete::pp_exponentiate(std::vector<ExtremeValues>& extrVals
 
 main_loop_pp_exp:
 	// Now exponentiate all the importance values stored
+	transform_values([&b] (const ImportanceValue& imp)
+	                 { return static_cast<ImportanceValue>(round(pow(b,imp))); });
+}
+
+
+void
+ImportanceFunctionConcrete::transform_values(
+    const std::function<ImportanceValue(const ImportanceValue&)>& f)
+{
 	for (ImportanceVec& vec: modulesConcreteImportance)
 		for (ImportanceValue& val: vec)
-			val = MASK(val) |
-				  static_cast<ImportanceValue>(round(pow(b,UNMASK(val))));
+			val = MASK(val) | f(UNMASK(val));
 }
 
 
@@ -30,6 +30,7 @@
 #include <ImportanceFunctionConcreteCoupled.h>
 #include <ModuleNetwork.h>
 #include <ThresholdsBuilder.h>
+#include <FigLog.h>
 
 
 namespace fig  // // // // // // // // // // // // // // // // // // // // // //
@@ -40,7 +41,9 @@ ImportanceFunctionConcreteCoupled::ImportanceFunctionConcreteCoupled(
     const ModuleNetwork &model) :
 		ImportanceFunctionConcrete("concrete_coupled", model.global_state()),
 		model_(model),
-        importanceInfoIndex_(0u)
+        importanceInfoIndex_(0u),
+        symbolic_(false),
+        forceSymbolic_(false)
 { /* Not much to do around here */ }
 
 
@@ -56,9 +59,19 @@ ImportanceFunctionConcreteCoupled::assess_importance(const Property& prop,
 													 const PostProcessing& postProc)
 {
     if (hasImportanceInfo_)
-		ImportanceFunctionConcrete::clear();
-	const bool importanceAssessed =
-		ImportanceFunctionConcrete::assess_importance(model_,
+		clear();
+	// Concrete state spaces too big for a vector are stored symbolically
+	symbolic_ = "auto" == strategy &&
+	            (forceSymbolic_ ||
+	             model_.concrete_state_size() > ImportanceFunction::MAX_MEM_REQ);
+	if (symbolic_ && !forceSymbolic_)
+		figTechLog << "Concrete state space too big for vector storage: "
+		           << "importance will be kept in a decision diagram.\n";
+	const bool importanceAssessed = symbolic_
+		? ImportanceFunctionConcrete::assess_importance_symbolic(model_,
+		                                                         prop,
+		                                                         symbolicImportance_)
+		: ImportanceFunctionConcrete::assess_importance(model_,
 													  prop,
 													  strategy,
 													  importanceInfoIndex_);
@@ -93,6 +106,27 @@ ImportanceFunctionConcreteCoupled::assess_importance(
 }
 
 
+void
+ImportanceFunctionConcreteCoupled::clear() noexcept
+{
+	symbolicImportance_.clear();
+	symbolic_ = false;
+	ImportanceFunctionConcrete::clear();
+}
+
+
+void
+ImportanceFunctionConcreteCoupled::transform_values(
+    const std::function<ImportanceValue(const ImportanceValue&)>& f)
+{
+	if (symbolic_)
+		symbolicImportance_.transform([&f] (const ImportanceValue& val)
+		                              { return MASK(val) | f(UNMASK(val)); });
+	else
+		ImportanceFunctionConcrete::transform_values(f);
+}
+
+
 void
 ImportanceFunctionConcreteCoupled::print_out(std::ostream& out,
                                              State<STATE_INTERNAL_TYPE>) const
@@ -113,6 +147,18 @@ ImportanceFunctionConcreteCoupled::print_out(std::ostream& out,
         << "\n      *  denotes a state is RARE,"
         << "\n      ~  denotes a state is STOP,"
         << "\n      ^  denotes a state is REFERENCE.";
+    if (symbolic_) {
+		out << "\nValues for coupled model are stored in a decision diagram"
+		    << " with " << symbolicImportance_.num_nodes() << " nodes;"
+		    << " distinct (masked) values:";
+		for (const auto& val: symbolicImportance_.terminals())
+			out << " (" << (IS_RARE_EVENT     (val) ? "*" : "")
+			            << (IS_STOP_EVENT     (val) ? "~" : "")
+			            << (IS_REFERENCE_EVENT(val) ? "^" : "")
+			            << UNMASK(val) << ")";
+		out << std::endl;
+		return;
+	}
     out << "\nValues for coupled model:";
     const ImportanceVec& impVec = modulesConcreteImportance[importanceInfoIndex_];
 	if (impVec.size() > MAX_PRINT_LEN)
@@ -0,0 +1,259 @@
+//==============================================================================
+//
+//  ImportanceFunctionConcreteLazy.cpp
+//
+//  Copyleft 2026-
+//  Authors:
+//  - The FIG contributors
+//
+//------------------------------------------------------------------------------
+//
+//  This file is part of FIG.
+//
+//  The Finite Improbability Generator (FIG) project is free software;
+//  you can redistribute it and/or modify it under the terms of the GNU
+//  General Public License as published by the Free Software Foundation;
+//  either version 3 of the License, or (at your option) any later version.
+//
+//  FIG is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with FIG; if not, write to the Free Software Foundation,
+//	Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//==============================================================================
+
+
+// C++
+#include <vector>
+#include <unordered_map>
+// FIG
+#include <ImportanceFunctionConcreteLazy.h>
+#include <ModuleNetwork.h>
+#include <Property.h>
+#include <FigLog.h>
+
+// ADL
+using std::begin;
+using std::end;
+
+
+namespace  // // // // // // // // // // // // // // // // // // // // // // //
+{
+
+/// Distance to the rare set of states which can't reach it
+const fig::ImportanceValue UNREACHABLE(fig::UNMASK(~static_cast<fig::ImportanceValue>(0u)));
+
+/// Identity post-processing
+fig::ImportanceValue identity(const fig::ImportanceValue& val) { return val; }
+
+} // namespace  // // // // // // // // // // // // // // // // // // // // //
+
+
+
+namespace fig  // // // // // // // // // // // // // // // // // // // // // //
+{
+
+// Available function names in ImportanceFunction::names
+ImportanceFunctionConcreteLazy::ImportanceFunctionConcreteLazy(
+    const ModuleNetwork &model) :
+		ImportanceFunctionConcrete("concrete_lazy", model.global_state()),
+		model_(model),
+		property_(nullptr),
+		maxDistance_(static_cast<ImportanceValue>(0u)),
+		valueMap_(identity),
+		cache_()
+{ /* Not much to do around here */ }
+
+
+ImportanceFunctionConcreteLazy::~ImportanceFunctionConcreteLazy()
+{
+	ImportanceFunctionConcreteLazy::clear();
+}
+
+
+void
+ImportanceFunctionConcreteLazy::set_cache_capacity(const size_t& capacity)
+{
+	if (0ul == capacity)
+		throw_FigException("the importance cache must hold at least one state");
+	cache_.clear(capacity);
+}
+
+
+void
+ImportanceFunctionConcreteLazy::assess_importance(const Property& prop,
+                                                  const std::string& strategy,
+                                                  const PostProcessing& postProc)
+{
+	if ("adhoc" == strategy)
+		throw_FigException("importance function \"" + name() + "\" "
+		                   "doesn't support the \"adhoc\" strategy");
+	else if ("flat" != strategy && "auto" != strategy)
+		throw_FigException("invalid importance assessment strategy \""
+		                   + strategy + "\"");
+    if (hasImportanceInfo_)
+		clear();
+	property_ = &prop;
+	valueMap_ = identity;
+
+	// Only the initial state is searched for now: the rest comes on demand
+	if ("auto" == strategy) {
+		maxDistance_ = UNREACHABLE;
+		maxDistance_ = distance_to_rare(model_.initial_state().to_state_instance(),
+		                                MAX_SEARCH_STATES, false);
+		if (UNREACHABLE == maxDistance_)
+			maxDistance_ = static_cast<ImportanceValue>(0u);
+	}
+	hasImportanceInfo_ = true;
+	strategy_ = strategy;
+	minValue_ = static_cast<ImportanceValue>(0u);
+	initialValue_ = minValue_;
+	maxValue_ = maxDistance_;
+	minRareValue_ = maxValue_;
+
+	// Apply post processing (shift, exponentiation, etc.)
+	auto extrVals = std::vector<ExtremeValues>(
+	                    {std::tie(minValue_, maxValue_, minRareValue_)});
+	if ("flat" != strategy)
+		post_process(postProc, extrVals);
+	minValue_ = std::get<0>(extrVals.front());
+	maxValue_ = std::get<1>(extrVals.front());
+	minRareValue_ = std::get<2>(extrVals.front());
+	initialValue_ = minValue_;  // invariant for auto concrete coupled ifun
+
+	assert(minValue_ <= initialValue_);
+	assert(initialValue_ <= minRareValue_);
+	assert(minRareValue_ <= maxValue_);
+}
+
+
+void
+ImportanceFunctionConcreteLazy::assess_importance(
+	const Property&,
+	const std::string&,
+	const std::vector<std::string>&)
+{
+	throw_FigException("importance function \"" + name() + "\" "
+	                   "doesn't support the \"adhoc\" strategy");
+}
+
+
+void
+ImportanceFunctionConcreteLazy::clear() noexcept
+{
+	cache_.clear();
+	property_ = nullptr;
+	maxDistance_ = static_cast<ImportanceValue>(0u);
+	valueMap_ = identity;
+	ImportanceFunctionConcrete::clear();
+}
+
+
+void
+ImportanceFunctionConcreteLazy::transform_values(
+    const std::function<ImportanceValue(const ImportanceValue&)>& f)
+{
+	// Compose with the current map and forget what was computed with it
+	const auto prevMap(valueMap_);
+	valueMap_ = [prevMap, f] (const ImportanceValue& val) { return f(prevMap(val)); };
+	cache_.clear();
+}
+
+
+ImportanceValue
+ImportanceFunctionConcreteLazy::compute_info(const StateInstance& state) const
+{
+	assert(nullptr != property_);
+	std::vector< StateInstance > path;
+	ImportanceValue dist = distance_to_rare(state, MAX_MISS_STATES, true, &path);
+	if (UNREACHABLE == dist)  // cheap search gave up: settle it for real
+		dist = distance_to_rare(state, MAX_SEARCH_STATES, false, &path);
+	if (path.empty())
+		path.emplace_back(state);  // no rare state close enough
+	ImportanceValue info(static_cast<ImportanceValue>(0u));
+	for (size_t i = 0ul ; i < path.size() ; i++, dist--) {
+		// Every subpath of a shortest path is a shortest path
+		ImportanceValue nodeInfo = valueMap_(dist >= maxDistance_
+		                                     ? static_cast<ImportanceValue>(0u)
+		                                     : maxDistance_ - dist);
+		if (property_->is_stop(path[i]))
+			SET_STOP_EVENT(nodeInfo);
+		if (property_->is_rare(path[i]))
+			SET_RARE_EVENT(nodeInfo);
+		cache_.insert(path[i], nodeInfo);
+		if (0ul == i)
+			info = nodeInfo;
+		if (dist >= maxDistance_)
+			break;  // unreachable rare set: only 'state' is memoized
+	}
+	return info;
+}
+
+
+ImportanceValue
+ImportanceFunctionConcreteLazy::distance_to_rare(const StateInstance& state,
+                                                 const size_t& maxStates,
+                                                 bool giveUp,
+                                                 std::vector<StateInstance>* path) const
+{
+	assert(nullptr != property_);
+	// BFS tree: visited states in visiting order, with their parent and depth
+	std::vector< StateInstance > states(1ul, state);
+	std::vector< size_t > parent(1ul, 0ul);
+	std::vector< ImportanceValue > depth(1ul, static_cast<ImportanceValue>(0u));
+	std::unordered_map< StateInstance, size_t, StateInstanceHash > visited;
+	visited.emplace(state, 0ul);
+
+	for (size_t i = 0ul ; i < states.size() ; i++) {
+		if (property_->is_rare(states[i])) {
+			if (nullptr != path) {
+				path->resize(depth[i]+1ul);
+				for (size_t j = i, k = depth[i]+1ul ; k > 0ul ; j = parent[j])
+					(*path)[--k] = states[j];
+			}
+			return depth[i];
+		}
+		// States farther away than the initial state have null importance
+		if (depth[i]+1ul >= maxDistance_)
+			continue;
+		for (auto& s: model_.adjacent_states(states[i])) {
+			if (end(visited) != visited.find(s))
+				continue;
+			if (states.size() >= maxStates && giveUp)
+				return UNREACHABLE;
+			else if (states.size() >= maxStates)
+				throw_FigException("too many states visited while searching "
+				                   "for the rare set (more than "
+				                   + std::to_string(maxStates) + ")");
+			visited.emplace(s, states.size());
+			states.emplace_back(std::move(s));
+			parent.push_back(i);
+			depth.push_back(depth[i]+1ul);
+		}
+	}
+	return maxDistance_;
+}
+
+
+void
+ImportanceFunctionConcreteLazy::print_out(std::ostream& out,
+                                          State<STATE_INTERNAL_TYPE>) const
+{
+	if (!has_importance_info()) {
+		out << "\nImportance function \"" << name() << "\" doesn't yet have "
+			   "any importance information to print." << std::endl;
+		return;
+	}
+	out << "\nImportance function \"" << name() << "\" computes values on the fly.";
+	out << "\nImportance assessment strategy: " << strategy();
+	out << "\nDistance from the initial state to the rare set: " << maxDistance_;
+	out << "\nCache: " << cache_.size() << " states memoized (capacity "
+	    << cache_.capacity() << "), " << cache_.hits() << " hits, "
+	    << cache_.misses() << " misses" << std::endl;
+}
+
+} // namespace fig  // // // // // // // // // // // // // // // // // // // //
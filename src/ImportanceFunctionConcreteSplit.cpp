@@ -34,6 +34,7 @@
 #include <algorithm>  // find_if_not()
 #include <functional>
 #include <tuple>
+#include <cctype>     // std::isalpha(), std::isdigit()
 // FIG
 #include <ImportanceFunctionConcreteSplit.h>
 #include <ThresholdsBuilder.h>
@@ -62,37 +63,42 @@ typedef std::vector< ExtremeValues > ExtremeValuesVec;
 
 
 /**
- * @brief Increment the next possible ImportanceValue
+ * @brief Tell whether an algebraic formula is monotonically non-decreasing
+ *        on each of its variables
  *
- *        Following the order of the values defined in 'moduleValues',
- *        find the first one which isn't maximal and increment it.
- *        All bypassed values (whose value was maximal) are reset
- *        to their minimal expression. This represents a single increment
- *        in the "concrete value of 'values'".
+ *        This is a syntactic (and thus conservative) check: the formula must
+ *        be built solely from its variables, non-negative numeric literals,
+ *        sums, products, and the "max" and "min" functions.
+ *        Over non-negative values, any such formula is non-decreasing
+ *        on each argument.
  *
- * @return Whether a value could be incremented
+ * @param f Algebraic formula used to compose the modules importance values
+ * @return Whether \p f is (provably) monotonic
  */
-bool advance(const ExtremeValuesVec& moduleValues, ImportanceVec& values)
+bool
+is_monotonic(const Formula& f)
 {
-	unsigned pos(0ul);
-	// Find next value (according to 'moduleValues' order)
-	// which can be incremented
-	for (const auto& e: moduleValues) {
-		if (values[pos] < std::get<1>(e))
-			break;
-		pos++;
+	const std::string expr(f.expression());
+	const auto& varnames(f.get_free_vars());
+	for (size_t i = 0ul ; i < expr.length() ; ) {
+		const char c(expr[i]);
+		if (std::isalpha(c) || '_' == c) {
+			// Identifiers must be variables or monotonic functions
+			size_t j(i);
+			while (j < expr.length() && (std::isalnum(expr[j]) || '_' == expr[j]))
+				j++;
+			const std::string id(expr.substr(i, j-i));
+			if ("max" != id && "min" != id &&
+			        find(begin(varnames), end(varnames), id) == end(varnames))
+				return false;
+			i = j;
+		} else if (std::isdigit(c) || '.' == c || std::isspace(c) ||
+		           '+' == c || '*' == c || '(' == c || ')' == c || ',' == c) {
+			i++;
+		} else {
+			return false;  // subtraction, division, comparisons, ...
+		}
 	}
-	if (pos >= moduleValues.size())
-		return false;
-	// Increment it
-	values[pos]++;
-	// Reset previous values (according to 'moduleValues' order) to minimums
-	unsigned i(0u);
-	for (const auto& e: moduleValues)
-		if (i < pos)
-			values[i++] = std::get<0>(e);
-	        // XXX If you really want the "i++" out of the vector access,
-	        //	 *please* put braces for the scopes of the "for" and the "if"
 	return true;
 }
 
@@ -101,40 +107,86 @@ bool advance(const ExtremeValuesVec& moduleValues, ImportanceVec& values)
  * @brief Find extreme values of given \ref fig::ImportanceFunction::Formula
  *        "algebraic formula"
  *
- *        All possible combination of values in the [min,max] ranges provided
- *        per module are tested. From the resulting evaluations of the Formula
- *        'f' the minimal value is returned as the first component of the tuple,
- *        the maximal value as the second component and the minRare value as
- *        the third component.
+ *        If the formula is \ref is_monotonic() "monotonic" it suffices to
+ *        evaluate it on the minimal and maximal values of the modules.
+ *        Otherwise all possible combination of values in the [min,max] ranges
+ *        provided per module are tested, partitioning the combinations among
+ *        all available threads.
+ *        From the resulting evaluations of the Formula 'f' the minimal value
+ *        is returned as the first component of the tuple, the maximal value
+ *        as the second component and the minRare value as the third component.
  *
- * @param f  Algebraic formula used to compose the modules importance values
+ * @param f   Algebraic formula used to compose the modules importance values
+ * @param pin Routine to set a private copy of 'f' for each thread
  * @param moduleValues Extreme values of every module, i.e. (min, max, minRare)
  *
  * @return (min,max,minRare) evaluations of 'f' for all possible combination
  *         of values from the [min,max] ranges provided per module
  *
+ * @throw FigException if there are too many combinations to test
+ *
  * @note <b>Complexity:</b> too complicated to explain in docstring. Much less
  *                          than <i>O(globalState.concrete_size())</i> anyway.
  */
 ExtremeValues
-find_extreme_values(const Formula& f, const ExtremeValuesVec& moduleValues)
+find_extreme_values(const Formula& f,
+                    const std::function<void(Formula&)>& pin,
+                    const ExtremeValuesVec& moduleValues)
 {
+	const size_t NUM_MODULES(moduleValues.size());
+
+	if (is_monotonic(f)) {
+		ImportanceVec values(NUM_MODULES);
+		for (size_t i = 0ul ; i < NUM_MODULES ; i++)
+			values[i] = std::get<0>(moduleValues[i]);
+		const ImportanceValue min(f(values));
+		for (size_t i = 0ul ; i < NUM_MODULES ; i++)
+			values[i] = std::get<1>(moduleValues[i]);
+		// Play it safe and assume minRareValue_ == minValue_
+		return std::make_tuple(min, f(values), min);
+	}
+
+	// Number of combinations of values to test
+	size_t numCombinations(1ul);
+	for (const auto& e: moduleValues) {
+		const size_t range(std::get<1>(e) - std::get<0>(e) + 1ul);
+		if (numCombinations > std::numeric_limits<size_t>::max() / range)
+			throw_FigException("too many combinations of importance values to "
+			                   "find the extremes of the composition function; "
+			                   "please provide them explicitly");
+		numCombinations *= range;
+	}
+
 	ImportanceValue min(std::numeric_limits<ImportanceValue>::max());
 	ImportanceValue max(std::numeric_limits<ImportanceValue>::min());
-	ImportanceVec values(moduleValues.size());
-
-	// initialise importance values to the minimal value of each Module
-	// Notice the order in 'values' will follow that of 'moduleValues'
-	size_t i(0ul);
-	for (const auto& e: moduleValues)
-		values[i++] = std::get<0>(e);
-
-	// Test all values combinations for the relevant variables
-	do {
-        ImportanceValue imp = f(values);
-        min = std::min(min, imp);
-        max = std::max(max, imp);
-    } while (advance(moduleValues, values));
+
+	#pragma omp parallel default(shared)
+	{
+		Formula localF;  // exprtk expressions can't be shared among threads
+		pin(localF);
+		ImportanceValue localMin(std::numeric_limits<ImportanceValue>::max());
+		ImportanceValue localMax(std::numeric_limits<ImportanceValue>::min());
+		ImportanceVec values(NUM_MODULES);
+		#pragma omp for schedule(static) nowait
+		for (size_t c = 0ul ; c < numCombinations ; c++) {
+			// Decode the c-th combination, following the order of 'moduleValues'
+			size_t code(c);
+			for (size_t i = 0ul ; i < NUM_MODULES ; i++) {
+				const auto& e(moduleValues[i]);
+				const size_t range(std::get<1>(e) - std::get<0>(e) + 1ul);
+				values[i] = std::get<0>(e) + code % range;
+				code /= range;
+			}
+			const ImportanceValue imp = localF(values);
+			localMin = std::min(localMin, imp);
+			localMax = std::max(localMax, imp);
+		}
+		#pragma omp critical (fig_ifun_split_extreme_values)
+		{
+			min = std::min(min, localMin);
+			max = std::max(max, localMax);
+		}
+	}
 	// Play it safe and assume minRareValue_ == minValue_
 	return std::make_tuple(min, max, min);
 
@@ -150,6 +202,7 @@ find_extreme_values(const Formula& f, const ExtremeValuesVec& moduleValues)
  *        for the specified composition strategy and algebraic formula.
  *
  * @param f Algebraic formula used to compose the modules importance values
+ * @param pin Routine to set a private copy of 'f' for each thread
  * @param moduleValues Extreme values (i.e. (min, max, minRare)) of every module
  * @param compStrategy CompositionType used to compose the modules importance values
  *
@@ -161,6 +214,7 @@ find_extreme_values(const Formula& f, const ExtremeValuesVec& moduleValues)
  */
 ExtremeValues
 find_extreme_values(const Formula& f,
+                    const std::function<void(Formula&)>& pin,
                     const ExtremeValuesVec& moduleValues,
 					const CompositionType& compStrategy)
 {
@@ -219,7 +273,7 @@ find_extreme_values(const Formula& f,
 		break;
 
 	case CompositionType::AD_HOC:
-        return find_extreme_values(f, moduleValues);
+        return find_extreme_values(f, pin, moduleValues);
 
 	default:
 		throw_FigException("unrecognized composition function strategy: "
@@ -342,20 +396,7 @@ ImportanceFunctionConcreteSplit::importance_of(const StateInstance& state) const
 	assert(localStatesCopies_.size() == numModules_);
 	assert(modulesConcreteImportance.size() == numModules_);
 #endif
-	for (size_t i = 0ul ; i < numModules_ ; i++) {
-		if (!isRelevant_[i]) {
-			localValues_[i] = neutralElement_;
-		} else {
-			auto& localState = localStatesCopies_[i];
-#ifndef NDEBUG
-			localState.extract_from_state_instance(state, globalVarsIPos.at(i), true);
-#else
-			localState.extract_from_state_instance(state, globalVarsIPos[i], false);
-#endif
-			localValues_[i] = UNMASK(modulesConcreteImportance[i][localState.encode()]);
-		}
-	}
-	return userFun_(localValues_);
+	return compose_importance(state, userFun_, localStatesCopies_, localValues_);
 }
 
 
@@ -409,6 +450,78 @@ ImportanceFunctionConcreteSplit::print_out(std::ostream& out,
 }
 
 
+void
+ImportanceFunctionConcreteSplit::pin_composition_fun(Formula& f) const
+{
+	std::vector< std::string > modulesNames(numModules_);
+	PositionsMap modulesMap;
+	modulesMap.reserve(numModules_);
+	for (size_t i=0ul ; i < numModules_ ; i++) {
+		const std::string& name = modules_[i]->name;
+		modulesNames[i] = name;
+		modulesMap[name] = i;
+	}
+	f.set(userFun_.expression(), modulesNames, modulesMap);
+}
+
+
+void
+ImportanceFunctionConcreteSplit::scan_extreme_values(const Property& property)
+{
+	if (globalStateCopy.concrete_size().upper() > 0ul)
+		throw_FigException("state is too big to perform this search; "
+						   "cowardly aborting");
+
+	const size_t NUM_CONCRETE_STATES(globalStateCopy.concrete_size().lower());
+	ImportanceValue minI = std::numeric_limits<ImportanceValue>::max();
+	ImportanceValue maxI = std::numeric_limits<ImportanceValue>::min();
+	ImportanceValue minrI = std::numeric_limits<ImportanceValue>::max();
+
+	#pragma omp parallel default(shared)
+	{
+		// Private copies of everything importance_of() would modify
+		Formula f;
+		pin_composition_fun(f);
+		State< STATE_INTERNAL_TYPE > state(globalStateCopy);
+		std::vector< State< STATE_INTERNAL_TYPE > > localStates(localStatesCopies_);
+		ImportanceVec localValues(numModules_);
+		ImportanceValue localMinI = std::numeric_limits<ImportanceValue>::max();
+		ImportanceValue localMaxI = std::numeric_limits<ImportanceValue>::min();
+		ImportanceValue localMinrI = std::numeric_limits<ImportanceValue>::max();
+		#pragma omp for schedule(static) nowait
+		for (size_t i = 0ul ; i < NUM_CONCRETE_STATES ; i++) {
+			const StateInstance symbState = state.decode(i).to_state_instance();
+			const ImportanceValue importance =
+			    compose_importance(symbState, f, localStates, localValues);
+			localMinI = std::min(localMinI, importance);
+			localMaxI = std::max(localMaxI, importance);
+			// Rarity is only relevant (and costly) if it'd lower minrI
+			if (importance < localMinrI) {
+				bool isRare;
+				#pragma omp critical (fig_ifun_split_property)
+				isRare = property.is_rare(symbState);  // not thread safe
+				if (isRare)
+					localMinrI = importance;
+				/// @bug FIXME This rare state may be unreachable; how to know?
+			}
+		}
+		#pragma omp critical (fig_ifun_split_extreme_values)
+		{
+			minI = std::min(minI, localMinI);
+			maxI = std::max(maxI, localMaxI);
+			minrI = std::min(minrI, localMinrI);
+		}
+	}
+
+	assert(minI <= minrI);
+	assert(minrI <= maxI);
+
+	minValue_ = minI;
+	maxValue_ = maxI;
+	minRareValue_ = minrI;
+}
+
+
 void
 ImportanceFunctionConcreteSplit::set_DFT(bool isDFT)
 {
@@ -574,11 +687,14 @@ ImportanceFunctionConcreteSplit::assess_importance(const Property& prop,
 	} else if (globalStateCopy.concrete_size() > uint128::uint128_0 &&
 			   globalStateCopy.concrete_size() < (1ul<<20ul)) {
 		// A brute force, full-state-space scan is affordable
-		find_extreme_values(globalStateCopy, prop);
+		scan_extreme_values(prop);
 	} else {
 		// Concrete state space is too big, resort to smarter ways
 		std::tie(minValue_, maxValue_, minRareValue_) =
-				::find_extreme_values(userFun_, moduleValues, compositionStrategy_);
+				::find_extreme_values(userFun_,
+		                              [this] (Formula& f) { pin_composition_fun(f); },
+		                              moduleValues,
+		                              compositionStrategy_);
 
 	}
 	initialValue_ = importance_of(systemInitialValuation);
@@ -0,0 +1,321 @@
+//==============================================================================
+//
+//  ImportanceMDD.cpp
+//
+//  Copyleft 2026-
+//  Authors:
+//  - The FIG contributors
+//
+//------------------------------------------------------------------------------
+//
+//  This file is part of FIG.
+//
+//  The Finite Improbability Generator (FIG) project is free software;
+//  you can redistribute it and/or modify it under the terms of the GNU
+//  General Public License as published by the Free Software Foundation;
+//  either version 3 of the License, or (at your option) any later version.
+//
+//  FIG is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with FIG; if not, write to the Free Software Foundation,
+//	Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//==============================================================================
+
+
+// C++
+#include <limits>
+#include <iterator>   // std::begin(), std::end()
+#include <algorithm>  // std::sort(), std::adjacent_find()
+#include <unordered_map>
+// FIG
+#include <ImportanceMDD.h>
+#include <FigException.h>
+
+// ADL
+using std::begin;
+using std::end;
+
+
+namespace  // // // // // // // // // // // // // // // // // // // // // // //
+{
+
+using fig::ImportanceMDD;
+using fig::ImportanceValue;
+typedef ImportanceMDD::NodeId NodeId;
+typedef std::vector< ImportanceMDD::Entry >::const_iterator EntryIt;
+
+/// Hash for the children of a node, used for hash-consing
+struct ChildrenHash
+{
+	size_t operator()(const std::vector< NodeId >& children) const noexcept
+	{
+		size_t seed(children.size());
+		for (const auto& c: children)  // boost::hash_combine
+			seed ^= std::hash<NodeId>()(c) + 0x9e3779b9 + (seed<<6) + (seed>>2);
+		return seed;
+	}
+};
+
+/**
+ * @brief Bottom-up construction of a quasi-reduced ImportanceMDD
+ *
+ *        Nodes are created level by level and shared whenever a node
+ *        with identical children already exists in the same level.
+ *        Tables used for hash-consing are released on destruction.
+ */
+class MDDBuilder
+{
+	const std::vector< size_t >& width_;
+	const std::vector< fig::STATE_INTERNAL_TYPE >& offset_;
+	std::vector< std::vector< NodeId > >& children_;
+	fig::ImportanceVec& terminals_;
+	std::vector< std::unordered_map< std::vector< NodeId >, NodeId, ChildrenHash > > unique_;
+	std::unordered_map< ImportanceValue, NodeId > uniqueTerminal_;
+	std::vector< NodeId > defaultNode_;
+
+public:
+
+	MDDBuilder(const std::vector< size_t >& width,
+	           const std::vector< fig::STATE_INTERNAL_TYPE >& offset,
+	           std::vector< std::vector< NodeId > >& children,
+	           fig::ImportanceVec& terminals,
+	           const ImportanceValue& defaultValue) :
+		width_(width),
+		offset_(offset),
+		children_(children),
+		terminals_(terminals),
+		unique_(width.size()),
+		defaultNode_(width.size()+1ul)
+	{
+		// Chain of nodes representing the constant default value
+		defaultNode_.back() = terminal(defaultValue);
+		for (long l = static_cast<long>(width_.size())-1l ; l >= 0l ; l--)
+			defaultNode_[l] = node(l, std::vector<NodeId>(width_[l], defaultNode_[l+1]));
+	}
+
+	/// Node for the terminal value 'val'
+	NodeId terminal(const ImportanceValue& val)
+	{
+		auto it = uniqueTerminal_.find(val);
+		if (end(uniqueTerminal_) != it)
+			return it->second;
+		check_capacity(terminals_.size());
+		const NodeId id(static_cast<NodeId>(terminals_.size()));
+		terminals_.push_back(val);
+		uniqueTerminal_.emplace(val, id);
+		return id;
+	}
+
+	/// Node of level 'l' with the given children
+	NodeId node(const size_t& l, std::vector< NodeId >&& children)
+	{
+		assert(children.size() == width_[l]);
+		auto it = unique_[l].find(children);
+		if (end(unique_[l]) != it)
+			return it->second;
+		check_capacity(children_[l].size() / width_[l]);
+		const NodeId id(static_cast<NodeId>(children_[l].size() / width_[l]));
+		children_[l].insert(end(children_[l]), begin(children), end(children));
+		unique_[l].emplace(std::move(children), id);
+		return id;
+	}
+
+	/// Node of level 'l' for the (sorted) entries in [first,last)
+	NodeId build(const size_t& l, EntryIt first, EntryIt last)
+	{
+		if (first == last)
+			return defaultNode_[l];
+		if (width_.size() == l) {
+			assert(std::distance(first, last) == 1l);
+			return terminal(first->second);
+		}
+		std::vector< NodeId > children(width_[l], defaultNode_[l+1]);
+		while (first != last) {
+			const auto val(first->first[l]);
+			auto groupEnd(first);
+			while (groupEnd != last && groupEnd->first[l] == val)
+				groupEnd++;
+			children[val-offset_[l]] = build(l+1, first, groupEnd);
+			first = groupEnd;
+		}
+		return node(l, std::move(children));
+	}
+
+	/// Node of level 'l' combining node 'a' of 'mddA' with node 'b' of 'mddB'
+	/// through 'op', memoized per level in 'memo'
+	template< typename BinaryOp >
+	NodeId combine(const size_t& l,
+	               const NodeId& a,
+	               const NodeId& b,
+	               const std::vector< std::vector< NodeId > >& childrenA,
+	               const fig::ImportanceVec& terminalsA,
+	               const std::vector< std::vector< NodeId > >& childrenB,
+	               const fig::ImportanceVec& terminalsB,
+	               const BinaryOp& op,
+	               std::vector< std::unordered_map< unsigned long, NodeId > >& memo)
+	{
+		if (width_.size() == l)
+			return terminal(op(terminalsA[a], terminalsB[b]));
+		const unsigned long key((static_cast<unsigned long>(a) << 32ul) | b);
+		auto it = memo[l].find(key);
+		if (end(memo[l]) != it)
+			return it->second;
+		std::vector< NodeId > children(width_[l]);
+		for (size_t j = 0ul ; j < width_[l] ; j++)
+			children[j] = combine(l+1, childrenA[l][a*width_[l]+j],
+			                      childrenB[l][b*width_[l]+j], childrenA,
+			                      terminalsA, childrenB, terminalsB, op, memo);
+		const NodeId id(node(l, std::move(children)));
+		memo[l].emplace(key, id);
+		return id;
+	}
+
+private:
+
+	static void check_capacity(const size_t& numNodes)
+	{
+		if (numNodes >= std::numeric_limits<NodeId>::max())
+			throw_FigException("decision diagram grew too big (more than "
+			                   + std::to_string(std::numeric_limits<NodeId>::max())
+			                   + " nodes in a single level)");
+	}
+};
+
+} // namespace  // // // // // // // // // // // // // // // // // // // // //
+
+
+
+namespace fig  // // // // // // // // // // // // // // // // // // // // // //
+{
+
+size_t
+ImportanceMDD::num_nodes() const noexcept
+{
+	size_t numNodes(0ul);
+	for (size_t l = 0ul ; l < children_.size() ; l++)
+		numNodes += children_[l].size() / width_[l];
+	return numNodes;
+}
+
+
+void
+ImportanceMDD::build(const State<STATE_INTERNAL_TYPE>& state,
+                     std::vector< Entry >& entries,
+                     const ImportanceValue& defaultValue)
+{
+	if (state.empty())
+		throw_FigException("can't build a decision diagram without variables");
+	clear();
+
+	// Levels follow the variables of the state
+	const size_t NUM_LEVELS(state.size());
+	offset_.reserve(NUM_LEVELS);
+	width_.reserve(NUM_LEVELS);
+	for (size_t l = 0ul ; l < NUM_LEVELS ; l++) {
+		offset_.emplace_back(state[l]->min());
+		width_.emplace_back(state[l]->range());
+	}
+	children_.resize(NUM_LEVELS);
+
+	// Check the valuations before building anything
+	for (const auto& e: entries)
+		if (!state.is_valid_state_instance(e.first))
+			throw_FigException("invalid valuation for the decision diagram");
+	std::sort(begin(entries), end(entries));
+	if (end(entries) != std::adjacent_find(begin(entries), end(entries),
+	                                       [] (const Entry& e1, const Entry& e2)
+	                                       { return e1.first == e2.first; }))
+		throw_FigException("repeated valuation for the decision diagram");
+
+	// Build bottom-up, sharing isomorphic sub-diagrams
+	MDDBuilder builder(width_, offset_, children_, terminals_, defaultValue);
+	root_ = builder.build(0ul, begin(entries), end(entries));
+	for (auto& level: children_)
+		level.shrink_to_fit();
+	terminals_.shrink_to_fit();
+}
+
+
+void
+ImportanceMDD::apply(const ImportanceMDD& that,
+                     const std::function<ImportanceValue(const ImportanceValue&,
+                                                         const ImportanceValue&)>& op)
+{
+	if (empty() || that.empty())
+		throw_FigException("can't combine empty decision diagrams");
+	if (width_ != that.width_ || offset_ != that.offset_)
+		throw_FigException("can't combine decision diagrams "
+		                   "built for different states");
+
+	// Build the result from scratch: nodes of the operands that become
+	// unreachable are thus dropped, and the invariants on the default
+	// value and the first node of each level are kept
+	std::vector< std::vector< NodeId > > children(children_.size());
+	ImportanceVec terminals;
+	std::vector< std::unordered_map< unsigned long, NodeId > > memo(children_.size());
+	{
+		MDDBuilder builder(width_, offset_, children, terminals,
+		                   op(terminals_.front(), that.terminals_.front()));
+		root_ = builder.combine(0ul, root_, that.root_,
+		                        children_, terminals_,
+		                        that.children_, that.terminals_,
+		                        op, memo);
+	}
+	std::swap(children_, children);
+	std::swap(terminals_, terminals);
+	for (auto& level: children_)
+		level.shrink_to_fit();
+	terminals_.shrink_to_fit();
+}
+
+
+void
+ImportanceMDD::for_each(const std::function<void(const StateInstance&,
+                                                 const ImportanceValue&)>& visit) const
+{
+	if (empty())
+		return;
+	StateInstance s(children_.size());
+	std::function<void(const size_t&, const NodeId&)> visit_node =
+	    [&] (const size_t& l, const NodeId& node) {
+		if (children_.size() == l) {
+			visit(s, terminals_[node]);
+			return;
+		}
+		for (size_t j = 0ul ; j < width_[l] ; j++) {
+			const NodeId child(children_[l][node*width_[l]+j]);
+			if (0u == child)
+				continue;  // constantly mapped to the default value
+			s[l] = offset_[l] + static_cast<STATE_INTERNAL_TYPE>(j);
+			visit_node(l+1, child);
+		}
+	};
+	if (0u != root_)
+		visit_node(0ul, root_);
+}
+
+
+void
+ImportanceMDD::transform(const std::function<ImportanceValue(const ImportanceValue&)>& f)
+{
+	for (ImportanceValue& val: terminals_)
+		val = f(val);
+}
+
+
+void
+ImportanceMDD::clear() noexcept
+{
+	std::vector< STATE_INTERNAL_TYPE >().swap(offset_);
+	std::vector< size_t >().swap(width_);
+	std::vector< std::vector< NodeId > >().swap(children_);
+	ImportanceVec().swap(terminals_);
+	root_ = 0u;
+}
+
+} // namespace fig  // // // // // // // // // // // // // // // // // // // //
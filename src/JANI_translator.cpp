@@ -480,8 +480,7 @@ build_IOSA_model_from_AST(Model& modelAST,
 		return false;
 	}
 	// Check IOSA compliance if requested
-	if (verifyIOSA &&
-	        ModuleScope::modules_size_bounded_by(ModelVerifier::NTRANS_BOUND)) {
+	if (verifyIOSA) {
 		ModelVerifier verifier;
 		modelAST.accept(verifier);
 		if (verifier.has_errors() || verifier.has_warnings()) {
@@ -5,7 +5,9 @@
 
 // C++
 #include <cstdlib>
+#include <cstddef>  // std::max_align_t
 #include <cstring>
+#include <unordered_set>
 // fig
 #include <ModelAST.h>
 #include <ModelParser.hpp>
@@ -16,12 +18,44 @@ using std::shared_ptr;
 using std::static_pointer_cast;
 using fig::figTechLog;
 
+const string& Identifier::intern(const string& str) {
+	// node-based container: references to its elements are stable
+	static std::unordered_set<string> table;
+	return *table.insert(str).first;
+}
+
+std::shared_ptr<ASTArena>& ASTArena::current_arena() noexcept {
+	static thread_local std::shared_ptr<ASTArena> arena(nullptr);
+	return arena;
+}
+
+void* ASTArena::allocate(size_t size, size_t alignment) {
+	assert(0ul < alignment && 0ul == (alignment & (alignment-1ul)));
+	assert(alignment <= alignof(std::max_align_t));
+	if (size > BLOCK_SIZE/4ul) {
+		// big request: give it a block of its own, before the one being filled
+		std::unique_ptr<char[]> block(new char[size]);
+		void* ptr(block.get());
+		blocks_.emplace(blocks_.empty() ? blocks_.end() : blocks_.end()-1,
+		                std::move(block));
+		return ptr;
+	}
+	size_t offset((used_ + alignment - 1ul) & ~(alignment - 1ul));
+	if (offset + size > BLOCK_SIZE) {
+		blocks_.emplace_back(new char[BLOCK_SIZE]);
+		offset = 0ul;
+	}
+	used_ = offset + size;
+	return blocks_.back().get() + offset;
+}
+
 void ModelAST::accept(Visitor &visit) {
     visit.visit(shared_from_this());
 }
 
 shared_ptr<ModelAST> ModelAST::from_files(const std::string& model_file,
                                           const std::string& prop_file) {
+	ASTArena::Scope arena;  // allocate the nodes parsed in a fresh arena
 	shared_ptr<ModelAST> result = nullptr;
 	ModelParserGen::ModelParser parser {&result};
 	int res(1);
@@ -396,7 +396,7 @@ void ModelBuilder::visit(shared_ptr<ClockDecl> decl) {
     module_clocks->push_back(build_clock(decl->get_id()));
 }
 
-Label build_label(string&& id, LabelType type) {
+Label build_label(const string& id, LabelType type) {
     switch(type) {
     case LabelType::in : return Label::make_input(id);
     case LabelType::out: return Label::make_output(id);
@@ -409,7 +409,7 @@ Label build_label(string&& id, LabelType type) {
 
 void ModelBuilder::visit(shared_ptr<TransitionAST> action) {
 	assert(nullptr != current_module);
-	Label label = build_label(action->get_label(),  // rely on copy elision!
+	Label label = build_label(action->get_label(),
 	                          action->get_label_type());
     //Transition constructor expects the id of the triggering
     //clock,  let's get it:
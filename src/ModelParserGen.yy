@@ -28,7 +28,6 @@
 #include "Util.h"
 
     using std::shared_ptr;
-    using std::make_shared;
     using std::static_pointer_cast;
     
 //definition YY_DECL should be available also for ModelScannerGen.ll
@@ -173,12 +172,12 @@ begin: model[m] {*result = $m; save_location(*result, @m);}
 }
 
 model: decl[d] ";"
-{$$ = make_shared<Model>($d); save_location($$, @$);}
+{$$ = make_node<Model>($d); save_location($$, @$);}
 | model[m] decl[d] ";"
 {$m->add_decl($d); $$ = $m; save_location($$, @$);}
 | "module" "id"[id] module[b] "endmodule"
 {$b->set_name($id);
-    $$ = make_shared<Model>($b); save_location($$, @$);}
+    $$ = make_node<Model>($b); save_location($$, @$);}
 | model[m] "module" "id"[id] module[b] "endmodule"
 {
     string &id = $id;
@@ -195,11 +194,11 @@ model: decl[d] ";"
 }
 
 prop: "P" "(" exp[l] "U" exp[r] ")" 
-{ $$ = make_shared<TransientProp>($l, $r); save_location($$, @$);}
+{ $$ = make_node<TransientProp>($l, $r); save_location($$, @$);}
 | "S" "(" exp[r] ")"
-{ $$ = make_shared<RateProp>($r); save_location($$, @$);}
+{ $$ = make_node<RateProp>($r); save_location($$, @$);}
 | "S" "[" exp[l] ":" exp[u] "]" "(" exp[r] ")"
-{ $$ = make_shared<TBoundSSProp>($l,$u,$r); save_location($$, @$);}
+{ $$ = make_node<TBoundSSProp>($l,$u,$r); save_location($$, @$);}
 
 proplist: prop[p]
 { $$ = vector<shared_ptr<Prop>>{$p};}
@@ -215,9 +214,9 @@ type: "int"
 
 
 module: decl[d] ";"
-{$$ = make_shared<ModuleAST>($d); save_location($$, @$);}
+{$$ = make_node<ModuleAST>($d); save_location($$, @$);}
 | transition[a] ";"
-{$$ = make_shared<ModuleAST>($a);}
+{$$ = make_node<ModuleAST>($a);}
 | module[mb] decl[d] ";"
 {$mb->add_decl($d); $$ = $mb; save_location($$, @$);}
 | module[mb] transition[a] ";"
@@ -239,27 +238,27 @@ decl: qualifierlist[ql] decl_body[d] {
 
 decl_body:
 "id"[id] ":" "[" exp[low] ".." exp[upper] "]"
-{$$ = make_shared<RangedDecl>($id, $low, $upper); save_location($$, @$);}
+{$$ = make_node<RangedDecl>($id, $low, $upper); save_location($$, @$);}
 | "id"[id] ":" "[" exp[low] ".." exp[upper] "]" "init" exp[e]
-{$$ = make_shared<RangedDecl>($id, $low, $upper, $e);
+{$$ = make_node<RangedDecl>($id, $low, $upper, $e);
     save_location($$, @$);}
 | "id"[id] ":" type[t] "init" exp[e]
-{$$ = make_shared<InitializedDecl>($t, $id, $e); save_location($$, @$);}
+{$$ = make_node<InitializedDecl>($t, $id, $e); save_location($$, @$);}
 | type[t] "id"[id] "=" exp[e]
-{$$ = make_shared<InitializedDecl>($t, $id, $e); save_location($$, @$);}
+{$$ = make_node<InitializedDecl>($t, $id, $e); save_location($$, @$);}
 | "id"[id] ":" "clock"
-{$$ = make_shared<ClockDecl>($id); save_location($$, @$);}
+{$$ = make_node<ClockDecl>($id); save_location($$, @$);}
 | "id"[id] "[" exp[size] "]" ":"
 "[" exp[lower] ".." exp[upper] "]" "init" exp[e]
-{$$ = make_shared<RangedInitializedArray>($id, $size, $lower, $upper, $e);}
+{$$ = make_node<RangedInitializedArray>($id, $size, $lower, $upper, $e);}
 | "id"[id] "[" exp[size] "]" ":"
 "[" exp[lower] ".." exp[upper] "]" "init" "{" exp_seq[seq] "}"
-{$$ = make_shared<RangedMultipleInitializedArray>
+{$$ = make_node<RangedMultipleInitializedArray>
             ($id, $size, $lower, $upper, $seq);}
 | "id"[id] "[" exp[size] "]" ":" type[t] "init" exp[e]
-{$$ = make_shared<InitializedArray>($t, $id, $size, $e);}
+{$$ = make_node<InitializedArray>($t, $id, $size, $e);}
 | "id"[id] "[" exp[size] "]" ":" type[t] "init" "{" exp_seq[seq] "}"
-{$$ = make_shared<MultipleInitializedArray>($t, $id, $size, $seq);}
+{$$ = make_node<MultipleInitializedArray>($t, $id, $size, $seq);}
 
 exp_seq: exp_seq[es] "," exp[e]
 {$$ = concat($es, shared_vector<Exp>{$e});}
@@ -267,74 +266,74 @@ exp_seq: exp_seq[es] "," exp[e]
 {$$ = shared_vector<Exp>{$e};}
 
 transition: "[" "id"[id] "?" "]" guard[e] "->" effects[eff]
-{$$ = make_shared<InputTransition>($id, $e, $eff);
+{$$ = make_node<InputTransition>($id, $e, $eff);
 save_location($$, @$);}
 | "[" "id"[id] "!" "]" guard[e] "@" location[loc] "->" effects[eff]
-{$$ = make_shared<OutputTransition>($id, $e, $eff, $loc);
+{$$ = make_node<OutputTransition>($id, $e, $eff, $loc);
     save_location($$, @$);}
 | "[" "]" guard[e] "@" location[loc] "->" effects[eff]
-{$$ = make_shared<TauTransition>($e, $eff, $loc);
+{$$ = make_node<TauTransition>($e, $eff, $loc);
     save_location($$, @$);}
 | "[" "_" "?" "]" guard[e]  "->" effects[eff]
-{$$ = make_shared<WildcardInputTransition>($e, $eff);
+{$$ = make_node<WildcardInputTransition>($e, $eff);
     save_location($$, @$);}
 | "[" "id"[id] "!" "!" "]" guard[e] "->" effects[eff]
-{$$ = make_shared<OutputCommittedTransition>($id, $e, $eff);
+{$$ = make_node<OutputCommittedTransition>($id, $e, $eff);
     save_location($$, @$);}
 | "[" "id" [id] "?" "?" "]" guard[e] "->" effects[eff]
-{$$ = make_shared<InputCommittedTransition>($id, $e, $eff); };
+{$$ = make_node<InputCommittedTransition>($id, $e, $eff); };
 
 
 guard: %empty
-{$$ = make_shared<BConst>(true); save_location($$, @$);}
+{$$ = make_node<BConst>(true); save_location($$, @$);}
 | exp[e]
 {$$ = $e;}
 
 effects: %empty
 {$$ = shared_vector<Effect>(); }
 |"(" location[loc] "'" "=" exp[e] ")"
-{$$ = shared_vector<Effect>{make_shared<Assignment>($loc, $e)};}
+{$$ = shared_vector<Effect>{make_node<Assignment>($loc, $e)};}
 | "(" location[loc] "'" "=" dist[d] ")"
-{$$ = shared_vector<Effect>{make_shared<ClockReset>($loc, $d)};}
+{$$ = shared_vector<Effect>{make_node<ClockReset>($loc, $d)};}
 | effects[e1] "&" effects[e2]
 {$$ = concat($e1, $e2);}
 
 dist: "erlang" "(" exp[e1] "," exp[e2] ")"
-{$$ = make_shared<MultipleParameterDist>(DistType::erlang, $e1, $e2);
+{$$ = make_node<MultipleParameterDist>(DistType::erlang, $e1, $e2);
 save_location($$, @$);}
 | "normal" "(" exp[e1] "," exp[e2] ")"
-{$$ = make_shared<MultipleParameterDist>(DistType::normal, $e1, $e2);
+{$$ = make_node<MultipleParameterDist>(DistType::normal, $e1, $e2);
     save_location($$, @$);}
 | "uniform" "(" exp[e1] "," exp[e2] ")"
-{$$ = make_shared<MultipleParameterDist>(DistType::uniform, $e1, $e2);
+{$$ = make_node<MultipleParameterDist>(DistType::uniform, $e1, $e2);
     save_location($$, @$);}
 | "exponential" "(" exp[e] ")"
-{$$ = make_shared<SingleParameterDist>(DistType::exponential, $e);
+{$$ = make_node<SingleParameterDist>(DistType::exponential, $e);
     save_location($$, @$);}
 | "hyperexponential2" "(" exp[e1] "," exp[e2] "," exp[e3] ")"
-{$$ = make_shared<MultipleParameterDist>(DistType::hyperexponential2, $e1, $e2, $e3);
+{$$ = make_node<MultipleParameterDist>(DistType::hyperexponential2, $e1, $e2, $e3);
 	save_location($$, @$);}
 | "lognormal" "(" exp[e1] "," exp[e2] ")"
-{$$ = make_shared<MultipleParameterDist>(DistType::lognormal, $e1, $e2);
+{$$ = make_node<MultipleParameterDist>(DistType::lognormal, $e1, $e2);
     save_location($$, @$);}
 | "weibull" "(" exp[e1] "," exp[e2] ")"
-{$$ = make_shared<MultipleParameterDist>(DistType::weibull, $e1, $e2);
+{$$ = make_node<MultipleParameterDist>(DistType::weibull, $e1, $e2);
     save_location($$, @$);}
 | "gamma" "(" exp[e1] "," exp[e2] ")"
-{$$ = make_shared<MultipleParameterDist>(DistType::gamma, $e1, $e2);
+{$$ = make_node<MultipleParameterDist>(DistType::gamma, $e1, $e2);
     save_location($$, @$);}
 | "rayleigh" "(" exp[e] ")"
-{$$ = make_shared<SingleParameterDist>(DistType::rayleigh, $e);
+{$$ = make_node<SingleParameterDist>(DistType::rayleigh, $e);
 	save_location($$, @$);}
 | "dirac" "(" exp[e] ")"
-{$$ = make_shared<SingleParameterDist>(DistType::dirac, $e);
+{$$ = make_node<SingleParameterDist>(DistType::dirac, $e);
     save_location($$, @$);}
 
 location: "id"[id]
-{$$ = make_shared<Location>($id);
+{$$ = make_node<Location>($id);
     save_location($$, @$);}
 | "id"[id] "[" exp[e] "]"
-{$$ = make_shared<ArrayPosition>($id, $e);
+{$$ = make_node<ArrayPosition>($id, $e);
     save_location($$, @$);}
 		 
 // Note on expressions types: a separation between int-exp and bool-exp
@@ -347,177 +346,177 @@ location: "id"[id]
 // That should be checked during type-checking.
 
 exp : location[loc]
-{$$ = make_shared<LocExp>($loc); save_location($$, @$);}
+{$$ = make_node<LocExp>($loc); save_location($$, @$);}
 | INTL[i]
-{$$ = make_shared<IConst>($i); save_location($$, @$);}
+{$$ = make_node<IConst>($i); save_location($$, @$);}
 | FLOATL[i]
-{$$ = make_shared<FConst>($i); save_location($$, @$);}
+{$$ = make_node<FConst>($i); save_location($$, @$);}
 | "true"
-{$$ = make_shared<BConst>(true); save_location($$, @$);}
+{$$ = make_node<BConst>(true); save_location($$, @$);}
 | "false"
-{$$ = make_shared<BConst>(false); save_location($$, @$);}
+{$$ = make_node<BConst>(false); save_location($$, @$);}
 | exp[e1] "+" exp[e2]
 {
-    $$ = make_shared<BinOpExp>(ExpOp::plus, $e1, $e2);
+    $$ = make_node<BinOpExp>(ExpOp::plus, $e1, $e2);
     save_location($$, @$);
 }
 | exp[e1] "-" exp[e2]
 {
-    $$ = make_shared<BinOpExp>(ExpOp::minus, $e1, $e2);
+    $$ = make_node<BinOpExp>(ExpOp::minus, $e1, $e2);
     save_location($$, @$);
 }
 | exp[e1] "/" exp[e2]
 {
-    $$ = make_shared<BinOpExp>(ExpOp::div, $e1, $e2);
+    $$ = make_node<BinOpExp>(ExpOp::div, $e1, $e2);
     save_location($$, @$);
 }
 | exp[e1] "*" exp[e2]
 {
-    $$ = make_shared<BinOpExp>(ExpOp::times, $e1, $e2);
+    $$ = make_node<BinOpExp>(ExpOp::times, $e1, $e2);
     save_location($$, @$);
 }
 | exp[e1] "%" exp[e2]
 {
-    $$ = make_shared<BinOpExp>(ExpOp::mod, $e1, $e2);
+    $$ = make_node<BinOpExp>(ExpOp::mod, $e1, $e2);
     save_location($$, @$);
 }
 | exp[e1] "==" exp[e2]
 {
-    $$ = make_shared<BinOpExp>(ExpOp::eq, $e1, $e2);
+    $$ = make_node<BinOpExp>(ExpOp::eq, $e1, $e2);
     save_location($$, @$);
 }
 | exp[e1] "!=" exp[e2]
 {
-    $$ = make_shared<BinOpExp>(ExpOp::neq, $e1, $e2);
+    $$ = make_node<BinOpExp>(ExpOp::neq, $e1, $e2);
     save_location($$, @$);
 }
 | exp[e1] "<" exp[e2]
 {
-    $$ = make_shared<BinOpExp>(ExpOp::lt, $e1, $e2);
+    $$ = make_node<BinOpExp>(ExpOp::lt, $e1, $e2);
     save_location($$, @$);
 }
 | exp[e1] ">" exp[e2]
 {
-    $$ = make_shared<BinOpExp>(ExpOp::gt, $e1, $e2);
+    $$ = make_node<BinOpExp>(ExpOp::gt, $e1, $e2);
     save_location($$, @$);
 }
 | exp[e1] "<=" exp[e2]
 {
-    $$ = make_shared<BinOpExp>(ExpOp::le, $e1, $e2);
+    $$ = make_node<BinOpExp>(ExpOp::le, $e1, $e2);
     save_location($$, @$);
 }
 | exp[e1] ">=" exp[e2]
 {
-    $$ =  make_shared<BinOpExp>(ExpOp::ge, $e1, $e2);
+    $$ =  make_node<BinOpExp>(ExpOp::ge, $e1, $e2);
     save_location($$, @$);
 }
 | exp[e1] "&" exp[e2]
 {
-    $$ = make_shared<BinOpExp>(ExpOp::andd, $e1, $e2);
+    $$ = make_node<BinOpExp>(ExpOp::andd, $e1, $e2);
     save_location($$, @$);
 }
 | exp[e1] "=>" exp[e2]
 {
-    $$ = make_shared<BinOpExp>(ExpOp::implies, $e1, $e2);
+    $$ = make_node<BinOpExp>(ExpOp::implies, $e1, $e2);
     save_location($$, @$);
 }
 | exp[e1] "|" exp[e2]
 {
-    $$ = make_shared<BinOpExp>(ExpOp::orr, $e1, $e2);
+    $$ = make_node<BinOpExp>(ExpOp::orr, $e1, $e2);
     save_location($$, @$);
 }
 | "log" "(" exp[e1] "," exp[e2] ")"
-{$$ = make_shared<BinOpExp>(ExpOp::log, $e1, $e2);
+{$$ = make_node<BinOpExp>(ExpOp::log, $e1, $e2);
     save_location($$, @$);}
 | "pow" "(" exp[e1] "," exp[e2] ")"
 {
-    $$ = make_shared<BinOpExp>(ExpOp::pow, $e1, $e2);
+    $$ = make_node<BinOpExp>(ExpOp::pow, $e1, $e2);
     save_location($$, @$);
 }
 | "min" "(" exp[e1] "," exp[e2] ")"
 {
-    $$ = make_shared<BinOpExp>(ExpOp::min, $e1, $e2);
+    $$ = make_node<BinOpExp>(ExpOp::min, $e1, $e2);
     save_location($$, @$);
 }
 | "max" "(" exp[e1] "," exp[e2] ")"
 {
-    $$ = make_shared<BinOpExp>(ExpOp::max, $e1, $e2);
+    $$ = make_node<BinOpExp>(ExpOp::max, $e1, $e2);
     save_location($$, @$);
 }
 | "-" exp[e] %prec UMINUS
 {
-    $$ = make_shared<UnOpExp>(ExpOp::minus, $e);
+    $$ = make_node<UnOpExp>(ExpOp::minus, $e);
     save_location($$, @$);
 }
 | "!" exp[e] %prec NEG
 {
-    $$ = make_shared<UnOpExp>(ExpOp::nott, $e);
+    $$ = make_node<UnOpExp>(ExpOp::nott, $e);
     save_location($$, @$);
 }
 | "floor" exp[e] %prec UMINUS
-{$$ = make_shared<UnOpExp>(ExpOp::floor, $e);
+{$$ = make_node<UnOpExp>(ExpOp::floor, $e);
         save_location($$, @$);}
 | "ceil" exp[e] %prec UMINUS
-{$$ = make_shared<UnOpExp>(ExpOp::ceil, $e);
+{$$ = make_node<UnOpExp>(ExpOp::ceil, $e);
         save_location($$, @$);}
 | "abs" exp[e] %prec UMINUS
 {
-    $$ = make_shared<UnOpExp>(ExpOp::abs, $e);
+    $$ = make_node<UnOpExp>(ExpOp::abs, $e);
     save_location($$, @$);
 }
 | "sgn" exp[e] %prec UMINUS
 {
-    $$ = make_shared<UnOpExp>(ExpOp::sgn, $e);
+    $$ = make_node<UnOpExp>(ExpOp::sgn, $e);
     save_location($$, @$);
 }
 | "fsteq" "(" exp[e1] "," exp[e2] ")"
 {
-    $$ = make_shared<BinOpExp>(ExpOp::fsteq, $e1, $e2);
+    $$ = make_node<BinOpExp>(ExpOp::fsteq, $e1, $e2);
     save_location($$, @$);
 }
 | "lsteq" "(" exp[e1] "," exp[e2] ")"
 {
-    $$ = make_shared<BinOpExp>(ExpOp::lsteq, $e1, $e2);
+    $$ = make_node<BinOpExp>(ExpOp::lsteq, $e1, $e2);
     save_location($$, @$);
 }
 | "rndeq" "(" exp[e1] "," exp[e2] ")"
 {
-    $$ = make_shared<BinOpExp>(ExpOp::rndeq, $e1, $e2);
+    $$ = make_node<BinOpExp>(ExpOp::rndeq, $e1, $e2);
     save_location($$, @$);
 }
 | "minfrom" "(" exp[e1] "," exp[e2] ")"
 {
-    $$ = make_shared<BinOpExp>(ExpOp::minfrom, $e1, $e2);
+    $$ = make_node<BinOpExp>(ExpOp::minfrom, $e1, $e2);
     save_location($$, @$);
 }
 | "maxfrom" "(" exp[e1] "," exp[e2] ")"
 {
-    $$ = make_shared<BinOpExp>(ExpOp::maxfrom, $e1, $e2);
+    $$ = make_node<BinOpExp>(ExpOp::maxfrom, $e1, $e2);
     save_location($$, @$);
 }
 | "sumfrom" "(" exp[e1] "," exp[e2] ")"
 {
-	$$ = make_shared<BinOpExp>(ExpOp::sumfrom, $e1, $e2);
+	$$ = make_node<BinOpExp>(ExpOp::sumfrom, $e1, $e2);
 	save_location($$, @$);
 }
 | "sumkmax" "(" exp[e1] "," exp[e2] ")"
 {
-	$$ = make_shared<BinOpExp>(ExpOp::sumkmax, $e1, $e2);
+	$$ = make_node<BinOpExp>(ExpOp::sumkmax, $e1, $e2);
     save_location($$, @$);
 }
 | "consec" "(" exp[e1] "," exp[e2] ")"
 {
-    $$ = make_shared<BinOpExp>(ExpOp::consec, $e1, $e2);
+    $$ = make_node<BinOpExp>(ExpOp::consec, $e1, $e2);
     save_location($$, @$);
 }
 | "broken" "(" exp[e1] "," exp[e2] ")"
 {
-    $$ = make_shared<BinOpExp>(ExpOp::broken, $e1, $e2);
+    $$ = make_node<BinOpExp>(ExpOp::broken, $e1, $e2);
     save_location($$, @$);
 }
 | "fstexclude" "(" exp[e1] "," exp[e2] ")"
 {
-    $$ = make_shared<BinOpExp>(ExpOp::fstexclude, $e1, $e2);
+    $$ = make_node<BinOpExp>(ExpOp::fstexclude, $e1, $e2);
     save_location($$, @$);
 }
 | "(" exp[e] ")"
@@ -534,6 +533,6 @@ ModelParserGen::ModelParser::error(const ModelParserGen::location& l,
 }
 
 inline void save_location(shared_ptr<ModelAST> m, location loc) {
-    shared_ptr<location> ploc = make_shared<location>(loc);
+    shared_ptr<location> ploc = make_node<location>(loc);
     m->set_file_location(ploc);
 }
@@ -0,0 +1,60 @@
+//==============================================================================
+//
+//  ModelReplicas.cpp
+//
+//  Copyleft 2026-
+//  Authors:
+//  - The FIG contributors
+//
+//------------------------------------------------------------------------------
+//
+//  This file is part of FIG.
+//
+//  The Finite Improbability Generator (FIG) project is free software;
+//  you can redistribute it and/or modify it under the terms of the GNU
+//  General Public License as published by the Free Software Foundation;
+//  either version 3 of the License, or (at your option) any later version.
+//
+//  FIG is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with FIG; if not, write to the Free Software Foundation,
+//	Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//==============================================================================
+
+
+// C
+#include <cassert>
+// FIG
+#include <ModelReplicas.h>
+#include <ImportanceFunction.h>
+
+
+namespace fig  // // // // // // // // // // // // // // // // // // // // // //
+{
+
+ModelReplicas::ModelReplicas(const ModuleNetwork& network,
+                             const ImportanceFunction& impFun,
+                             const Property* property) :
+	network_(network),
+	property_(property)
+{
+	assert(network.sealed());
+	const size_t NUM_THREADS(static_cast<size_t>(omp_get_max_threads()));
+	if (NUM_THREADS < 2ul || !impFun.concurrent_queries())
+		return;  // simulate sequentially
+	networks_.reserve(NUM_THREADS-1ul);
+	for (size_t i = 1ul ; i < NUM_THREADS ; i++)
+		networks_.emplace_back(std::make_shared< ModuleNetwork >(network));
+	if (nullptr == property)
+		return;
+	properties_.reserve(NUM_THREADS-1ul);
+	for (size_t i = 1ul ; i < NUM_THREADS ; i++)
+		properties_.emplace_back(property->clone());
+}
+
+} // namespace fig  // // // // // // // // // // // // // // // // // // // //
@@ -32,7 +32,6 @@
 #include <cstdio>     // std::sprintf()
 #include <cstdlib>    // std::strtoul()
 #include <unistd.h>   // alarm(), exit()
-#include <pthread.h>  // pthread_cancel()
 #include <cmath>      // std::pow()
 #include <omp.h>      // omp_get_wtime()
 // C++
@@ -46,12 +45,12 @@
 #include <unordered_set>
 #include <type_traits>  // std::is_convertible<>
 #include <functional>   // std::ref()
-#include <algorithm>    // std::find();
+#include <algorithm>    // std::find(), std::any_of()
 #include <iterator>     // std::begin(), std::end(), std::distance()
 #include <string>
 #include <ios>          // std::scientific, std::fixed
 #include <iomanip>      // std::setprecision()
-#include <thread>
+#include <memory>       // std::unique_ptr<>
 // FIG
 #include <string_utils.h>
 #include <ModelSuite.h>
@@ -61,15 +60,18 @@
 #include <FigLog.h>
 #include <SignalSetter.h>
 #include <Property.h>
+#include <PropertyTransient.h>
 #include <StoppingConditions.h>
 #include <SimulationEngine.h>
 #include <SimulationEngineNosplit.h>
+#include <SimulationEngineIS.h>
 #include <SimulationEngineRestart.h>
 #include <SimulationEngineSFE.h>
 #include <ImportanceFunction.h>
 #include <ImportanceFunctionAlgebraic.h>
 #include <ImportanceFunctionConcreteSplit.h>
 #include <ImportanceFunctionConcreteCoupled.h>
+#include <ImportanceFunctionConcreteLazy.h>
 #include <ThresholdsBuilder.h>
 #include <ThresholdsBuilderES.h>
 #include <ThresholdsBuilderAMS.h>
@@ -78,8 +80,12 @@
 #include <ThresholdsBuilderHybrid.h>
 #include <ConfidenceInterval.h>
 #include <ConfidenceIntervalResult.h>
+#include <PerfCounters.h>
 #include <ConfidenceIntervalRate.h>
+#include <ConfidenceIntervalRegenerative.h>
 #include <ConfidenceIntervalTransient.h>
+#include <ConfidenceSequenceRate.h>
+#include <ConfidenceSequenceTransient.h>
 
 using std::to_string;
 // ADL
@@ -107,6 +113,8 @@ typedef std::chrono::duration<size_t> duration;
  * @param confidenceCo     Interval's confidence coefficient ∈ (0.0, 1.0)
  * @param precision        Interval's desired full width > 0.0
  * @param dynamicPrecision Is the precision a percentage of the estimate?
+ * @param regenerative     Estimate rate properties from regeneration cycles?
+ * @param anytimeValid     Build a confidence sequence, valid at any stopping time?
  *
  * @return Fresh ConfidenceInterval tailored for the given property
  *
@@ -119,7 +127,9 @@ std::shared_ptr< ConfidenceInterval >
 build_empty_ci(const fig::PropertyType& propertyType,
 			   double confidenceCo = -1.0,
 			   double precision = -1.0,
-			   const bool& dynamicPrecision = true)
+			   const bool& dynamicPrecision = true,
+			   const bool& regenerative = false,
+			   const bool& anytimeValid = false)
 {
 	std::shared_ptr< ConfidenceInterval > ci_ptr(nullptr);
 
@@ -133,6 +143,12 @@ build_empty_ci(const fig::PropertyType& propertyType,
 	switch (propertyType)
 	{
 	case fig::PropertyType::TRANSIENT:
+		if (anytimeValid && !timeBoundSim) {
+			ci_ptr.reset(new fig::ConfidenceSequenceTransient(confidenceCo,
+			                                                  precision,
+			                                                  dynamicPrecision));
+			break;
+		}
 		ci_ptr.reset(new fig::ConfidenceIntervalTransient(confidenceCo,
 														  precision,
 														  dynamicPrecision,
@@ -149,7 +165,21 @@ build_empty_ci(const fig::PropertyType& propertyType,
 		break;
 
     case fig::PropertyType::RATE:
+		if (regenerative) {
+			ci_ptr.reset(new fig::ConfidenceIntervalRegenerative(confidenceCo,
+			                                                     precision,
+			                                                     dynamicPrecision,
+			                                                     timeBoundSim));
+			break;
+		}
+		// fall through
 	case fig::PropertyType::TBOUNDED_SS:
+		if (anytimeValid && !timeBoundSim) {
+			ci_ptr.reset(new fig::ConfidenceSequenceRate(confidenceCo,
+			                                             precision,
+			                                             dynamicPrecision));
+			break;
+		}
 		ci_ptr.reset(new fig::ConfidenceIntervalRate(confidenceCo,
 													 precision,
 													 dynamicPrecision,
@@ -239,32 +269,56 @@ estimate_print(const ConfidenceInterval& ci,
 
 
 /**
- * @brief Sleep during 'timeLimit'; then write in 'timeoutSignal' and show 'ci'
- * @details Sleep is done on this thread; the user should call this function
- *          via std::thread if a "background timeout" is desired, e.g.
- *          std::thread timer(start_timer, std::ref(arg1)...);<br>
- *          The thread can then be cancelled via pthread_cancel() e.g. if the
- *          simulation succeeds and these actions should be avoided.
- * @param ci            Confidence interval to print out and reset
- * @param timeoutSignal Shared variable signaling simulations to stop
- * @param timeLimit     Duration (in seconds) of the sleep
- * @param out           Stream where results will be printed out
- * @param startTime     Result of omp_get_wtime() at simulations start
+ * @brief Watch over simulations until 'timeLimit' elapses; then cancel
+ *        the 'engine' and show the partial estimate in 'ci'
+ * @details Disarming the returned Watchdog (or destroying it) cancels the
+ *          pending time-out and joins its thread
+ * @param engine    SimulationEngine whose \ref SimulationEngine::interrupted
+ *                  "cancellation token" will be signalled on time-out
+ * @param ci        Confidence interval to print out on time-out
+ * @param timeLimit Time budget of the simulations
+ * @param out       Stream where results will be printed out
+ * @param startTime Result of omp_get_wtime() at simulations start
  */
-void
-start_timer(ConfidenceInterval& ci,
-			bool& timeoutSignal,
-			const seconds& timeLimit,
-			std::ostream& out,
-			const double& startTime)
+std::unique_ptr< fig::Watchdog >
+start_timer(fig::CancellationToken& token,
+            ConfidenceInterval& ci,
+            const seconds& timeLimit,
+            std::ostream& out,
+            const double& startTime)
+{
+	token.reset();
+	token.set_budget(timeLimit);
+	return std::unique_ptr< fig::Watchdog >(new fig::Watchdog(token,
+		token.deadline(),
+		[&ci, &out, startTime] () {
+			out << "\nTime-out ";
+			interrupt_print(ci, fig::ModelSuite::get_cc_to_show(), out, startTime);
+		}));
+}
+
+
+/// Copy of the current state of an interval, which won't follow its updates
+std::shared_ptr< ConfidenceInterval >
+snapshot_ci(const ConfidenceInterval& ci)
 {
-	std::this_thread::sleep_for(timeLimit);
-	timeoutSignal = true;  // this should stop computations
-	out << "\nTime-out ";
-	interrupt_print(ci, fig::ModelSuite::get_cc_to_show(), out, startTime);
-// * @param reset         Reset ConfidenceInterval after printing?
-//	if (reset)
-//		ci.reset();
+	// Copy by dynamic type, derived classes before their bases
+	auto csTransient = dynamic_cast<const fig::ConfidenceSequenceTransient*>(&ci);
+	if (nullptr != csTransient)
+		return std::make_shared< fig::ConfidenceSequenceTransient >(*csTransient);
+	auto csRate = dynamic_cast<const fig::ConfidenceSequenceRate*>(&ci);
+	if (nullptr != csRate)
+		return std::make_shared< fig::ConfidenceSequenceRate >(*csRate);
+	auto ciTransient = dynamic_cast<const fig::ConfidenceIntervalTransient*>(&ci);
+	if (nullptr != ciTransient)
+		return std::make_shared< fig::ConfidenceIntervalTransient >(*ciTransient);
+	auto ciRate = dynamic_cast<const fig::ConfidenceIntervalRate*>(&ci);
+	if (nullptr != ciRate)
+		return std::make_shared< fig::ConfidenceIntervalRate >(*ciRate);
+	auto ciRegen = dynamic_cast<const fig::ConfidenceIntervalRegenerative*>(&ci);
+	if (nullptr != ciRegen)
+		return std::make_shared< fig::ConfidenceIntervalRegenerative >(*ciRegen);
+	throw_FigException("unsupported kind of confidence interval \"" + ci.name + "\"");
 }
 
 
@@ -298,6 +352,8 @@ user_friendly_ifun_name(const fig::ImpFunSpec& ifunSpec)
 		return "monolithic";
 	else if (ifunSpec.strategy == "auto" && ifunSpec.name == "concrete_split")
 		return "compositional (" + ifunSpec.algebraicFormula + ")";
+	else if (ifunSpec.strategy == "auto" && ifunSpec.name == "concrete_lazy")
+		return "on-the-fly";
 	else
 		return "unknown?";
 }
@@ -353,11 +409,31 @@ double ModelSuite::lastEstimationStartTime_;
 
 seconds ModelSuite::timeout_(0l);
 
+bool ModelSuite::retuneEffort_(false);
+
+size_t ModelSuite::maxTraials_(0ul);
+
+bool ModelSuite::warmThresholds_(false);
+
+bool ModelSuite::costAwareThresholds_(false);
+
+bool ModelSuite::singlePass_(false);
+
+bool ModelSuite::sharedTrajectories_(false);
+
+bool ModelSuite::regenerative_(false);
+
+bool ModelSuite::anytimeValid_(false);
+
+bool ModelSuite::antithetic_(false);
+
+bool ModelSuite::commonRandomNumbers_(false);
+
 std::vector< ConfidenceIntervalResult > ModelSuite::lastEstimates_;
 
 bool ModelSuite::pristineModel_(false);
 
-const ConfidenceInterval* ModelSuite::interruptCI_ = nullptr;
+std::vector< const ConfidenceInterval* > ModelSuite::interruptCIs_;
 
 const std::vector< float > ModelSuite::confCoToShow_ = {0.8f, 0.9f, 0.95f, 0.99f};
 
@@ -373,8 +449,8 @@ SignalSetter ModelSuite::SIGINThandler_(SIGINT, [] (const int signal) {
 #endif
 		/// @todo TODO: implement proper reentrant logging
 		ModelSuite::log("\nCaught SIGINT, stopping computations.\n");
-		if (nullptr != ModelSuite::interruptCI_)
-			interrupt_print(*ModelSuite::interruptCI_,
+		for (const ConfidenceInterval* ci: ModelSuite::interruptCIs_)
+			interrupt_print(*ci,
 							ModelSuite::confCoToShow_,
 							ModelSuite::mainLog_,
 							ModelSuite::lastEstimationStartTime_);
@@ -395,8 +471,8 @@ SignalSetter ModelSuite::SIGTERMhandler_(SIGTERM, [] (const int signal) {
 		assert(SIGTERM == signal);
 		/// @todo TODO: implement proper reentrant logging
 		ModelSuite::log("\nCaught SIGTERM, stopping estimations.\n");
-        if (nullptr != ModelSuite::interruptCI_)
-			interrupt_print(*ModelSuite::interruptCI_,
+        for (const ConfidenceInterval* ci: ModelSuite::interruptCIs_)
+			interrupt_print(*ci,
 							ModelSuite::confCoToShow_,
 							ModelSuite::mainLog_,
 							ModelSuite::lastEstimationStartTime_);
@@ -475,6 +551,8 @@ ModelSuite::seal(const Container<ValueType, OtherContainerArgs...>& initialClock
 			std::make_shared< ImportanceFunctionConcreteCoupled >(*model);
 	impFuns["concrete_split"] =
 			std::make_shared< ImportanceFunctionConcreteSplit >(*model);
+	impFuns["concrete_lazy"] =
+			std::make_shared< ImportanceFunctionConcreteLazy >(*model);
 	impFuns["algebraic"] =
 			std::make_shared< ImportanceFunctionAlgebraic >();
 
@@ -496,6 +574,7 @@ ModelSuite::seal(const Container<ValueType, OtherContainerArgs...>& initialClock
 	simulators["restart4"] = simulators["restart"];
 	simulators["restart5"] = simulators["restart"];
 	simulators["restart6"] = simulators["restart"];
+	simulators["is"]       = std::make_shared< SimulationEngineIS >(model);
 
 #ifndef NDEBUG
 	// Check all offered importance functions, thresholds builders and
@@ -608,6 +687,70 @@ ModelSuite::set_verbosity(bool verboseOutput) noexcept
 }
 
 
+void
+ModelSuite::set_effort_retuning(bool retune) noexcept
+{
+	retuneEffort_ = retune;
+}
+
+
+void
+ModelSuite::set_max_traials(size_t maxTraials) noexcept
+{
+	maxTraials_ = maxTraials;
+}
+
+
+void
+ModelSuite::set_thresholds_warm_start(bool warm) noexcept
+{
+	warmThresholds_ = warm;
+}
+
+
+void
+ModelSuite::set_cost_aware_thresholds(bool costAware) noexcept
+{
+	costAwareThresholds_ = costAware;
+}
+
+
+void
+ModelSuite::set_single_pass_estimation(bool singlePass) noexcept
+{
+	singlePass_ = singlePass;
+}
+
+
+void
+ModelSuite::set_shared_trajectories(bool shared) noexcept
+{
+	sharedTrajectories_ = shared;
+}
+
+
+void
+ModelSuite::set_regenerative(bool regenerative) noexcept
+{
+	regenerative_ = regenerative;
+}
+
+
+void
+ModelSuite::set_anytime_valid(bool anytimeValid) noexcept
+{
+	anytimeValid_ = anytimeValid;
+}
+
+
+void
+ModelSuite::set_variance_reduction(bool antithetic, bool crn) noexcept
+{
+	antithetic_ = antithetic;
+	commonRandomNumbers_ = crn;
+}
+
+
 template< typename Integral >
 std::shared_ptr< const Property >
 ModelSuite::get_property(const Integral& i) const noexcept
@@ -1039,6 +1182,10 @@ ModelSuite::build_importance_function_auto(const ImpFunSpec& impFun,
 			if (0.0 <= get_DFT())
 				impFunSplit.set_DFT();
 		}
+		// On-the-fly importance functions may have a user-defined cache size
+		if ("concrete_lazy" == impFun.name && 0ul < impFun.cacheCapacity)
+			static_cast<ImportanceFunctionConcreteLazy&>(ifun)
+			        .set_cache_capacity(impFun.cacheCapacity);
 		try {
 			// Compute importance automatically -- here hides the magic!
 			static_cast<ImportanceFunctionConcrete&>(ifun)
@@ -1134,6 +1281,9 @@ ModelSuite::build_thresholds(const std::string& thrSpec,
 	const double startTime = omp_get_wtime();
 		tb.setup(property, thresholdsGivenAdHoc ? static_cast<const void*>(&thrSpec)
 		                                        : static_cast<const void*>(&globalEffort));
+		auto ES = dynamic_cast<ThresholdsBuilderES*>(&tb);
+		if (nullptr != ES)
+			ES->set_cost_aware(costAwareThresholds_);
 		ifun.build_thresholds(tb);
 		techLog_ << "Thresholds building time: "
 				 << std::fixed << std::setprecision(2)
@@ -1220,6 +1370,14 @@ ModelSuite::prepare_simulation_engine(const std::string& engineName,
 			traialProlongation = 0u;
 		}
 		RESTART->set_die_out_depth(static_cast<unsigned>(traialProlongation));
+		RESTART->set_effort_retuning(retuneEffort_);
+		RESTART->set_max_traials(maxTraials_);
+	}
+
+	// Step 1b: for standard Monte Carlo, set variance reduction
+	if ("nosplit" == engineName) {
+		auto nosplit = std::dynamic_pointer_cast<SimulationEngineNosplit>(engine_ptr);
+		nosplit->set_variance_reduction(antithetic_, commonRandomNumbers_);
 	}
 
 	// Step 2: Couple the ImportanceFunction and SimulationEngine instances
@@ -1314,8 +1472,18 @@ ModelSuite::clear() noexcept
 	currentSimulator = nullptr;
 	lastEstimationStartTime_ = 0.0;
 	timeout_ = std::chrono::seconds::zero();
+	retuneEffort_ = false;
+	maxTraials_ = 0ul;
+	warmThresholds_ = false;
+	costAwareThresholds_ = false;
+	singlePass_ = false;
+	sharedTrajectories_ = false;
+	regenerative_ = false;
+	anytimeValid_ = false;
+	antithetic_ = false;
+	commonRandomNumbers_ = false;
 	lastEstimates_.clear();
-	interruptCI_ = nullptr;
+	interruptCIs_.clear();
 	// Release more complex resources (ifuns, thr. builders, sim. engines)
 	try {
 		for (auto simEngine: simulators) {
@@ -1374,13 +1542,41 @@ ModelSuite::estimate(const Property& property,
 	             ? ("global effort = " + std::to_string(globalEffort))
 	             : ("per-threshold effort"));
 	mainLog_ << " ]" << std::endl;
+	if (PropertyType::RATE == property.type) {
+		if (regenerative_for(engine))
+			mainLog_ << " + regenerative cycles from the initial state\n";
+		else if (regenerative_ && "nosplit" == engine.name())
+			techLog_ << "[WARNING] Regenerative simulation needs a Markovian "
+			         << "model: using batch means\n";
+		else if (regenerative_)
+			techLog_ << "[WARNING] Regenerative simulation is only available "
+			         << "for engines \"nosplit\" and \"is\": using batch means\n";
+	}
 
-	if (bounds.is_time())
+	// Tune the engine before any time budget starts running
+	engine.interrupted.reset();
+	engine.prepare(property);
+
+	PerfCounters::reset();
+	if (singlePass_ && bounds.size() > 1ul)
+		// One simulation stream for all bounds
+		estimate_single_pass(property, engine, bounds);
+	else if (bounds.is_time())
 		// Simulation bounds are wall clock time limits
 		estimate_for_times(property, engine, bounds);
 	else
 		// Simulation bounds are confidence criteria
 		estimate_for_confs(property, engine, bounds);
+	TraialPool::get_instance().shrink();  // free the memory of splitting bursts
+
+	if (PerfCounters::ENABLED && highVerbosity_)
+		PerfCounters::print(techLog_, PerfCounters::collect(),
+		                    "engine \"" + engine.name() + "\"");
+	if ("concrete_lazy" == ifun.name()) {
+		const auto& lazyIfun(static_cast<const ImportanceFunctionConcreteLazy&>(ifun));
+		techLog_ << "Importance cache: " << lazyIfun.cache_hits() << " hits, "
+		         << lazyIfun.cache_misses() << " misses\n";
+	}
 
 //	mainLog_ << std::defaultfloat;
 	mainLog_ << std::setprecision(6);
@@ -1416,6 +1612,151 @@ template void ModelSuite::estimate(const unsigned int&,   SER, SCCR, IFSC) const
 template void ModelSuite::estimate(const unsigned long&,  SER, SCCR, IFSC) const;
 
 
+void
+ModelSuite::estimate_shared(const std::vector< std::shared_ptr< const Property > >& properties,
+                            SimulationEngine& engine,
+                            const StoppingConditions& bounds,
+                            const ImpFunSpec ifunSpec) const
+{
+	lastEstimates_.clear();
+	lastEstimates_.reserve(bounds.size()*properties.size());
+
+	auto nosplit = dynamic_cast<const SimulationEngineNosplit*>(&engine);
+	if (nullptr == nosplit)
+		throw_FigException("shared simulations need the \"nosplit\" engine, "
+		                   "but \"" + engine.name() + "\" was given");
+	else if (!engine.ready())
+		throw_FigException("SimulationEngine \"" + engine.name()
+						  +"\" isn't ready for simulations");
+	else if (singlePass_ && bounds.size() > 1ul)
+		throw_FigException("shared simulations can't be combined with "
+		                   "single-pass estimation");
+	std::vector< const PropertyTransient* > transients;
+	for (const auto& prop: properties) {
+		if (PropertyType::TRANSIENT != prop->type)
+			throw_FigException("only transient properties can share simulations, "
+			                   "got \"" + prop->to_string() + "\"");
+		transients.push_back(static_cast<const PropertyTransient*>(prop.get()));
+	}
+	if (transients.empty())
+		return;
+	engine.set_batch_size(bounds.batch_size());
+	const ImportanceFunction& ifun(*impFuns[engine.current_imp_fun()]);
+
+	mainLog_ << "RNG algorithm used: " << Clock::rng_type() << "\n\n";
+	mainLog_ << "Properties (sharing simulations):\n";
+	for (const auto& prop: properties)
+		mainLog_ << " " << prop->to_string() << "\n";
+	mainLog_ << " + importance function: " << user_friendly_ifun_name(ifunSpec) << "\n";
+	mainLog_ << " + threshold builder:   " << ifun.thresholds_technique() << "\n";
+	mainLog_ << " + simulation engine:   " << engine.name() << "\n";
+	mainLog_ << " + RNG seed:            " << Clock::rng_seed()
+			 << (Clock::rng_seed_is_random() ? (" (randomized)\n") : ("\n"));
+	mainLog_ << " + batch size:          " << engine.transient_batch_size() << std::endl;
+	PerfCounters::reset();
+
+	// Build one interval per property for each stopping condition,
+	// time budgets using intervals which never become valid
+	std::vector< SimulationEngine::FollowerCIs > conditions;
+	std::vector< seconds > timeLimits;
+	const seconds maxTime(timeout_.count() > 0l ? timeout_ : seconds(9999999l));
+	if (bounds.is_time_budgets()) {
+		for (const unsigned long& wallTimeInSeconds: bounds.time_budgets()) {
+			conditions.emplace_back();
+			for (const auto& prop: properties)
+				conditions.back().emplace_back(build_empty_ci(prop->type));
+			timeLimits.emplace_back(timeout_.count() > 0l
+			        ? std::min<long>(wallTimeInSeconds, timeout_.count())
+			        : wallTimeInSeconds);
+		}
+	} else {
+		for (const auto& criterion: bounds.confidence_criteria()) {
+			conditions.emplace_back();
+			for (const auto& prop: properties)
+				conditions.back().emplace_back(build_empty_ci(prop->type,
+				                                              std::get<0>(criterion),
+				                                              std::get<1>(criterion),
+				                                              std::get<2>(criterion),
+				                                              false,
+				                                              anytimeValid_));
+			timeLimits.emplace_back(maxTime);
+		}
+	}
+
+	for (auto c = 0ul ; c < conditions.size() ; c++) {
+		const auto& cis(conditions[c]);
+		std::vector< bool > reported(cis.size(), false);
+
+		// Configure simulation
+		interruptCIs_.clear();  // bad boy
+		for (const auto& ci: cis)
+			interruptCIs_.push_back(ci.get());
+		engine.interrupted.reset();
+		lastEstimationStartTime_ = omp_get_wtime();
+		Clock::seed_rng();  // restart RNG sequence for this estimation
+
+		// Show simulation run info
+		if (bounds.is_time_budgets()) {
+			mainLog_ << std::setprecision(0) << std::fixed;
+			mainLog_ << "\n - Estim. time bound:   "
+			         << time_formatted_str(timeLimits[c].count()) << "\n";
+		} else {
+			mainLog_ << "\n - Confidence level:    "
+			         << std::setprecision(0) << std::fixed
+			         << 100*(cis.front()->confidence) << "%\n";
+			if (timeout_.count() > 0l)
+				mainLog_ << " - Time-out:" << std::setw(20)
+				         << time_formatted_str(timeout_.count()) << "\n";
+		}
+
+		// Report each property as soon as its interval is valid
+		auto report = [&] (const size_t& i)
+			{
+				if (reported[i] || !cis[i]->is_valid())
+					return;
+				mainLog_ << "\n - Property: " << properties[i]->to_string();
+				estimate_print(*cis[i], omp_get_wtime()-lastEstimationStartTime_, mainLog_);
+				reported[i] = true;
+			};
+
+		// Start timer: pending intervals are shown after simulations
+		engine.interrupted.set_budget(timeLimits[c]);
+		Watchdog timer(engine.interrupted, engine.interrupted.deadline());
+		// Simulate
+		try {
+			engine.lock();
+			nosplit->simulate_shared(transients, cis, report);
+			engine.unlock();
+			if (bounds.is_time_budgets())
+				timer.wait();  // must've timed-out already
+
+		} catch (std::exception&) {
+			engine.unlock();
+			timer.disarm();  // cancel pending TO
+			throw;
+		}
+		timer.disarm();
+
+		// Show the intervals which didn't meet their criterion
+		for (auto i = 0ul ; i < cis.size() ; i++) {
+			if (!reported[i]) {
+				mainLog_ << "\n - Property: " << properties[i]->to_string();
+				mainLog_ << "\n   Time-out ";
+				interrupt_print(*cis[i], get_cc_to_show(), mainLog_,
+				                lastEstimationStartTime_);
+			}
+			lastEstimates_.push_back(cis[i]);
+		}
+		interruptCIs_.clear();
+	}
+	if (PerfCounters::ENABLED && highVerbosity_)
+		PerfCounters::print(techLog_, PerfCounters::collect(),
+		                    "engine \"" + engine.name() + "\", shared simulations");
+//	mainLog_ << std::defaultfloat;
+	mainLog_ << std::setprecision(6);
+}
+
+
 void
 ModelSuite::estimate_for_times(const Property& property,
 							   const SimulationEngine& engine,
@@ -1426,9 +1767,10 @@ ModelSuite::estimate_for_times(const Property& property,
 	for (const unsigned long& wallTimeInSeconds: bounds.time_budgets()) {
 
 		// Configure simulation
-		auto ci_ptr = build_empty_ci(property.type);
-		interruptCI_ = ci_ptr.get();  // bad boy
-		engine.interrupted = false;
+		auto ci_ptr = build_empty_ci(property.type, -1.0, -1.0, true,
+		                             regenerative_for(engine));
+		interruptCIs_.assign(1ul, ci_ptr.get());  // bad boy
+		engine.interrupted.reset();
 		lastEstimationStartTime_ = omp_get_wtime();
 		Clock::seed_rng();  // restart RNG sequence for this estimation
 
@@ -1440,22 +1782,21 @@ ModelSuite::estimate_for_times(const Property& property,
 		mainLog_ << " - Estim. time bound:   " << time_formatted_str(timeLimit.count()) << "\n";
 
 		// Start timer
-		std::thread timer(start_timer, std::ref(*ci_ptr), std::ref(engine.interrupted),
-		                               timeLimit, std::ref(mainLog_), lastEstimationStartTime_);
+		auto timer = start_timer(engine.interrupted, *ci_ptr, timeLimit,
+		                         mainLog_, lastEstimationStartTime_);
 		// Simulate
 		try {
 			engine.lock();
 			engine.simulate(property, *ci_ptr);
 			engine.unlock();
-			timer.join();  // must've timed-out already
+			timer->wait();  // must've timed-out already
 
 		} catch (std::exception&) {
 			engine.unlock();
-			pthread_cancel(timer.native_handle());  // cancel pending timeout
-			timer.detach();
+			timer->disarm();  // cancel pending timeout
 			throw;
 		}
-		interruptCI_ = nullptr;
+		interruptCIs_.clear();
 		lastEstimates_.push_back(ci_ptr);
 		// Results should've been shown on TO interruption
 		if (highVerbosity_) {
@@ -1486,9 +1827,11 @@ ModelSuite::estimate_for_confs(const Property& property,
 		const bool precRel(std::get<2>(criterion));    // is precision relative?
 
 		// Configure simulation
-		auto ci_ptr = build_empty_ci(property.type, confCo, precVal, precRel);
-		interruptCI_ = ci_ptr.get();  // bad boy
-		engine.interrupted = false;
+		auto ci_ptr = build_empty_ci(property.type, confCo, precVal, precRel,
+		                             regenerative_for(engine),
+		                             anytimeValid_);
+		interruptCIs_.assign(1ul, ci_ptr.get());  // bad boy
+		engine.interrupted.reset();
 		lastEstimationStartTime_ = omp_get_wtime();
 		Clock::seed_rng();  // restart RNG sequence for this estimation
 
@@ -1505,8 +1848,8 @@ ModelSuite::estimate_for_confs(const Property& property,
 			         << time_formatted_str(timeout_.count()) << "\n";
 
 		// Start timer
-		std::thread timer(start_timer, std::ref(*ci_ptr), std::ref(engine.interrupted),
-		                               timeLimit, std::ref(mainLog_), lastEstimationStartTime_);
+		auto timer = start_timer(engine.interrupted, *ci_ptr, timeLimit,
+		                         mainLog_, lastEstimationStartTime_);
 		// Simulate
 		try {
 			engine.lock();
@@ -1515,22 +1858,15 @@ ModelSuite::estimate_for_confs(const Property& property,
 
 		} catch (std::exception&) {
 			engine.unlock();
-			pthread_cancel(timer.native_handle());  // cancel pending TO
-			timer.detach();
+			timer->disarm();  // cancel pending TO
 			throw;
 		}
 
-		// Show results
-		if (!engine.interrupted) {
-			// Simulations succeeded!
-			pthread_cancel(timer.native_handle());  // cancel pending TO
-			timer.detach();
+		// Show results: if simulations timed-out, disarm() waits
+		// for interrupt_print() to finish
+		if (!timer->disarm())
 			estimate_print(*ci_ptr, omp_get_wtime()-lastEstimationStartTime_, mainLog_);
-		} else {
-			// Simulations timed-out: wait for interrupt_print() to finish
-			timer.join();
-		}
-		interruptCI_ = nullptr;
+		interruptCIs_.clear();
 		lastEstimates_.push_back(ci_ptr);
 		if (highVerbosity_) {
 			techLog_ << std::endl;
@@ -1544,4 +1880,138 @@ ModelSuite::estimate_for_confs(const Property& property,
 	}
 }
 
+
+void
+ModelSuite::estimate_single_pass(const Property& property,
+                                 const SimulationEngine& engine,
+                                 const StoppingConditions& bounds) const
+{
+	const bool timeBounds(bounds.is_time_budgets());
+	const size_t NUM_BOUNDS(bounds.size());
+
+	// Configure simulation: one interval drives the estimation and the
+	// intervals of the confidence criteria follow it, sample by sample
+	const bool regenerative(regenerative_for(engine));
+	auto ci_ptr = build_empty_ci(property.type, -1.0, -1.0, true, regenerative);
+	SimulationEngine::FollowerCIs followers;
+	std::vector< seconds > budgets;
+	seconds timeLimit(timeout_.count() > 0l ? timeout_ : seconds(9999999l));
+	if (timeBounds) {
+		for (const unsigned long& wallTimeInSeconds: bounds.time_budgets())
+			budgets.emplace_back(timeout_.count() > 0l
+			        ? std::min<long>(wallTimeInSeconds, timeout_.count())
+			        : wallTimeInSeconds);
+		timeLimit = *std::max_element(begin(budgets), end(budgets));
+	} else {
+		for (const auto& criterion: bounds.confidence_criteria())
+			followers.emplace_back(build_empty_ci(property.type,
+			                                      std::get<0>(criterion),
+			                                      std::get<1>(criterion),
+			                                      std::get<2>(criterion),
+			                                      regenerative,
+			                                      anytimeValid_));
+	}
+	interruptCIs_.assign(1ul, ci_ptr.get());  // bad boy
+	engine.interrupted.reset();
+	lastEstimationStartTime_ = omp_get_wtime();
+	Clock::seed_rng();  // restart RNG sequence for this estimation
+
+	// Show simulation run info
+	mainLog_ << " - Single pass for " << NUM_BOUNDS << " stopping conditions\n";
+	if (timeBounds || timeout_.count() > 0l)
+		mainLog_ << " - Time-out:" << std::setw(20)
+		         << time_formatted_str(timeLimit.count()) << "\n";
+
+	// Report each stopping condition as soon as it's met
+	std::vector< std::shared_ptr< ConfidenceInterval > > results(NUM_BOUNDS);
+	auto report = [&] (const ConfidenceInterval& ci)
+		{
+			const double elapsed(omp_get_wtime()-lastEstimationStartTime_);
+			for (auto i = 0ul ; i < followers.size() ; i++) {
+				if (nullptr != results[i] || !followers[i]->is_valid())
+					continue;
+				mainLog_ << "\n - Met confidence criterion: "
+				         << std::setprecision(0) << std::fixed
+				         << 100*followers[i]->confidence << "% confidence";
+				estimate_print(*followers[i], elapsed, mainLog_);
+				results[i] = followers[i];
+			}
+			for (auto i = 0ul ; i < budgets.size() ; i++) {
+				if (nullptr != results[i] || budgets[i] >= timeLimit
+				        || elapsed < budgets[i].count())
+					continue;
+				mainLog_ << "\n - Estim. time bound " << time_formatted_str(budgets[i].count())
+				         << " elapsed: ";
+				interrupt_print(ci, get_cc_to_show(), mainLog_, lastEstimationStartTime_);
+				results[i] = snapshot_ci(ci);
+			}
+		};
+
+	// Start timer
+	auto timer = start_timer(engine.interrupted, *ci_ptr, timeLimit,
+	                         mainLog_, lastEstimationStartTime_);
+	// Simulate
+	try {
+		engine.lock();
+		engine.simulate(property, *ci_ptr, followers, report);
+		engine.unlock();
+		if (timeBounds)
+			timer->wait();  // must've timed-out already
+
+	} catch (std::exception&) {
+		engine.unlock();
+		timer->disarm();  // cancel pending TO
+		throw;
+	}
+	timer->disarm();
+
+	// Stopping conditions not met (e.g. on time-out) keep the last estimate
+	for (auto i = 0ul ; i < NUM_BOUNDS ; i++) {
+		if (nullptr != results[i])
+			continue;
+		else if (timeBounds && budgets[i] < timeLimit)
+			results[i] = snapshot_ci(*ci_ptr);
+		else if (timeBounds)
+			results[i] = ci_ptr;
+		else
+			results[i] = followers[i];
+	}
+	interruptCIs_.clear();
+	for (const auto& ci: results)
+		lastEstimates_.push_back(ci);
+	if (highVerbosity_) {
+		techLog_ << std::endl;
+		if (engine.isplit()) {
+			techLog_ << "\n#(sims) reaching each threshold level:";
+			for (const auto& pair: engine.get_reach_counts())
+				techLog_ << "\n" << std::setw(3) << pair.first << " | " << pair.second;
+			techLog_ << std::endl << std::endl;
+		}
+	}
+}
+
+
+void
+ModelSuite::warm_start_thresholds(const std::string& thrSpec, bool warm) const
+{
+	const auto tbIt = thrBuilders.find(thrSpec);
+	if (end(thrBuilders) == tbIt)
+		return;  // thresholds given ad hoc
+	auto tb = std::dynamic_pointer_cast<ThresholdsBuilderAdaptive>(tbIt->second);
+	if (nullptr == tb)
+		return;  // nothing to refine in non-adaptive builders
+	if (warm && warmThresholds_ && !tb->last_levels().empty())
+		tb->set_prior(tb->last_levels(), tb->last_level_up_probs());
+	else
+		tb->clear_prior();
+}
+
+
+bool
+ModelSuite::regenerative_for(const SimulationEngine& engine) noexcept
+{
+	return "is" == engine.name() || (regenerative_ && "nosplit" == engine.name()
+	                                  && model->is_markovian());
+}
+
 } // namespace fig  // // // // // // // // // // // // // // // // // // // //
@@ -1,7 +1,10 @@
 /* Leonardo Rodríguez */
 #include <sstream>
+#include <atomic>
+#include <exception>
 
 #include "ModelVerifier.h"
+#include "ErrorMessage.h"
 #include "ExpReductor.h"
 #include "FigException.h"
 #include "location.hh"
@@ -156,6 +159,105 @@ inline string warning_clock_exhaustation(const string &clock_id,
     return (ss.str());
 }
 
+// does this transition assign any of the given state variables?
+bool assigns_any(shared_ptr<TransitionAST> action,
+                 const std::set<string> &names) {
+    for (const shared_ptr<Assignment> &effect : action->get_assignments()) {
+        const string &id = effect->get_effect_location()->get_identifier();
+        if (names.find(id) != names.end()) {
+            return (true);
+        }
+    }
+    return (false);
+}
+
+// Values to which a guard pins state variables, i.e. its top-level
+// conjuncts "x == k", "k == x", "b" and "!b" with "k" a constant
+typedef std::map<string, int> pins_t;
+
+// try to reduce the expression to an int (or bool) constant
+bool pin_value(shared_ptr<Exp> exp, shared_ptr<ModuleScope> scope, int &value) {
+    ExpEvaluator ev (scope);
+    exp->accept(ev);
+    if (ev.has_errors() || !(ev.has_type_int() || ev.has_type_bool())) {
+        return (false);
+    }
+    value = ev.has_type_bool() ? ev.get_bool() : ev.get_int();
+    return (true);
+}
+
+// is this a (non-array, non-constant) state variable?
+shared_ptr<LocExp> pin_variable(shared_ptr<Exp> exp,
+                                shared_ptr<ModuleScope> scope) {
+    auto loc = std::dynamic_pointer_cast<LocExp>(exp);
+    int value;
+    if (loc == nullptr || loc->get_exp_location()->is_array_position() ||
+            pin_value(loc, scope, value)) {
+        return (nullptr);
+    }
+    return (loc);
+}
+
+void collect_pins(shared_ptr<Exp> guard, shared_ptr<ModuleScope> scope,
+                  pins_t &pins) {
+    auto bop = std::dynamic_pointer_cast<BinOpExp>(guard);
+    auto uop = std::dynamic_pointer_cast<UnOpExp>(guard);
+    shared_ptr<LocExp> var = nullptr;
+    int value;
+    if (bop != nullptr && bop->get_operator() == ExpOp::andd) {
+        collect_pins(bop->get_first_argument(), scope, pins);
+        collect_pins(bop->get_second_argument(), scope, pins);
+    } else if (bop != nullptr && bop->get_operator() == ExpOp::eq) {
+        auto first = bop->get_first_argument();
+        auto second = bop->get_second_argument();
+        if ((var = pin_variable(first, scope)) != nullptr &&
+                pin_value(second, scope, value)) {
+            pins.emplace(var->get_exp_location()->get_identifier(), value);
+        } else if ((var = pin_variable(second, scope)) != nullptr &&
+                pin_value(first, scope, value)) {
+            pins.emplace(var->get_exp_location()->get_identifier(), value);
+        }
+    } else if (uop != nullptr && uop->get_operator() == ExpOp::nott) {
+        var = pin_variable(uop->get_argument(), scope);
+        if (var != nullptr && var->get_type() == Type::tbool) {
+            pins.emplace(var->get_exp_location()->get_identifier(), 0);
+        }
+    } else {
+        var = pin_variable(guard, scope);
+        if (var != nullptr && var->get_type() == Type::tbool) {
+            pins.emplace(var->get_exp_location()->get_identifier(), 1);
+        }
+    }
+}
+
+// Pins of the precondition of each transition, computed once
+class GuardPins {
+    shared_ptr<ModuleScope> scope;
+    std::map<shared_ptr<TransitionAST>, pins_t> pins;
+public:
+    GuardPins(shared_ptr<ModuleScope> scope) : scope {scope} {}
+    const pins_t& operator()(shared_ptr<TransitionAST> action) {
+        auto it = pins.find(action);
+        if (it == pins.end()) {
+            it = pins.emplace(action, pins_t()).first;
+            collect_pins(action->get_precondition(), scope, it->second);
+        }
+        return (it->second);
+    }
+};
+
+// do the guards pin some state variable to different values?
+// If so they can't hold simultaneously, no need to ask the solver.
+bool trivially_disjoint(const pins_t &pins1, const pins_t &pins2) {
+    for (const auto &pin : pins1) {
+        auto other = pins2.find(pin.first);
+        if (other != pins2.end() && other->second != pin.second) {
+            return (true);
+        }
+    }
+    return (false);
+}
+
 } //namespace
 
 z3::sort Z3Converter::type_to_sort(Type type, z3::context& ctx) {
@@ -295,6 +397,11 @@ z3::sort Z3Converter::get_sort_of(const std::string &name) {
     return sorts.at(name);
 }
 
+ModelVerifier::ModelVerifier(shared_ptr<ModuleScope> scope) :
+    ModelVerifier() {
+    current_scope = scope;
+}
+
 shared_ptr<Exp> ModelVerifier::eval_or_throw(shared_ptr<Exp> exp) {
     ExpEvaluator ev (this->current_scope);
     exp->accept(ev);
@@ -325,17 +432,87 @@ z3::expr ModelVerifier::convert(shared_ptr<Exp> exp, std::set<string>& names) {
     return (conv.get_expression());
 }
 
+const z3::expr& ModelVerifier::guard(shared_ptr<Exp> exp,
+                                     std::set<string>& names) {
+    auto it = guards.find(exp);
+    if (it == guards.end()) {
+        Z3Converter conv (context, current_scope);
+        exp->accept(conv);
+        auto converted = std::make_pair(conv.get_expression(), conv.get_names());
+        it = guards.emplace(exp, converted).first;
+    }
+    for (auto name : it->second.second) {
+        names.insert(name);
+    }
+    return (it->second.first);
+}
+
 void ModelVerifier::add_names_limits(const std::set<string> &names) {
     for (const string& name : names) {
-        shared_ptr<Decl> decl = current_scope->local_decls_map().at(name);
-        if (decl->has_range()) {
-            shared_ptr<Ranged> ranged = decl->to_ranged();
-            const auto& sort =
-                    Z3Converter::type_to_sort(decl->get_type(), *context);
-            z3::expr low = eval_and_convert(ranged->get_lower_bound());
-            z3::expr up  = eval_and_convert(ranged->get_upper_bound());
-            solver->add(context->constant(name.c_str(), sort) >= low);
-            solver->add(context->constant(name.c_str(), sort) <= up);
+        auto it = limits.find(name);
+        if (it == limits.end()) {
+            shared_ptr<Decl> decl = current_scope->local_decls_map().at(name);
+            z3::expr limit = context->bool_val(true);
+            if (decl->has_range()) {
+                shared_ptr<Ranged> ranged = decl->to_ranged();
+                const auto& sort =
+                        Z3Converter::type_to_sort(decl->get_type(), *context);
+                z3::expr low = eval_and_convert(ranged->get_lower_bound());
+                z3::expr up  = eval_and_convert(ranged->get_upper_bound());
+                z3::expr var = context->constant(name.c_str(), sort);
+                limit = var >= low && var <= up;
+            }
+            it = limits.emplace(name, limit).first;
+        }
+        solver->add(it->second);
+    }
+}
+
+void ModelVerifier::run_batches(const std::vector<Batch>& batches,
+                                void (ModelVerifier::*check)(const Batch&),
+                                bool stopOnWarning) {
+    const size_t NUM_BATCHES = batches.size();
+    std::vector<shared_ptr<ErrorMessage>> results(NUM_BATCHES, nullptr);
+    std::atomic<size_t> firstWarned(NUM_BATCHES);
+    std::atomic<bool> failed(false);
+    std::exception_ptr failure = nullptr;
+    #pragma omp parallel default(shared) if(NUM_BATCHES > 1ul)
+    {
+        ModelVerifier worker(current_scope);  // z3 contexts can't be shared
+        #pragma omp for schedule(dynamic)
+        for (size_t i = 0ul ; i < NUM_BATCHES ; i++) {
+            if (firstWarned < i || failed) {
+                continue;  // a previous batch already decided the outcome
+            }
+            try {
+                (worker.*check)(batches[i]);
+            } catch (...) {
+                #pragma omp critical (fig_model_verifier_batches)
+                if (!failed) {
+                    failure = std::current_exception();
+                    failed = true;
+                }
+                continue;
+            }
+            if (worker.has_errors() || worker.has_warnings()) {
+                results[i] = worker.message;
+                worker.message = make_shared<ErrorMessage>();
+                if (stopOnWarning && results[i]->has_warnings()) {
+                    #pragma omp critical (fig_model_verifier_batches)
+                    firstWarned = std::min<size_t>(firstWarned, i);
+                }
+            }
+        }
+    }
+    if (failed) {
+        std::rethrow_exception(failure);
+    }
+    // Report in the same order a sequential check would have
+    for (size_t i = 0ul ; i < NUM_BATCHES ; i++) {
+        if (stopOnWarning && has_warnings()) {
+            break;
+        } else if (results[i] != nullptr) {
+            message->append(*results[i]);
         }
     }
 }
@@ -347,94 +524,86 @@ void ModelVerifier::debug_print_solver() {
     std::cout << "ENDOFSOLVER" << std::endl;
 }
 
-void ModelVerifier::check_output_determinism(const string &clock_id) {
-    auto &tr_actions = current_scope->transition_by_clock_map();
-    auto range = tr_actions.equal_range(clock_id);
-    auto it1 = range.first;
-    while (it1 != range.second && !has_warnings()) {
-        auto it2 = next(it1);
-        while (it2 != range.second && !has_warnings()) {
-            solver->push();
-            shared_ptr<OutputTransition> a1 = ((*it1).second);
-            shared_ptr<OutputTransition> a2 = ((*it2).second);
-            std::set<string> names;
-            //both preconditions valid:
-            shared_ptr<Exp> guard1 = a1->get_precondition();
-            solver->add(convert(guard1, names));
-            shared_ptr<Exp> guard2 = a2->get_precondition();
-            solver->add(convert(guard2, names));
-            add_names_limits(names);
-            const string &label1_id = a1->get_label();
-            const string &label2_id = a2->get_label();
-            if (solver->check()) {
-                //this two transitions are potentially enabled by the same clock
-                //let's check that at least any choice will produce the same output
-                if (label1_id != label2_id) {
-                    auto &warn = ::warning_same_clock_different_label;
+void ModelVerifier::check_output_determinism(const Batch &batch) {
+    const string &clock_id = batch.id;
+    shared_ptr<TransitionAST> a1 = batch.first;
+    std::set<string> names1;
+    solver->push();
+    solver->add(guard(a1->get_precondition(), names1));
+    add_names_limits(names1);
+    auto it2 = batch.seconds.begin();
+    while (it2 != batch.seconds.end() && !has_warnings()) {
+        solver->push();
+        shared_ptr<TransitionAST> a2 = *it2;
+        std::set<string> names;
+        //both preconditions valid:
+        solver->add(guard(a2->get_precondition(), names));
+        add_names_limits(names);
+        const string &label1_id = a1->get_label();
+        const string &label2_id = a2->get_label();
+        if (solver->check()) {
+            //this two transitions are potentially enabled by the same clock
+            //let's check that at least any choice will produce the same output
+            if (label1_id != label2_id) {
+                auto &warn = ::warning_same_clock_different_label;
+                put_error(warn(clock_id, a1, a2));
+            } else {
+                //now let's check if both transitions reset the same clocks
+                bool same_clocks = ::resets_clocks_of(a1, a2) &&
+                        resets_clocks_of(a2, a1);
+                if (!same_clocks) {
+                    auto &warn = ::warning_reseted_clocks_output;
                     put_error(warn(clock_id, a1, a2));
-                } else {
-                    //now let's check if both transitions reset the same clocks
-                    bool same_clocks = ::resets_clocks_of(a1, a2) &&
-                            resets_clocks_of(a2, a1);
-                    if (!same_clocks) {
-                        auto &warn = ::warning_reseted_clocks_output;
-                        put_error(warn(clock_id, a1, a2));
-                    }
-                    //now let's check that resulting state is the same
-                    if (!has_warnings()) {
-                        check_rhs(a1, a2);
-                        check_rhs(a2, a1);
-                    }
+                }
+                //now let's check that resulting state is the same
+                if (!has_warnings()) {
+                    check_rhs(a1, a2);
+                    check_rhs(a2, a1);
                 }
             }
-            solver->pop();
-            it2++;
         }
-        it1++;
+        solver->pop();
+        it2++;
     }
+    solver->pop();
 }
 
-void ModelVerifier::check_input_determinism(const string &label_id) {
-    auto &label_actions = current_scope->transition_by_label_map();
-    auto range = label_actions.equal_range(label_id);
-    auto it1 = range.first;
-    while (it1 != range.second && !has_warnings()) {
-        auto it2 = next(it1);
-        while (it2 != range.second && !has_warnings()) {
-            solver->push();
-            shared_ptr<TransitionAST> a1 = ((*it1).second);
-            shared_ptr<TransitionAST> a2 = ((*it2).second);
-            std::set<string> names;
-            //both preconditions valid:
-            shared_ptr<Exp> guard1 = a1->get_precondition();
-            solver->add(convert(guard1, names));
-            shared_ptr<Exp> guard2 = a2->get_precondition();
-            solver->add(convert(guard2, names));
-            add_names_limits(names);
-            if (solver->check()) {
-                // there is non-determinism, but it could be safe.
-                // Let's check that the postcondition is really different
-                check_rhs(a1, a2); //assignments of a1 equivalent to those in a2
-                check_rhs(a2, a1); //vice versa!
-                // now check that they reset the same clocks
-                if (!has_warnings()) {
-                    //now let's check if both reset the same clocks
-                    bool same_clocks = ::resets_clocks_of(a1, a2) &&
-                            ::resets_clocks_of(a2, a1);
-                    if (!same_clocks) {
-                        auto &warn = ::warning_reseted_clocks_input;
-                        put_error(warn(a1, a2));
-                    }
+void ModelVerifier::check_input_determinism(const Batch &batch) {
+    shared_ptr<TransitionAST> a1 = batch.first;
+    std::set<string> names1;
+    solver->push();
+    solver->add(guard(a1->get_precondition(), names1));
+    add_names_limits(names1);
+    auto it2 = batch.seconds.begin();
+    while (it2 != batch.seconds.end() && !has_warnings()) {
+        solver->push();
+        shared_ptr<TransitionAST> a2 = *it2;
+        std::set<string> names;
+        //both preconditions valid:
+        solver->add(guard(a2->get_precondition(), names));
+        add_names_limits(names);
+        if (solver->check()) {
+            // there is non-determinism, but it could be safe.
+            // Let's check that the postcondition is really different
+            check_rhs(a1, a2); //assignments of a1 equivalent to those in a2
+            check_rhs(a2, a1); //vice versa!
+            // now check that they reset the same clocks
+            if (!has_warnings()) {
+                //now let's check if both reset the same clocks
+                bool same_clocks = ::resets_clocks_of(a1, a2) &&
+                        ::resets_clocks_of(a2, a1);
+                if (!same_clocks) {
+                    auto &warn = ::warning_reseted_clocks_input;
+                    put_error(warn(a1, a2));
                 }
             }
-            solver->pop();
-            it2++;
         }
-        it1++;
+        solver->pop();
+        it2++;
     }
+    solver->pop();
 }
 
-
 inline bool isCommitted(const LabelType lt){
     return lt == LabelType::in_committed || lt == LabelType::out_committed;
 }
@@ -507,44 +676,84 @@ void ModelVerifier::visit(shared_ptr<Model> model) {
         }
         current_scope = ModuleScope::scopes.at(id);
         check_input_determinism_all();
-        solver->reset();
         check_output_determinism_all();
-        solver->reset();
         check_exhausted_clocks_all();
         i++;
     }
 }
 
 void ModelVerifier::check_output_determinism_all() {
-    map<string, shared_ptr<Dist>> &clocks_dist
-            = current_scope->dist_by_clock_map();
-    auto it = clocks_dist.begin();
-    while (it != clocks_dist.end() && !has_warnings()) {
-        check_output_determinism((*it).first);
-        it++;
+    if (has_warnings()) {
+        return;
     }
+    auto &tr_actions = current_scope->transition_by_clock_map();
+    ::GuardPins pins (current_scope);
+    std::vector<Batch> batches;
+    for (const auto &clock : current_scope->dist_by_clock_map()) {
+        auto range = tr_actions.equal_range(clock.first);
+        for (auto it1 = range.first ; it1 != range.second ; it1++) {
+            Batch batch {clock.first, (*it1).second, {}};
+            for (auto it2 = next(it1) ; it2 != range.second ; it2++) {
+                if (!::trivially_disjoint(pins((*it1).second),
+                                          pins((*it2).second))) {
+                    batch.seconds.push_back((*it2).second);
+                }
+            }
+            if (!batch.seconds.empty()) {
+                batches.push_back(batch);
+            }
+        }
+    }
+    run_batches(batches, &ModelVerifier::check_output_determinism, true);
 }
 
 void ModelVerifier::check_input_determinism_all() {
-    map<string, LabelType> &labels_type = current_scope->type_by_label_map();
-    map<string, LabelType>::iterator it = labels_type.begin();
-    while (it != labels_type.end() && !has_warnings()) {
-        if ((*it).second == LabelType::in) {
-            const string &label_id = (*it).first;
-            check_input_determinism(label_id);
+    if (has_warnings()) {
+        return;
+    }
+    auto &label_actions = current_scope->transition_by_label_map();
+    ::GuardPins pins (current_scope);
+    std::vector<Batch> batches;
+    for (const auto &label : current_scope->type_by_label_map()) {
+        if (label.second != LabelType::in) {
+            continue;
+        }
+        auto range = label_actions.equal_range(label.first);
+        for (auto it1 = range.first ; it1 != range.second ; it1++) {
+            Batch batch {label.first, (*it1).second, {}};
+            for (auto it2 = next(it1) ; it2 != range.second ; it2++) {
+                if (!::trivially_disjoint(pins((*it1).second),
+                                          pins((*it2).second))) {
+                    batch.seconds.push_back((*it2).second);
+                }
+            }
+            if (!batch.seconds.empty()) {
+                batches.push_back(batch);
+            }
         }
-        it++;
     }
+    run_batches(batches, &ModelVerifier::check_input_determinism, true);
 }
 
 void ModelVerifier::check_exhausted_clocks_all() {
-    map<string, shared_ptr<Dist>> &clocks_dist
-            = current_scope->dist_by_clock_map();
-    auto it = clocks_dist.begin();
-    while (it != clocks_dist.end()) {
-        check_exhausted_clocks((*it).first);
-        it++;
+    auto &tr_actions = current_scope->transition_by_clock_map();
+    auto &actions = current_scope->module_ast()->get_transitions();
+    std::vector<Batch> batches;
+    for (const auto &clock : current_scope->dist_by_clock_map()) {
+        auto range = tr_actions.equal_range(clock.first);
+        for (auto it1 = range.first ; it1 != range.second ; it1++) {
+            Batch batch {clock.first, (*it1).second, {}};
+            for (shared_ptr<TransitionAST> a2 : actions) {
+                if (!resets_clock(a2, clock.first)) {
+                    batch.seconds.push_back(a2);
+                }
+            }
+            if (!batch.seconds.empty()) {
+                batches.push_back(batch);
+            }
+        }
     }
+    run_batches(batches, &ModelVerifier::check_exhausted_clocks, false);
 }
 
 void ModelVerifier::check_rhs(shared_ptr<TransitionAST> a1,
@@ -625,40 +834,32 @@ void ModelVerifier
     }
 }
 
-void ModelVerifier ::check_exhausted_clocks(const string &clock_id) {
-    auto &tr_actions = current_scope->transition_by_clock_map();
-    auto range = tr_actions.equal_range(clock_id);
-    auto it1 = range.first;
-    auto &actions = current_scope->module_ast()->get_transitions();
-    //iterate over the actions triggered by clock_id
-    while (it1 != range.second) {
-        shared_ptr<TransitionAST> a1 = (*it1).second;
-        auto it2 = actions.begin();
-        //iterate over all the transitions in the current module
-        //looking for a dangerous transition
-        while (it2 != actions.end()) {
-            shared_ptr<TransitionAST> a2 = *it2;
-            if (!resets_clock(a2, clock_id) &&
-                    enables_exhausted(a1, a2, clock_id)) {
-                auto &warn = ::warning_clock_exhaustation;
-                put_warning(warn(clock_id, a1, a2));
-            }
-            it2++;
+void ModelVerifier::check_exhausted_clocks(const Batch &batch) {
+    //iterate over all the transitions in the current module
+    //looking for a dangerous transition
+    for (shared_ptr<TransitionAST> a2 : batch.seconds) {
+        if (enables_exhausted(batch.first, a2, batch.id)) {
+            auto &warn = ::warning_clock_exhaustation;
+            put_warning(warn(batch.id, batch.first, a2));
         }
-        it1++;
     }
 }
 
 bool ModelVerifier::enables_exhausted(shared_ptr<TransitionAST> a1,
                                       shared_ptr<TransitionAST> a2,
                                       const string &clock_id) {
-    solver->reset();
     std::set<string> names;
     std::set<string> changed_vars;
+    const z3::expr &pre1 = guard(a1->get_precondition(), names);
+    //if a2 doesn't touch the precondition of a1, it can't enable it
+    if (!::assigns_any(a2, names)) {
+        return (false);
+    }
+    solver->push();
     //precondition of a2 holds.
-    solver->add(convert(a2->get_precondition(), names));
+    solver->add(guard(a2->get_precondition(), names));
     //precondition of a1 does not hold.
-    solver->add(!convert(a1->get_precondition(), names));
+    solver->add(!pre1);
     //equalities that characterize postcondition of a2
     add_assignments_as_equalities(a2->get_assignments(), changed_vars);
     //precondition of a1 (after modifications made by the equalities above)
@@ -677,7 +878,7 @@ bool ModelVerifier::enables_exhausted(shared_ptr<TransitionAST> a1,
     //add range limits
     add_names_limits(names);
     bool res = solver->check();
-    solver->reset();
+    solver->pop();
     return (res);
 }
 
@@ -689,13 +890,8 @@ z3::expr ModelVerifier::pre_transitions_with_clock(const string &clock_id,
     z3::expr pre_clock = context->bool_val(false);
     while (it != range.second) {
         shared_ptr<TransitionAST> b = (*it).second;
-        pre_clock = pre_clock || convert(b->get_precondition(), names);
+        pre_clock = pre_clock || guard(b->get_precondition(), names);
         it++;
     }
     return (pre_clock);
 }
-
-
-
-
-
@@ -47,6 +47,7 @@
 #include <ModelSuite.h>
 #include <ImportanceFunction.h>
 #include <Traial.h>
+#include <PerfCounters.h>
 
 
 // ADL
@@ -95,6 +96,23 @@ template ModuleInstance::ModuleInstance(str, st, const std::vector<Clock>&);
 template ModuleInstance::ModuleInstance(str, st, const std::forward_list<Clock>&);
 
 
+ModuleInstance::ModuleInstance(const ModuleInstance& that) :
+	Module(that),
+	lState_(that.lState_),
+	lClocks_(that.lClocks_),
+	has_committed_(that.has_committed_),
+	name(that.name),
+	globalIndex_(that.globalIndex_),
+	firstVar_(that.firstVar_),
+	firstClock_(that.firstClock_),
+	sealed_(that.sealed_)
+{
+	// Reference our own transitions, not those of 'that'
+	if (sealed_)
+		order_transitions();
+}
+
+
 void
 ModuleInstance::add_transition(const Transition& transition)
 {
@@ -139,7 +157,7 @@ ModuleInstance::add_transition(Transition&& transition)
 	if (0 <= globalIndex_ || 0 <= firstClock_)
 		return;
 #endif
-	transitions_.emplace_back(transition);
+	transitions_.emplace_back(std::move(transition));
 }
 
 
@@ -274,15 +292,18 @@ ModuleInstance::adjacent_states(const size_t& s) const
 }
 
 
+template< class Sampler >
 const Label&
 ModuleInstance::apply_postcondition(Traial &traial,
-                                    const transition_vector_t& transitions) const
+                                    const transition_vector_t& transitions,
+                                    const Sampler& sample) const
 {
 #ifndef NDEBUG  // Check for nondeterminism only in DEBUG mode
 	const Label* labPtr(nullptr);
 	StateInstance traialState = traial.state;
 	for (const Transition &tr : transitions) {
 		// If the traial satisfies this precondition...
+		FIG_PERF_COUNT(GUARD_EVAL);
 		if (tr.pre(traialState)) {
 			if (nullptr != labPtr
 			        && !tr.label().is_in_committed()
@@ -305,6 +326,7 @@ ModuleInstance::apply_postcondition(Traial &traial,
 #else
 	for (const Transition &tr : transitions) {
 		// If the traial satisfies this precondition...
+		FIG_PERF_COUNT(GUARD_EVAL);
 		if (tr.pre(traial.state)) {
 #endif
 			// ...apply postcondition to its state...
@@ -314,7 +336,7 @@ ModuleInstance::apply_postcondition(Traial &traial,
 			std::vector<CLOCK_INTERNAL_TYPE> clockValues(NUM_CLOCKS);
 			for (size_t i = firstClock_ ; i < firstClock_+NUM_CLOCKS ; i++ ) {
 				clockValues[i-firstClock_] =
-				        tr.resetClocks()[i] ? lClocks_[i-firstClock_].sample()
+				        tr.resetClocks()[i] ? sample(lClocks_[i-firstClock_])
 				                            : traial.clock_value(i);
 			}
 			traial.update_clocks(firstClock_, NUM_CLOCKS, clockValues);
@@ -334,9 +356,11 @@ ModuleInstance::apply_postcondition(Traial &traial,
 }
 
 
+template< class Sampler >
 const Label&
 ModuleInstance::jump(const Traial::Timeout& to,
-					 Traial& traial) const
+					 Traial& traial,
+					 const Sampler& sample) const
 {
 #ifndef NDEBUG
 	if (!sealed_)
@@ -349,14 +373,20 @@ ModuleInstance::jump(const Traial::Timeout& to,
 	traial.advance_time(firstClock_, num_clocks(), elapsedTime);
 	traial.advance_time(to.gpos, 100.0f);  // mark this clock as 'expired'
 	// Step 2: attend any enabled transition with matching clock name
-	return apply_postcondition(traial, iter->second);
+	return apply_postcondition(traial, iter->second, sample);
 }
 
+// ModuleInstance::jump(timeout) can only be invoked with the following samplers
+template const Label& ModuleInstance::jump(const Traial::Timeout&, Traial&, const SampleClock&) const;
+template const Label& ModuleInstance::jump(const Traial::Timeout&, Traial&, const Clock::Sampler&) const;
+
 
+template< class Sampler >
 void
 ModuleInstance::jump(const Label& label,
 					 const CLOCK_INTERNAL_TYPE& elapsedTime,
-					 Traial& traial) const
+					 Traial& traial,
+					 const Sampler& sample) const
 {
 #ifndef NDEBUG
 	if (!sealed_)
@@ -371,32 +401,44 @@ ModuleInstance::jump(const Label& label,
 	const auto iter = transitions_by_label_.find(label.str);
 	if (!label.is_tau() && end(transitions_by_label_) != iter) {
 		const auto& transitions = iter->second;
-		apply_postcondition(traial, transitions);
+		apply_postcondition(traial, transitions, sample);
 	// Step 3: if step 2 matched nothing, attend any enabled wildcard transition
 	} else {
 		const auto iter = transitions_by_label_.find("_");
 		if (end(transitions_by_label_) != iter) {
 			const auto &transitions = iter->second;
-			apply_postcondition(traial, transitions);
+			apply_postcondition(traial, transitions, sample);
 		}
 	}
 }
 
+// ModuleInstance::jump(label) can only be invoked with the following samplers
+template void ModuleInstance::jump(const Label&, const CLOCK_INTERNAL_TYPE&, Traial&, const SampleClock&) const;
+template void ModuleInstance::jump(const Label&, const CLOCK_INTERNAL_TYPE&, Traial&, const Clock::Sampler&) const;
+
 
+template< class Sampler >
 const Label&
-ModuleInstance::jump_committed(Traial& traial)
+ModuleInstance::jump_committed(Traial& traial, const Sampler& sample)
 {
 #ifndef NDEBUG
 	if (!sealed_)
 		throw_FigException("this module hasn't been sealed yet");
 #endif
 	// Look for (and apply) any enabled output committed transition
-	return apply_postcondition(traial, transitions_out_committed_);
+	return apply_postcondition(traial, transitions_out_committed_, sample);
 }
 
+// ModuleInstance::jump_committed(traial) can only be invoked with the following samplers
+template const Label& ModuleInstance::jump_committed(Traial&, const SampleClock&);
+template const Label& ModuleInstance::jump_committed(Traial&, const Clock::Sampler&);
 
+
+template< class Sampler >
 void
-ModuleInstance::jump_committed(const Label& label, Traial& traial) const
+ModuleInstance::jump_committed(const Label& label,
+                               Traial& traial,
+                               const Sampler& sample) const
 {
 #ifndef NDEBUG
 	if (!sealed_)
@@ -409,9 +451,13 @@ ModuleInstance::jump_committed(const Label& label, Traial& traial) const
 	// IOSA-C labels can have a single type (output, input, committed, tau)
     const auto iter = transitions_by_label_.find(label.str);
 	if (iter != transitions_by_label_.end())
-		apply_postcondition(traial, iter->second);
+		apply_postcondition(traial, iter->second, sample);
 }
 
+// ModuleInstance::jump_committed(label) can only be invoked with the following samplers
+template void ModuleInstance::jump_committed(const Label&, Traial&, const SampleClock&) const;
+template void ModuleInstance::jump_committed(const Label&, Traial&, const Clock::Sampler&) const;
+
 
 void
 ModuleInstance::apply_postcondition(State<STATE_INTERNAL_TYPE>& state,
@@ -69,7 +69,8 @@ namespace fig  // // // // // // // // // // // // // // // // // // // // // //
 
 ModuleNetwork::ModuleNetwork() :
 	numClocks_(0u),
-	sealed_(false)
+	sealed_(false),
+	numSteps_(0ul)
 {
 	// Empty range of "forall" is:
 	markovian_ = true;
@@ -77,10 +78,13 @@ ModuleNetwork::ModuleNetwork() :
 
 
 ModuleNetwork::ModuleNetwork(const ModuleNetwork& that) :
+	Module(that),
 	gState(that.gState),
 	initialClocks(that.initialClocks),
+	has_committed_(that.has_committed_),
 	numClocks_(that.numClocks_),
-	sealed_(that.sealed_)
+	sealed_(that.sealed_),
+	numSteps_(0ul)
 {
 	// Efectively *copy* all modules, not just their pointers
 	modules.reserve(that.modules.size());
@@ -259,19 +263,53 @@ ModuleNetwork::adjacent_states(const size_t& s) const
 }
 
 
+std::forward_list<StateInstance>
+ModuleNetwork::adjacent_states(const StateInstance& s) const
+{
+	assert(gState.is_valid_state_instance(s));
+	std::forward_list<StateInstance> adjacentStates;
+	State<STATE_INTERNAL_TYPE> state(gState);
+	state.copy_from_state_instance(s);
+	for (const auto& module_ptr: modules) {
+		for (const Transition& tr: module_ptr->transitions_) {
+			const Label& label = tr.label();
+			// For each 'active' and enabled transition of this module...
+			if ((label.is_output() || label.is_tau())
+					&& tr.precondition()(state)) {
+				// ...update the module variables...
+				tr.postcondition()(state);
+				// ...and those of other modules listening to this label...
+				for (const auto& other_module_ptr: modules)
+					if (module_ptr->name != other_module_ptr->name)
+						other_module_ptr->jump(label, state);
+				// ...and store resulting valuation
+				adjacentStates.push_front(state.to_state_instance());
+				// Restore original state
+				state.copy_from_state_instance(s);
+			}
+		}
+	}
+	// Remove duplicates before returning
+	adjacentStates.sort();
+	adjacentStates.unique();
+	return adjacentStates;
+}
+
+
+template< class Sampler >
 bool
-ModuleNetwork::process_committed_once(Traial &traial) const
+ModuleNetwork::process_committed_once(Traial &traial, const Sampler& sample) const
 {
 	using fig_cli::traceDump;
 	bool found = false;
 	for (shared_ptr<ModuleInstance> module_ptr : modules) {
 		if (!module_ptr->has_committed_actions())
 			continue;
-		const Label& committedLabel = module_ptr->jump_committed(traial);
+		const Label& committedLabel = module_ptr->jump_committed(traial, sample);
 		if (committedLabel.should_ignore())
 			continue;
 		for (auto module_ptr_passive: modules)
-			module_ptr_passive->jump_committed(committedLabel, traial);
+			module_ptr_passive->jump_committed(committedLabel, traial, sample);
 		found = true;
 		if (traceDump != nullptr) {
 			(*traceDump) << "\nAction: " << committedLabel.str << "!! | ";
@@ -283,21 +321,28 @@ ModuleNetwork::process_committed_once(Traial &traial) const
 }
 
 
+template< class Sampler >
 void
-ModuleNetwork::process_committed(Traial &traial) const {
+ModuleNetwork::process_committed(Traial &traial, const Sampler& sample) const {
     if (!this->has_committed_) {
         return;
     }
-	while (process_committed_once(traial))
-		;  // repeat until no committed actions are enabled
+	while (process_committed_once(traial, sample))
+		FIG_PERF_COUNT(COMMITTED_LOOP);  // repeat until no committed actions are enabled
 }
 
+// ModuleNetwork::process_committed() can only be invoked with the following samplers
+template void ModuleNetwork::process_committed(Traial&, const SampleClock&) const;
+template void ModuleNetwork::process_committed(Traial&, const Clock::Sampler&) const;
+
 
 template< typename DerivedProperty,
-          class TraialMonitor >
+          class TraialMonitor,
+          class Sampler >
 Event ModuleNetwork::simulation_step(Traial& traial,
 									 const DerivedProperty& property,
-                                     const TraialMonitor& watch_events) const
+                                     const TraialMonitor& watch_events,
+                                     const Sampler& sample) const
 {
 	using fig_cli::traceDump;
 	const auto defaultStreamFlags(traceDump != nullptr ? traceDump->flags()
@@ -310,7 +355,7 @@ Event ModuleNetwork::simulation_step(Traial& traial,
 
 	// Start up processing the initial committed actions
 	// (this could reset clocks and change next timeout)
-	process_committed(traial);
+	process_committed(traial, sample);
 
 	// Now, until a relevant event is observed...
 	while ( !watch_events(property, traial, e) ) {
@@ -319,7 +364,8 @@ Event ModuleNetwork::simulation_step(Traial& traial,
 		const float elapsedTime(to.value);
 		assert(0.0f <= elapsedTime);
 		// ...do active jump in the module whose clock timed-out...
-		const Label& label = to.module->jump(to, traial);
+		// (ours, since Timeouts point to the modules of the original network)
+		const Label& label = modules[to.module->global_index()]->jump(to, traial, sample);
 		if (traceDump != nullptr) {
 			(*traceDump) << "\nAction: " << (label.is_tau() ? "τ" : label.str) << " | ";
 			(*traceDump) << "Time: " << traial.lifeTime << " | ";
@@ -328,10 +374,12 @@ Event ModuleNetwork::simulation_step(Traial& traial,
 		// ...do passive jumps in all modules listening to label...
 		for (auto module_ptr: modules)
 			if (module_ptr->name != to.module->name)
-				module_ptr->jump(label, elapsedTime, traial);
+				module_ptr->jump(label, elapsedTime, traial, sample);
 		traial.lifeTime += elapsedTime;
 		// ...and process any newly activated committed action.
-		process_committed(traial);
+		process_committed(traial, sample);
+		numSteps_++;
+		FIG_PERF_COUNT(STEP);
 	}
 
 	if (traceDump != nullptr)
@@ -342,15 +390,21 @@ Event ModuleNetwork::simulation_step(Traial& traial,
 
 
 // ModuleNetwork::simulation_step() can only be invoked with the following
-// "DerivedProperty" and "TraialMonitor" combinations
+// "DerivedProperty", "TraialMonitor" and "Sampler" combinations
 using TraialMonitor = SimulationEngine::EventWatcher;
 template
-Event ModuleNetwork::simulation_step(Traial&, const Property&, const TraialMonitor&) const;
+Event ModuleNetwork::simulation_step(Traial&, const Property&, const TraialMonitor&, const SampleClock&) const;
+template
+Event ModuleNetwork::simulation_step(Traial&, const PropertyRate&, const TraialMonitor&, const SampleClock&) const;
+template
+Event ModuleNetwork::simulation_step(Traial&, const PropertyTBoundSS&, const TraialMonitor&, const SampleClock&) const;
+template
+Event ModuleNetwork::simulation_step(Traial&, const PropertyTransient&, const TraialMonitor&, const SampleClock&) const;
 template
-Event ModuleNetwork::simulation_step(Traial&, const PropertyRate&, const TraialMonitor&) const;
+Event ModuleNetwork::simulation_step(Traial&, const Property&, const TraialMonitor&, const Clock::Sampler&) const;
 template
-Event ModuleNetwork::simulation_step(Traial&, const PropertyTBoundSS&, const TraialMonitor&) const;
+Event ModuleNetwork::simulation_step(Traial&, const PropertyRate&, const TraialMonitor&, const Clock::Sampler&) const;
 template
-Event ModuleNetwork::simulation_step(Traial&, const PropertyTransient&, const TraialMonitor&) const;
+Event ModuleNetwork::simulation_step(Traial&, const PropertyTransient&, const TraialMonitor&, const Clock::Sampler&) const;
 
 } // namespace fig  // // // // // // // // // // // // // // // // // // // //
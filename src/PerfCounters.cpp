@@ -0,0 +1,173 @@
+//==============================================================================
+//
+//  PerfCounters.cpp
+//
+//  Copyleft 2026-
+//  Authors:
+//  - The FIG contributors
+//
+//------------------------------------------------------------------------------
+//
+//  This file is part of FIG.
+//
+//  The Finite Improbability Generator (FIG) project is free software;
+//  you can redistribute it and/or modify it under the terms of the GNU
+//  General Public License as published by the Free Software Foundation;
+//  either version 3 of the License, or (at your option) any later version.
+//
+//  FIG is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with FIG; if not, write to the Free Software Foundation,
+//	Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//==============================================================================
+
+
+// C++
+#include <list>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <iomanip>  // std::setw()
+// FIG
+#include <PerfCounters.h>
+
+
+namespace  // // // // // // // // // // // // // // // // // // // // // // //
+{
+
+/// Guards the registry of counters and of distributions
+std::mutex registryMutex;
+
+/// Counters of every thread that ever counted
+std::list< std::unique_ptr< fig::PerfCounters::Counts > > registry;
+
+/// Names of the distributions sampled, by index
+std::vector< std::string > distributions;
+
+/// Human-readable names of the events
+const std::array< const char*, fig::PerfCounters::NUM_EVENTS > EVENT_NAMES = {{
+	"simulation steps",
+	"committed-action loops",
+	"guard evaluations",
+	"clock samples",
+	"splits",
+	"kills",
+	"Traial copies",
+	"TraialPool growths"
+}};
+
+} // namespace   // // // // // // // // // // // // // // // // // // // // //
+
+
+
+namespace fig  // // // // // // // // // // // // // // // // // // // // // //
+{
+
+// Static variables initialization
+
+thread_local PerfCounters::Counts* PerfCounters::local_(nullptr);
+
+constexpr size_t PerfCounters::MAX_INDEX;
+
+constexpr size_t PerfCounters::NUM_EVENTS;
+
+
+// PerfCounters class member functions
+
+PerfCounters::Counts::Counts()
+{
+	total.fill(0ul);
+	for (auto& idx: indexed)
+		idx.fill(0ul);
+}
+
+
+PerfCounters::Counts&
+PerfCounters::Counts::operator+=(const Counts& that)
+{
+	for (auto e = 0ul ; e < NUM_EVENTS ; e++) {
+		total[e] += that.total[e];
+		for (auto i = 0ul ; i < MAX_INDEX ; i++)
+			indexed[e][i] += that.indexed[e][i];
+	}
+	return *this;
+}
+
+
+PerfCounters::Counts*
+PerfCounters::register_thread()
+{
+	std::lock_guard<std::mutex> lock(registryMutex);
+	registry.emplace_back(new Counts);
+	return registry.back().get();
+}
+
+
+size_t
+PerfCounters::distribution_index(const std::string& distName)
+{
+	std::lock_guard<std::mutex> lock(registryMutex);
+	const auto it = std::find(begin(distributions), end(distributions), distName);
+	if (end(distributions) != it)
+		return static_cast<size_t>(std::distance(begin(distributions), it));
+	distributions.push_back(distName);
+	return distributions.size()-1ul;
+}
+
+
+PerfCounters::Counts
+PerfCounters::collect()
+{
+	std::lock_guard<std::mutex> lock(registryMutex);
+	Counts sum;
+	for (const auto& counts: registry)
+		sum += *counts;
+	return sum;
+}
+
+
+void
+PerfCounters::reset()
+{
+	std::lock_guard<std::mutex> lock(registryMutex);
+	for (auto& counts: registry)
+		*counts = Counts();
+}
+
+
+void
+PerfCounters::print(std::ostream& out,
+                    const Counts& counts,
+                    const std::string& title)
+{
+	out << "\nPerformance counters (" << title << "):";
+	for (auto e = 0ul ; e < NUM_EVENTS ; e++) {
+		out << "\n  " << std::left << std::setw(24) << EVENT_NAMES[e]
+		    << std::right << counts.total[e];
+		if (0ul == counts.total[e])
+			continue;
+		const auto event(static_cast<PerfEvent>(e));
+		if (PerfEvent::CLOCK_SAMPLE == event) {
+			std::lock_guard<std::mutex> lock(registryMutex);
+			for (auto i = 0ul ; i < std::min(MAX_INDEX, distributions.size()) ; i++)
+				if (0ul < counts.indexed[e][i])
+					out << "\n    " << std::left << std::setw(22)
+					    << distributions[i] << std::right << counts.indexed[e][i];
+		} else if (PerfEvent::SPLIT == event || PerfEvent::KILL == event) {
+			for (auto i = 0ul ; i < MAX_INDEX ; i++)
+				if (0ul < counts.indexed[e][i])
+					out << "\n    level " << std::left << std::setw(16)
+					    << (i < MAX_INDEX-1ul ? std::to_string(i)
+					                          : std::to_string(i)+"+")
+					    << std::right << counts.indexed[e][i];
+		}
+	}
+	out << std::endl;
+}
+
+} // namespace fig  // // // // // // // // // // // // // // // // // // // //
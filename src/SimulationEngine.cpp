@@ -48,10 +48,12 @@
 #include <PropertyTransient.h>
 #include <ConfidenceInterval.h>
 #include <ConfidenceIntervalRate.h>
+#include <ConfidenceIntervalRegenerative.h>
 #include <ConfidenceIntervalTransient.h>
 #include <ModuleNetwork.h>
 #include <ModelSuite.h>
 #include <TraialPool.h>
+#include <Telemetry.h>
 #include <FigException.h>
 #include <FigLog.h>
 
@@ -142,40 +144,21 @@ min_run_length(const std::string&,// engineName,
 
 /// Increase given simulation run length (in simulation-time units)
 /// in order to estimate the value of steady-state-like properties.
-/// Fine tune for the specified SimulationEngine and ImportanceFunction pair
+/// Grow faster when the last run was much shorter (in wall-clock time)
+/// than desired, viz. when 'speedUp' (desired/actual duration) is large,
+/// so that warm-up doesn't take forever.
 /// @see min_run_length
 void
 increase_run_length(const std::string&,// engineName,
                     const std::string&,// ifunName,
-					size_t& runLength)
+					size_t& runLength,
+					const double& speedUp,
+					const size_t& maxLength)
 {
 	static const float inc_length = 1.4f;
-	runLength *= inc_length;
-	/// @todo TODO remove deprecated code below
-/*
-	// Build internal table once: rows follow engine names definition order
-	//                            cols follow impFun names definition order
-	constexpr size_t NUM_ENGINES(fig::SimulationEngine::NUM_NAMES);
-	constexpr size_t NUM_IMPFUNS(fig::ImportanceFunction::NUM_NAMES);
-	static const auto& engineNames(fig::SimulationEngine::names());
-	static const auto& ifunNames(fig::ImportanceFunction::names());
-	static const float inc_length[NUM_ENGINES][NUM_IMPFUNS] = {
-		{ 1.7f, 1.4f, 1.4f },  // nosplit x {concrete_coupled, concrete_split, algebraic}
-		{ 1.4f, 1.4f, 1.4f },  // restart x {concrete_coupled, concrete_split, algebraic}
-		{ 1.4f, 1.4f, 1.4f }   //     sfe x {concrete_coupled, concrete_split, algebraic}
-//		{ 1.4f, 1.4f, 1.4f }   //     bfe x {concrete_coupled, concrete_split, algebraic}
-	};
-	const auto engineIt = find(begin(engineNames), end(engineNames), engineName);
-	const auto ifunIt = find(begin(ifunNames), end(ifunNames), ifunName);
-	// Check given engine and importance function names are valid
-	if (engineIt == end(engineNames))
-		throw_FigException("invalid engine name \""+engineName+"\"");
-	if (ifunIt == end(ifunNames))
-		throw_FigException("invalid importance function name \""+ifunName+"\"");
-	// Update runLength with corresponding entry from table, rely on type promotion
-	runLength *= inc_length[std::distance(begin(engineNames), engineIt)]
-						   [std::distance(begin(ifunNames), ifunIt)];
-*/
+	static const float max_inc_length = 4.0f;
+	runLength *= std::max<double>(inc_length, std::min<double>(max_inc_length, speedUp));
+	runLength = std::min(runLength, maxLength);
 }
 
 
@@ -226,7 +209,7 @@ SimulationEngine::SimulationEngine(
         model_(model),
 		impFun_(nullptr),
 		cImpFun_(nullptr),
-        interrupted(false),
+        interrupted(),
         toBuildThresholds_(thresholds),
         reachCount_()
 {
@@ -328,7 +311,11 @@ SimulationEngine::names() noexcept
 		"restart3",
 		"restart4",
 		"restart5",
-		"restart6"
+		"restart6",
+
+		// Importance sampling, tilting the rates of exponential clocks
+		// See SimulationEngineIS class
+		"is"
 	}};
 	return names;
 }
@@ -378,6 +365,42 @@ SimulationEngine::current_imp_strat() const noexcept
 void
 SimulationEngine::simulate(const Property& property, ConfidenceInterval& ci) const
 {
+	simulate(property, ci, FollowerCIs());
+}
+
+
+void
+SimulationEngine::simulate(const Property& property,
+                           ConfidenceInterval& ci,
+                           const FollowerCIs& followers,
+                           const BatchMonitor& monitor) const
+{
+	// Whether the estimation can stop because its intervals are done
+	auto done = [&ci, &followers] () -> bool
+		{
+			if (ci.is_valid())
+				return true;
+			else if (followers.empty())
+				return false;
+			for (const auto& f: followers)
+				if (!f->is_valid())
+					return false;
+			return true;
+		};
+	// Feed the followers iff the last batch made it into 'ci'
+	const unsigned telemetryId(telemetry_start(property));
+	auto feed = [&] (const long& samplesBefore,
+	                 std::function<void(ConfidenceInterval&)> update)
+		{
+			if (ci.num_samples() != samplesBefore)
+				for (auto& f: followers)
+					if (!f->is_valid())
+						update(*f);
+			if (monitor)
+				monitor(ci);
+			telemetry_batch(telemetryId, ci);
+		};
+
 	if (!bound())
 		throw_FigException("engine isn't bound to any importance function");
 	if (interrupted)
@@ -388,27 +411,58 @@ SimulationEngine::simulate(const Property& property, ConfidenceInterval& ci) con
 	case PropertyType::TRANSIENT: {
 		const auto& pTransient(dynamic_cast<const PropertyTransient&>(property));
 		auto& ciTransient(dynamic_cast<ConfidenceIntervalTransient&>(ci));
-		size_t batchSize = batch_size() > 0ul ? batch_size()
-											  : min_batch_size(name(), impFun_->name());
+		const size_t minBatchSize = transient_batch_size();
+		size_t batchSize = minBatchSize;
 		print_batchsize(figMainLog, batchSize);
-		while ( !interrupted && !ci.is_valid() ) {
+		while ( !interrupted && !done() ) {
+			const double start(omp_get_wtime());
 			auto counts = transient_simulations(pTransient, batchSize);
+			batchSize = tune_batch_size(batchSize, omp_get_wtime()-start, minBatchSize);
+			const long samples(ci.num_samples());
 			transient_update(ciTransient, counts);
+			feed(samples, [&counts](ConfidenceInterval& f)
+				{ dynamic_cast<ConfidenceIntervalTransient&>(f).update(counts); });
+			end_of_batch();
 		}
 		} break;
 
 	case PropertyType::RATE: {
 		const auto& pRate(dynamic_cast<const PropertyRate&>(property));
+		auto ciRegen(dynamic_cast<ConfidenceIntervalRegenerative*>(&ci));
+		if (nullptr != ciRegen) {
+			// Independent regeneration cycles: no warm-up to discard
+			const size_t minBatchSize = transient_batch_size();
+			size_t batchSize = minBatchSize;
+			print_batchsize(figMainLog, batchSize, " - Cycles per batch:");
+			while ( !interrupted && !done() ) {
+				const double start(omp_get_wtime());
+				auto cycles = regenerative_simulations(pRate, batchSize);
+				batchSize = tune_batch_size(batchSize, omp_get_wtime()-start, minBatchSize);
+				if (interrupted)
+					break;  // don't update interrupted simulations
+				const long samples(ci.num_samples());
+				ciRegen->update(cycles);
+				feed(samples, [&cycles](ConfidenceInterval& f)
+					{ dynamic_cast<ConfidenceIntervalRegenerative&>(f).update(cycles); });
+				end_of_batch();
+			}
+			break;
+		}
 		auto& ciRate(dynamic_cast<ConfidenceIntervalRate&>(ci));
 		size_t runLength = batch_size() > 0ul ? batch_size()
 											  : min_run_length(name(), impFun_->name());
 		print_batchsize(figMainLog, runLength);
 		bool firstRun(true);
 		do {
+			const double start(omp_get_wtime());
 			auto value = rate_simulation(pRate, runLength, firstRun);  // use batch-means
-			rate_update(ciRate, value, runLength);
+			const long samples(ci.num_samples());
+			const double rate(std::exp(std::log(value)-std::log(runLength)));
+			rate_update(ciRate, value, runLength, omp_get_wtime()-start);
+			feed(samples, [&rate](ConfidenceInterval& f) { f.update(rate); });
+			end_of_batch();
 			firstRun = false;
-		} while ( !interrupted && !ci.is_valid() );
+		} while ( !interrupted && !done() );
 		} break;
 
 	case PropertyType::TBOUNDED_SS: {
@@ -419,8 +473,12 @@ SimulationEngine::simulate(const Property& property, ConfidenceInterval& ci) con
 		print_batchsize(figMainLog, batchSimTime, " - Batch sim time:");
 		do {
 			auto value = tbound_ss_simulation(pTBSS);
+			const long samples(ci.num_samples());
 			tbound_ss_update(ciRate, value, batchSimTime);
-		} while ( !interrupted && !ci.is_valid() );
+			feed(samples, [&](ConfidenceInterval& f)
+				{ f.update(std::exp(std::log(value)-std::log(batchSimTime))); });
+			end_of_batch();
+		} while ( !interrupted && !done() );
 	    } break;
 
 	case PropertyType::RATIO:
@@ -428,6 +486,69 @@ SimulationEngine::simulate(const Property& property, ConfidenceInterval& ci) con
 		throw_FigException("property type isn't supported by \"" + name_ +
 						   "\" simulation engine yet");
 	}
+	telemetry_end(telemetryId, ci);
+}
+
+
+std::vector< std::pair< double, double > >
+SimulationEngine::regenerative_simulations(const PropertyRate&, const size_t&) const
+{
+	throw_FigException("regenerative simulation isn't supported by \""
+	                   + name_ + "\" simulation engine");
+}
+
+
+unsigned
+SimulationEngine::telemetry_start(const Property& property) const
+{
+	if (!Telemetry::enabled())
+		return 0u;
+	return Telemetry::get_instance().start(name_ + ": " + property.to_string(),
+	                                       model_->num_steps());
+}
+
+
+void
+SimulationEngine::telemetry_batch(const unsigned& id, const ConfidenceInterval& ci) const
+{
+	if (!Telemetry::enabled())
+		return;
+	auto& telemetry(Telemetry::get_instance());
+	telemetry.batch(id, ci, model_->num_steps());
+	if (isplit())
+		for (const auto& pair: reachCount_)
+			telemetry.level(id, pair.first, pair.second);
+}
+
+
+void
+SimulationEngine::telemetry_end(const unsigned& id, const ConfidenceInterval& ci) const
+{
+	if (Telemetry::enabled())
+		Telemetry::get_instance().end(id, ci, model_->num_steps());
+}
+
+
+size_t
+SimulationEngine::tune_batch_size(const size_t& batchSize,
+                                  const double& wallTime,
+                                  const size_t& minSize) const
+{
+	if (batch_size() > 0ul)
+		return batchSize;  // user knows best
+	const double size(static_cast<double>(batchSize));
+	const double target(wallTime > 0.0 ? size * TARGET_BATCH_TIME / wallTime
+	                                   : 2.0 * size);
+	const double tuned(std::round(std::max(size / 2.0, std::min(2.0 * size, target))));
+	return std::max(minSize, std::min(size_t(MAX_BATCH_SIZE), static_cast<size_t>(tuned)));
+}
+
+
+size_t
+SimulationEngine::transient_batch_size() const
+{
+	return batch_size() > 0ul ? batch_size()
+	                          : min_batch_size(name(), impFun_->name());
 }
 
 
@@ -472,7 +593,8 @@ SimulationEngine::transient_update(ConfidenceIntervalTransient& ci,
 void
 SimulationEngine::rate_update(ConfidenceIntervalRate& ci,
 							  const double& rareTime,
-                              size_t& simTime) const
+                              size_t& simTime,
+                              const double& wallTime) const
 {
 	if (interrupted)
 		return;  // don't update interrupted simulations
@@ -507,7 +629,9 @@ SimulationEngine::rate_update(ConfidenceIntervalRate& ci,
 			print_runtime(figTechLog, " time:", " samples:"+std::to_string(ci.num_samples()));
 		}
 	} else {
-		increase_run_length(name_, impFun_->name(), simTime);
+		increase_run_length(name_, impFun_->name(), simTime,
+		                    wallTime > 0.0 ? TARGET_BATCH_TIME/wallTime : 4.0,
+		                    size_t(MAX_BATCH_SIZE));
 		figTechLog << "*";  // report "discarded"
 	}
 }
@@ -49,7 +49,11 @@ SimulationEngineFixedEffort::SimulationEngineFixedEffort(
 		SimulationEngine(simEngineName, model, thresholds),
 		arbitrary_effort([](const unsigned&){return 0u;}),
 		arbitraryMaxLevel(0ul),
-		property_(nullptr)
+		keepCheckpoint(false),
+		resumeFromCheckpoint(false),
+		checkpointLevel_(0),
+		property_(nullptr),
+		replicas_(nullptr)
 { /* Not much to do around here */ }
 
 
@@ -71,6 +75,30 @@ SimulationEngineFixedEffort::bind(std::shared_ptr< const ImportanceFunction > if
 		throw_FigException("RESTART simulation engine requires an importance "
 		                   "building strategy other than \"flat\"");
 	SimulationEngine::bind(ifun_ptr);
+	replicas_.reset();  // may now simulate (in)concurrently
+}
+
+
+void
+SimulationEngineFixedEffort::save_checkpoint(
+	const ThresholdsPathProb& path,
+	const ImportanceValue& level,
+	std::vector< Reference< Traial > >& entry) const
+{
+	TraialPool::get_instance().return_traials(checkpointTraials_);
+	checkpointTraials_.swap(entry);
+	checkpointLevel_ = level;
+	checkpointPath_ = path;
+	checkpointCost_ = levelCost_;
+}
+
+
+void
+SimulationEngineFixedEffort::clear_checkpoint() const
+{
+	TraialPool::get_instance().return_traials(checkpointTraials_);
+	ThresholdsPathProb().swap(checkpointPath_);
+	checkpointCost_.clear();
 }
 
 
@@ -91,6 +119,7 @@ SimulationEngineFixedEffort::transient_simulations(
 		// New property, reset counters
 		property_ = &property;
 		reachCount_.clear();
+		replicas_.reset();
 	}
 
 	// Perform 'numRuns' independent Fixed Effort simulations
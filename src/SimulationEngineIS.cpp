@@ -0,0 +1,332 @@
+//==============================================================================
+//
+//  SimulationEngineIS.cpp
+//
+//  Copyleft 2026-
+//  Authors:
+//  - The FIG contributors
+//
+//------------------------------------------------------------------------------
+//
+//  This file is part of FIG.
+//
+//  The Finite Improbability Generator (FIG) project is free software;
+//  you can redistribute it and/or modify it under the terms of the GNU
+//  General Public License as published by the Free Software Foundation;
+//  either version 3 of the License, or (at your option) any later version.
+//
+//  FIG is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with FIG; if not, write to the Free Software Foundation,
+//	Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//==============================================================================
+
+
+// C++
+#include <cmath>       // std::log, std::exp
+#include <algorithm>   // std::nth_element, std::max_element
+#include <functional>  // std::ref(), std::placeholders
+// FIG
+#include <core_typedefs.h>
+#include <Clock.h>
+#include <FigLog.h>
+#include <FigException.h>
+#include <SimulationEngineIS.h>
+#include <PropertyRate.h>
+#include <PropertyTBoundSS.h>
+#include <PropertyTransient.h>
+#include <TraialPool.h>
+
+
+using namespace std::placeholders;  // _1, _2, _3, ...
+
+
+namespace fig
+{
+
+// Available engine names in SimulationEngine::names
+SimulationEngineIS::SimulationEngineIS(
+    std::shared_ptr<const ModuleNetwork> model,
+    bool thresholds) :
+        SimulationEngine("is", model, thresholds),
+        tunedFor_(0),
+        initialLevel_(0u),
+        pilot_(nullptr)
+{
+	if (thresholds)
+		throw_FigException("importance sampling engine cannot be used "
+		                   "for building thresholds");
+	// Register the clocks we can tilt
+	for (const auto& module_ptr: model->modules) {
+		for (const Clock& clock: module_ptr->clocks()) {
+			if ("exponential" != clock.dist_name())
+				continue;
+			expClocks_.emplace(&clock, rates_.size());
+			rates_.push_back(static_cast<double>(clock.distribution_params()[0]));
+		}
+	}
+}
+
+
+SimulationEngineIS::~SimulationEngineIS()
+{
+	/* Not much to do around here */
+}
+
+
+void
+SimulationEngineIS::bind(std::shared_ptr< const ImportanceFunction > ifun)
+{
+	if (!model_->is_markovian())
+		throw_FigException("importance sampling engine requires a Markovian "
+		                   "model, i.e. with memoryless clocks only");
+	SimulationEngine::bind(ifun);
+	tunedFor_ = 0;  // new thresholds: tilting must be re-tuned
+}
+
+
+void
+SimulationEngineIS::prepare(const Property& property) const
+{
+	if (property.get_id() != tunedFor_)
+		tune(property, PropertyType::RATE == property.type);
+}
+
+
+std::vector<double>
+SimulationEngineIS::transient_simulations(const PropertyTransient& property,
+                                          const size_t& numRuns) const
+{
+	assert(0ul < numRuns);
+	if (property.get_id() != tunedFor_)
+		tune(property, false);
+	std::vector< double > weighedRares(numRuns, 0.0l);
+	Traial& traial = TraialPool::get_instance().get_traial();
+	const Clock::Sampler sample(tilted_sampler(traial));
+	const EventWatcher watch_events =
+	        std::bind(&SimulationEngineIS::transient_event, this, _1, _2, _3);
+
+	// Perform 'numRuns' independent importance sampling simulations
+	for (size_t i = 0ul ; i < numRuns && !interrupted ; i++) {
+		start(traial, sample);
+		Event e = model_->simulation_step(traial, property, watch_events, sample);
+		if (IS_RARE_EVENT(e))
+			weighedRares[i] = std::exp(traial.logWeight);
+	}
+	TraialPool::get_instance().return_traial(std::move(traial));
+
+	// Return rare states visited, weighed by their likelihood ratio
+	return weighedRares;
+}
+
+
+double
+SimulationEngineIS::rate_simulation(const PropertyRate&, const size_t&, bool) const
+{
+	throw_FigException("importance sampling can't use batch means: estimate "
+	                   "rate properties from regeneration cycles instead");
+}
+
+
+double
+SimulationEngineIS::tbound_ss_simulation(const PropertyTBoundSS&) const
+{
+	throw_FigException("importance sampling of time-bounded steady-state "
+	                   "properties isn't supported");
+}
+
+
+std::vector< std::pair< double, double > >
+SimulationEngineIS::regenerative_simulations(const PropertyRate& property,
+                                             const size_t& numCycles) const
+{
+	assert(0ul < numCycles);
+	if (property.get_id() != tunedFor_)
+		tune(property, true);
+	std::vector< std::pair< double, double > > cycles;
+	cycles.reserve(numCycles);
+	StateInstance regenState;
+	double rareTime(0.0), lastTime(0.0);
+	bool wasRare(false), started(false), stalled(false);
+	size_t steps(0ul);
+
+	// Accumulate the time spent on rare states until the cycle ends,
+	// viz. until the simulation returns to the regeneration state
+	const EventWatcher watch_cycle = [&] (const Property& prop, Traial& traial, Event&) -> bool
+		{
+			traial.level = impFun_->level_of(traial.state);
+			stalled = ++steps > MAX_CYCLE_STEPS;
+			if (wasRare)
+				rareTime += static_cast<double>(traial.lifeTime) - lastTime;
+			lastTime = static_cast<double>(traial.lifeTime);
+			wasRare = prop.is_rare(traial.state);
+			const bool regenerated(started && traial.state == regenState);
+			if (regenState.empty())
+				regenState = traial.state;  // initial state after committed actions
+			started = true;
+			return interrupted || regenerated || stalled;
+		};
+
+	// Perform 'numCycles' independent importance sampling regeneration cycles
+	Traial& traial = TraialPool::get_instance().get_traial();
+	const Clock::Sampler sample(tilted_sampler(traial));
+	for (size_t i = 0ul ; i < numCycles && !interrupted ; i++) {
+		rareTime = lastTime = 0.0;
+		wasRare = started = false;
+		steps = 0ul;
+		start(traial, sample);
+		model_->simulation_step(traial, property, watch_cycle, sample);
+		if (interrupted || stalled)
+			break;
+		const double weight(std::exp(traial.logWeight));
+		cycles.emplace_back(weight * rareTime, weight * lastTime);
+	}
+	TraialPool::get_instance().return_traial(std::move(traial));
+	if (stalled)
+		throw_FigException("no regeneration within " + std::to_string(MAX_CYCLE_STEPS)
+		                   + " steps: the initial state is absorbing or too "
+		                   "rarely revisited, estimate with batch means instead");
+
+	return cycles;
+}
+
+
+void
+SimulationEngineIS::tune(const Property& property, bool cycles) const
+{
+	const ImportanceValue TOP(impFun_->max_value() + 1u);  // score of rare runs
+	tilts_.assign(TOP, rates_);
+	tunedFor_ = property.get_id();
+	if (rates_.empty())
+		return;  // nothing to tilt
+
+	Traial& traial = TraialPool::get_instance().get_traial();
+	traial.initialise(*model_, *impFun_);
+	initialLevel_ = traial.level;
+	const Clock::Sampler sample(tilted_sampler(traial));
+
+	// Score pilot simulations by the highest threshold level they reach
+	std::vector< std::vector< Sample > > samples(PILOT_RUNS);
+	std::vector< ImportanceValue > scores(PILOT_RUNS), ranking;
+	std::vector< double > logWeights(PILOT_RUNS);
+	StateInstance regenState;
+	ImportanceValue score(0u);
+	bool started(false);
+	const EventWatcher watch_pilot = [&] (const Property& prop, Traial& t, Event&) -> bool
+		{
+			t.level = impFun_->level_of(t.state);
+			score = std::max(score, t.level);
+			if (prop.is_rare(t.state)) {
+				score = TOP;
+				return true;
+			}
+			const bool regenerated(cycles && started && t.state == regenState);
+			if (cycles && regenState.empty())
+				regenState = t.state;
+			started = true;
+			return interrupted || regenerated || prop.is_stop(t.state);
+		};
+
+	// Multilevel cross-entropy: tilt towards the elite pilots, whose score
+	// is raised each iteration until they're those reaching the rare event
+	ImportanceValue gamma(initialLevel_);
+	unsigned iter(0u);
+	std::vector< double > num(rates_.size()), den(rates_.size());
+	for ( ; iter < MAX_PILOT_ITERATIONS && gamma < TOP && !interrupted ; iter++) {
+		for (size_t i = 0ul ; i < PILOT_RUNS && !interrupted ; i++) {
+			samples[i].clear();
+			pilot_ = &samples[i];
+			score = 0u;
+			started = false;
+			start(traial, sample);
+			model_->simulation_step(traial, property, watch_pilot, sample);
+			scores[i] = score;
+			logWeights[i] = traial.logWeight;
+		}
+		pilot_ = nullptr;
+		if (interrupted)
+			break;
+		// Choose the elite level, aiming at progress over the initial state
+		ranking = scores;
+		const size_t q(static_cast<size_t>((1.0-ELITE_FRACTION)*PILOT_RUNS));
+		std::nth_element(begin(ranking), begin(ranking)+q, end(ranking));
+		const ImportanceValue best(*std::max_element(begin(scores), end(scores)));
+		if (best <= initialLevel_)
+			break;  // no pilot went anywhere: nothing to learn
+		gamma = std::max(ranking[q], std::min(best, gamma+1u));
+		// Weighed MLE of the rates from the elite pilots, per threshold level
+		double maxLogWeight(-INFINITY);
+		for (size_t i = 0ul ; i < PILOT_RUNS ; i++)
+			if (scores[i] >= gamma)
+				maxLogWeight = std::max(maxLogWeight, logWeights[i]);
+		for (ImportanceValue l = 0u ; l < TOP ; l++) {
+			std::fill(begin(num), end(num), 0.0);
+			std::fill(begin(den), end(den), 0.0);
+			for (size_t i = 0ul ; i < PILOT_RUNS ; i++) {
+				if (scores[i] < gamma)
+					continue;
+				const double w(std::exp(logWeights[i]-maxLogWeight));
+				for (const Sample& s: samples[i]) {
+					if (std::get<0>(s) != l)
+						continue;
+					num[std::get<1>(s)] += w;
+					den[std::get<1>(s)] += w * std::get<2>(s);
+				}
+			}
+			for (size_t c = 0ul ; c < rates_.size() ; c++) {
+				if (0.0 >= den[c])
+					continue;  // clock unseen on this level: keep last tilting
+				const double rate = std::min(rates_[c]*MAX_TILT,
+				                             std::max(rates_[c]/MAX_TILT, num[c]/den[c]));
+				tilts_[l][c] = SMOOTHING*rate + (1.0-SMOOTHING)*tilts_[l][c];
+			}
+		}
+	}
+	TraialPool::get_instance().return_traial(std::move(traial));
+
+	figTechLog << "\nImportance sampling tilting tuned in " << iter
+	           << (1u == iter ? " iteration" : " iterations")
+	           << (gamma < TOP ? " (rare event not reached by the pilots)\n" : "\n");
+}
+
+
+Clock::Sampler
+SimulationEngineIS::tilted_sampler(Traial& traial) const
+{
+	return std::bind(&SimulationEngineIS::sample_tilted, this, _1, std::ref(traial));
+}
+
+
+void
+SimulationEngineIS::start(Traial& traial, const Clock::Sampler& sample) const
+{
+	traial.level = initialLevel_;  // tilting for the initial clocks
+	traial.initialise(*model_, *impFun_, sample);
+}
+
+
+CLOCK_INTERNAL_TYPE
+SimulationEngineIS::sample_tilted(const Clock& clock, Traial& traial) const
+{
+	const auto clkIt = expClocks_.find(&clock);
+	if (end(expClocks_) == clkIt)
+		return clock.sample();
+	const size_t c(clkIt->second);
+	const ImportanceValue l(std::min<ImportanceValue>(traial.level, tilts_.size()-1ul));
+	const double rate(rates_[c]), tilt(tilts_[l][c]);
+	DistributionParameters params(clock.distribution_params());
+	params[0] = static_cast<CLOCK_INTERNAL_TYPE>(tilt);
+	const CLOCK_INTERNAL_TYPE value(clock.sample(params));
+	// Likelihood ratio of the original w.r.t. the tilted exponential density
+	traial.logWeight += std::log(rate/tilt) - (rate-tilt)*value;
+	if (nullptr != pilot_)
+		pilot_->emplace_back(l, c, static_cast<double>(value));
+	return value;
+}
+
+} // namespace fig
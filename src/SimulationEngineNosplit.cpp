@@ -30,8 +30,10 @@
 // C
 #include <cmath>	   // std::log
 #include <functional>  // std::placeholders
+#include <omp.h>       // omp_get_wtime()
 // FIG
 #include <core_typedefs.h>
+#include <Clock.h>
 #include <FigLog.h>
 #include <FigException.h>
 #include <SimulationEngineNosplit.h>
@@ -41,6 +43,7 @@
 #include <PropertyTBoundSS.h>
 #include <PropertyTransient.h>
 #include <ConfidenceInterval.h>
+#include <ConfidenceIntervalTransient.h>
 
 
 using namespace std::placeholders;  // _1, _2, _3, ...
@@ -54,7 +57,9 @@ SimulationEngineNosplit::SimulationEngineNosplit(
     std::shared_ptr<const ModuleNetwork> model,
     bool thresholds) :
         SimulationEngine("nosplit", model, thresholds),
-        oTraial_(TraialPool::get_instance().get_traial())
+        oTraial_(TraialPool::get_instance().get_traial()),
+        antithetic_(false),
+        commonRandomNumbers_(false)
 {
 	if (thresholds)
 		throw_FigException("No-split engine (aka standard monte carlo) has "
@@ -71,24 +76,47 @@ SimulationEngineNosplit::~SimulationEngineNosplit()
 }
 
 
+void
+SimulationEngineNosplit::set_variance_reduction(bool antithetic, bool crn)
+{
+	if (locked())
+		throw_FigException("engine \"" + name() + "\" is currently locked "
+		                   "in \"simulation mode\"");
+	antithetic_ = antithetic;
+	commonRandomNumbers_ = crn || antithetic;
+}
+
+
 std::vector<double>
 SimulationEngineNosplit::transient_simulations(const PropertyTransient& property,
                                                const size_t& numRuns) const
 {
 	assert(0ul < numRuns);
-	std::vector< double > raresCount(numRuns, 0.0l);
 	Traial& traial = TraialPool::get_instance().get_traial();
 
 	// For the sake of efficiency, distinguish when operating with a concrete ifun
 	const EventWatcher& watch_events = impFun_->concrete_simulation()
 	        ? std::bind(&SimulationEngineNosplit::transient_event_concrete, this, _1, _2, _3)
 	        : std::bind(&SimulationEngineNosplit::transient_event,          this, _1, _2, _3);
+	auto simulate = [&] () -> double
+		{
+			traial.initialise(*model_, *impFun_);
+			Event e = model_->simulation_step(traial, property, watch_events);
+			return IS_RARE_EVENT(e) ? 1.0l : 0.0l;
+		};
 
-	// Perform 'numRuns' independent standard Monte Carlo simulations
-	for (size_t i = 0ul ; i < numRuns && !interrupted ; i++) {
-		traial.initialise(*model_, *impFun_);
-		Event e = model_->simulation_step(traial, property, watch_events);
-		raresCount[i] = IS_RARE_EVENT(e) ? 1.0l : 0.0l;
+	// Perform 'numRuns' independent standard Monte Carlo simulations,
+	// or 'numRuns/2' antithetic pairs whose averages are the samples
+	const size_t numSamples(antithetic_ ? std::max(1ul, numRuns/2ul) : numRuns);
+	std::vector< double > raresCount(numSamples, 0.0l);
+	for (size_t i = 0ul ; i < numSamples && !interrupted ; i++) {
+		if (commonRandomNumbers_)
+			Clock::new_replication();
+		raresCount[i] = simulate();
+		if (antithetic_) {
+			Clock::antithetic_replication();
+			raresCount[i] = (raresCount[i] + simulate()) / 2.0;
+		}
 	}
 	TraialPool::get_instance().return_traial(std::move(traial));
 
@@ -97,6 +125,105 @@ SimulationEngineNosplit::transient_simulations(const PropertyTransient& property
 }
 
 
+void
+SimulationEngineNosplit::simulate_shared(
+    const std::vector< const PropertyTransient* >& properties,
+    const FollowerCIs& cis,
+    const std::function<void(const size_t&)>& monitor) const
+{
+	assert(properties.size() == cis.size());
+	if (!bound())
+		throw_FigException("engine isn't bound to any importance function");
+	if (interrupted)
+		throw_FigException("called with an interrupted simulation");
+	if (properties.empty())
+		return;
+
+	const size_t NUM_PROPS(properties.size());
+	const size_t minBatchSize(transient_batch_size());
+	size_t batchSize(minBatchSize);
+	std::vector< std::vector< double > > raresCount(NUM_PROPS,
+	                                                std::vector<double>(batchSize));
+	std::vector< double > firstOfPair(NUM_PROPS);
+	std::vector< size_t > active, pending;
+	active.reserve(NUM_PROPS);
+	pending.reserve(NUM_PROPS);
+	size_t run(0ul);
+
+	// Decide the properties which observe an event in the current state;
+	// the trace can stop when no property remains pending
+	const EventWatcher watch_events = [&] (const Property&, Traial& traial, Event&) -> bool
+		{
+			for (auto it = begin(pending) ; it != end(pending) ; ) {
+				const PropertyTransient& prop(*properties[*it]);
+				if (prop.is_rare(traial.state)) {
+					raresCount[*it][run] = 1.0;
+					it = pending.erase(it);
+				} else if (prop.is_stop(traial.state)) {
+					raresCount[*it][run] = 0.0;
+					it = pending.erase(it);
+				} else {
+					++it;
+				}
+			}
+			return interrupted || pending.empty();
+		};
+
+	std::vector< unsigned > telemetryIds;
+	for (const auto& prop: properties)
+		telemetryIds.push_back(telemetry_start(*prop));
+
+	Traial& traial = TraialPool::get_instance().get_traial();
+	auto simulate = [&] ()
+		{
+			pending = active;
+			traial.initialise(*model_, *impFun_);
+			model_->simulation_step(traial, *properties[active.front()], watch_events);
+		};
+	while (!interrupted) {
+		active.clear();
+		for (auto i = 0ul ; i < NUM_PROPS ; i++)
+			if (!cis[i]->is_valid())
+				active.push_back(i);
+		if (active.empty())
+			break;
+		const size_t numSamples(antithetic_ ? std::max(1ul, batchSize/2ul) : batchSize);
+		for (const auto& i: active)
+			raresCount[i].resize(numSamples);
+		const double start(omp_get_wtime());
+		// Perform 'batchSize' standard Monte Carlo simulations shared by
+		// all the properties which still need more samples,
+		// or 'batchSize/2' antithetic pairs whose averages are the samples
+		for (run = 0ul ; run < numSamples && !interrupted ; run++) {
+			if (commonRandomNumbers_)
+				Clock::new_replication();
+			simulate();
+			if (antithetic_) {
+				for (const auto& i: active)
+					firstOfPair[i] = raresCount[i][run];
+				Clock::antithetic_replication();
+				simulate();
+				for (const auto& i: active)
+					raresCount[i][run] = (raresCount[i][run] + firstOfPair[i]) / 2.0;
+			}
+		}
+		if (interrupted)
+			break;  // don't update interrupted simulations
+		for (const auto& i: active) {
+			dynamic_cast<ConfidenceIntervalTransient&>(*cis[i]).update(raresCount[i]);
+			if (monitor)
+				monitor(i);
+			telemetry_batch(telemetryIds[i], *cis[i]);
+		}
+		batchSize = tune_batch_size(batchSize, omp_get_wtime()-start, minBatchSize);
+		end_of_batch();
+	}
+	TraialPool::get_instance().return_traial(std::move(traial));
+	for (auto i = 0ul ; i < NUM_PROPS ; i++)
+		telemetry_end(telemetryIds[i], *cis[i]);
+}
+
+
 double
 SimulationEngineNosplit::rate_simulation(const PropertyRate& property,
 										 const size_t& runLength,
@@ -157,6 +284,73 @@ SimulationEngineNosplit::rate_simulation(const PropertyRate& property,
 }
 
 
+std::vector< std::pair< double, double > >
+SimulationEngineNosplit::regenerative_simulations(const PropertyRate& property,
+                                                  const size_t& numCycles) const
+{
+	assert(0ul < numCycles);
+	std::vector< std::pair< double, double > > cycles;
+	cycles.reserve(numCycles);
+	StateInstance regenState;
+	double rareTime(0.0), lastTime(0.0);
+	bool wasRare(false), started(false), stalled(false);
+	size_t steps(0ul);
+
+	// Accumulate the time spent on rare states until the cycle ends,
+	// viz. until the simulation returns to the regeneration state
+	const EventWatcher watch_cycle = [&] (const Property& prop, Traial& traial, Event&) -> bool
+		{
+			stalled = ++steps > MAX_CYCLE_STEPS;
+			if (wasRare)
+				rareTime += static_cast<double>(traial.lifeTime) - lastTime;
+			lastTime = static_cast<double>(traial.lifeTime);
+			wasRare = prop.is_rare(traial.state);
+			const bool regenerated(started && traial.state == regenState);
+			if (regenState.empty())
+				regenState = traial.state;  // initial state after committed actions
+			started = true;
+			return interrupted || regenerated || stalled;
+		};
+
+	Traial& traial = TraialPool::get_instance().get_traial();
+	auto simulate = [&] () -> std::pair< double, double >
+		{
+			rareTime = lastTime = 0.0;
+			wasRare = started = false;
+			steps = 0ul;
+			traial.initialise(*model_, *impFun_);
+			model_->simulation_step(traial, property, watch_cycle);
+			return std::make_pair(rareTime, lastTime);
+		};
+
+	// Perform 'numCycles' independent regeneration cycles,
+	// or 'numCycles/2' antithetic pairs whose averages are the samples
+	const size_t numSamples(antithetic_ ? std::max(1ul, numCycles/2ul) : numCycles);
+	for (size_t i = 0ul ; i < numSamples && !interrupted ; i++) {
+		if (commonRandomNumbers_)
+			Clock::new_replication();
+		auto cycle = simulate();
+		if (antithetic_ && !stalled) {
+			Clock::antithetic_replication();
+			const auto antiCycle = simulate();
+			cycle.first  = (cycle.first  + antiCycle.first)  / 2.0;
+			cycle.second = (cycle.second + antiCycle.second) / 2.0;
+		}
+		if (stalled)
+			break;
+		if (!interrupted)
+			cycles.emplace_back(cycle);
+	}
+	TraialPool::get_instance().return_traial(std::move(traial));
+	if (stalled)
+		throw_FigException("no regeneration within " + std::to_string(MAX_CYCLE_STEPS)
+		                   + " steps: the initial state is absorbing or too "
+		                   "rarely revisited, estimate with batch means instead");
+
+	return cycles;
+}
+
+
 double
 SimulationEngineNosplit::tbound_ss_simulation(const PropertyTBoundSS& property) const
 {
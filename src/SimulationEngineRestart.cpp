@@ -46,6 +46,9 @@
 #include <PropertyRate.h>
 #include <PropertyTBoundSS.h>
 #include <PropertyTransient.h>
+#include <ThresholdsBuilder.h>
+#include <ModelSuite.h>
+#include <PerfCounters.h>
 
 
 using namespace std::placeholders;  // _1, _2, _3, ...
@@ -57,6 +60,39 @@ using std::end;
 using std::pow;
 
 
+namespace   // // // // // // // // // // // // // // // // // // // // // // //
+{
+
+/// Weight of \p traial which isn't due to the effort of its threshold level,
+/// viz. the compensation of a splitting throttled by a memory budget
+inline double
+weight_of(const fig::Traial& traial)
+{
+	return 0.0 == traial.logWeight ? 1.0 : std::exp(traial.logWeight);
+}
+
+/// Multiply by \p factor the weight of the \p n Traials on top of \p stack
+void
+reweigh_top(std::stack< fig::Reference< fig::Traial > >& stack,
+            size_t n,
+            const double& factor)
+{
+	const double logFactor(std::log(factor));
+	std::vector< fig::Reference< fig::Traial > > top;
+	top.reserve(n);
+	for ( ; 0ul < n ; n--) {
+		top.push_back(stack.top());
+		stack.pop();
+	}
+	for (auto it = top.rbegin() ; it != top.rend() ; ++it) {
+		it->get().logWeight += logFactor;
+		stack.push(*it);
+	}
+}
+
+} // namespace   // // // // // // // // // // // // // // // // // // // // //
+
+
 namespace fig  // // // // // // // // // // // // // // // // // // // // // //
 {
 
@@ -67,7 +103,9 @@ SimulationEngineRestart::SimulationEngineRestart(
         SimulationEngine("restart", model, thresholds),
         dieOutDepth_(0u),
         oTraial_(TraialPool::get_instance().get_traial()),
-        currentSimLength_(0.0)
+        currentSimLength_(0.0),
+        retuneEffort_(false),
+        maxTraials_(0ul)
 {
 	if (thresholds)
 		throw_FigException("RESTART engine has not yet been implemented "
@@ -104,6 +142,7 @@ SimulationEngineRestart::bind(std::shared_ptr< const ImportanceFunction > ifun_p
 		throw_FigException("RESTART simulation engine requires an importance "
 						   "building strategy other than \"flat\"");
 	reinit_stack();
+	effort_.clear();  // thresholds are built after binding
 	SimulationEngine::bind(ifun_ptr);
 }
 
@@ -118,6 +157,77 @@ SimulationEngineRestart::set_die_out_depth(unsigned dieOutDepth)
 }
 
 
+void
+SimulationEngineRestart::set_effort_retuning(bool retune)
+{
+	if (locked())
+		throw_FigException("engine \"" + name() + "\" is currently locked "
+		                   "in \"simulation mode\"");
+	retuneEffort_ = retune;
+}
+
+
+void
+SimulationEngineRestart::set_max_traials(size_t maxTraials)
+{
+	if (locked())
+		throw_FigException("engine \"" + name() + "\" is currently locked "
+		                   "in \"simulation mode\"");
+	if (1ul == maxTraials)
+		throw_FigException("RESTART needs room for at least two Traials");
+	maxTraials_ = maxTraials;
+}
+
+
+void
+SimulationEngineRestart::init_effort() const
+{
+	const size_t numLevels(impFun_->num_thresholds()+1ul);
+	if (effort_.size() == numLevels)
+		return;  // already taken from the current ImportanceFunction
+	effort_.resize(numLevels);
+	for (auto l = 0ul ; l < numLevels ; l++)
+		effort_[l] = impFun_->effort_of(static_cast<ImportanceValue>(l));
+	std::vector< double >(numLevels, 0.0).swap(levelUps_);
+	std::vector< double >(numLevels, 0.0).swap(levelStarts_);
+}
+
+
+void
+SimulationEngineRestart::end_of_batch() const
+{
+	if (!retuneEffort_ || interrupted || effort_.size() < 3ul)
+		return;
+	static constexpr unsigned long MIN_EFFORT(2ul);
+	static constexpr unsigned long MAX_EFFORT(ThresholdsBuilder::MAX_EFFORT);
+	bool retuned(false);
+	// Skip level 0 (no splitting) and the uppermost level (no level-up)
+	for (auto l = 1ul ; l < effort_.size()-1ul ; l++) {
+		if (levelStarts_[l] < MIN_RETUNE_SAMPLES)
+			continue;  // too few observations to trust
+		const double pUp(levelUps_[l+1] / levelStarts_[l]);
+		const double target(pUp > 0.0 ? std::round(1.0/pUp)
+		                              : static_cast<double>(MAX_EFFORT));
+		const auto lo(std::max(MIN_EFFORT, effort_[l]/2ul)),
+		           hi(std::min(MAX_EFFORT, effort_[l]*2ul));
+		const auto newEffort(std::min(hi, std::max(lo, static_cast<unsigned long>(
+		                         std::min(target, static_cast<double>(MAX_EFFORT))))));
+		retuned |= newEffort != effort_[l];
+		effort_[l] = newEffort;
+	}
+	if (!retuned)
+		return;
+	// Retrials pending from batch means were split with the old effort:
+	// drop them, so the next batch is simulated with the new one only
+	reinit_stack();
+	if (ModelSuite::get_verbosity()) {
+		figTechLog << "\nEffort re-tuned:";
+		for (auto l = 1ul ; l < effort_.size() ; l++)
+			figTechLog << " " << effort_[l];
+	}
+}
+
+
 void
 SimulationEngineRestart::reinit_stack() const
 {
@@ -133,7 +243,7 @@ SimulationEngineRestart::reinit_stack() const
 
 void
 SimulationEngineRestart::handle_lvl_up(
-    const Traial& traial,
+    Traial& traial,
 	TraialPool& tpool,
     std::stack< Reference < Traial > >& stack) const
 {
@@ -151,12 +261,27 @@ SimulationEngineRestart::handle_lvl_up(
 	for (auto i = 1 ; i <= traial.numLevelsCrossed ; i++) {
 		assert(impFun_->max_value() >= static_cast<ImportanceValue>(previousLvl+i));
 		prevEffort *= currEffort;
-		currEffort = impFun_->effort_of(previousLvl+i);
+		currEffort = effort_of(previousLvl+i);
 		assert(1ul < currEffort);
-		tpool.get_traial_copies(stack,
-		                        traial,
-		                        prevEffort*(currEffort-1),
-		                        i-traial.numLevelsCrossed);
+		if (retuneEffort_) {
+			levelUps_[previousLvl+i] += prevEffort;
+			levelStarts_[previousLvl+i] += prevEffort*currEffort;
+		}
+		const unsigned long numCopies(prevEffort*(currEffort-1));
+		const unsigned long room(maxTraials_ > stack.size() ? maxTraials_-stack.size() : 0ul);
+		if (0ul == maxTraials_ || numCopies <= room) {
+			tpool.get_traial_copies(stack, traial, numCopies, i-traial.numLevelsCrossed);
+		} else if (0ul < room) {
+			// Memory budget exceeded: the copies are identically distributed,
+			// so fewer of them weighing more keep the estimates unbiased
+			tpool.get_traial_copies(stack, traial, room, i-traial.numLevelsCrossed);
+			reweigh_top(stack, room, static_cast<double>(numCopies)/room);
+		} else {
+			// No room at all: the traial stands for all its copies
+			// (and so do the copies later made of it)
+			traial.logWeight += std::log(static_cast<double>(numCopies+1ul));
+		}
+		FIG_PERF_COUNT_AT(SPLIT, previousLvl+i, numCopies);
 	}
 }
 
@@ -167,7 +292,7 @@ SimulationEngineRestart::transient_simulations(const PropertyTransient& property
 {
 	assert(0u < numRuns);
 	const unsigned numThresholds(impFun_->num_thresholds());
-	std::vector< unsigned > raresCount(numThresholds+1, 0u);
+	std::vector< double > raresCount(numThresholds+1, 0.0);
 	std::vector< double > weighedRaresCount(numRuns, 0.0l);
 	std::stack< Reference< Traial > > stack;
 	TraialPool& tpool(TraialPool::get_instance());
@@ -180,6 +305,7 @@ SimulationEngineRestart::transient_simulations(const PropertyTransient& property
 
 	if (reachCount_.size() != numThresholds+1)
 		reachCount_.clear();
+	init_effort();
 
 	// For the sake of efficiency, distinguish when operating with a concrete ifun
 	EventWatcher watch_events = impFun_->concrete_simulation()
@@ -189,7 +315,7 @@ SimulationEngineRestart::transient_simulations(const PropertyTransient& property
 	// Perform 'numRuns' independent RESTART simulations
 	for (size_t i = 0ul ; i < numRuns && !interrupted ; i++) {
 
-		std::fill(begin(raresCount), end(raresCount), 0u);  // reset counts
+		std::fill(begin(raresCount), end(raresCount), 0.0);  // reset counts
 		tpool.get_traials(stack, 1u);
 		stack.top().get().initialise(*model_, *impFun_);
 
@@ -204,7 +330,7 @@ SimulationEngineRestart::transient_simulations(const PropertyTransient& property
 			watch_events(property, traial, e);
 			if (IS_RARE_EVENT(e)) {
 				// We are? Then count and kill
-				raresCount[traial.level]++;
+				raresCount[traial.level] += weight_of(traial);
 				tpool.return_traial(std::move(traial));
 				stack.pop();
 				continue;
@@ -216,6 +342,7 @@ SimulationEngineRestart::transient_simulations(const PropertyTransient& property
 			// Checking order is relevant!
 			if (IS_STOP_EVENT(e) || IS_THR_DOWN_EVENT(e)) {
 				// Traial reached a stop event or went down => kill it
+				FIG_PERF_COUNT_AT(KILL, traial.level, 1ul);
 				tpool.return_traial(std::move(traial));  // alternative way: tpool.return_traial(stack.top());
 				stack.pop();
 
@@ -232,7 +359,7 @@ SimulationEngineRestart::transient_simulations(const PropertyTransient& property
 		weighedRaresCount[i] = 0.0l;
 		double effort(1.0);
 		for (auto t = 0u ; t <= numThresholds ; t++) {
-			effort *= impFun_->effort_of(t);
+			effort *= effort_of(t);
 			weighedRaresCount[i] += raresCount[t] / effort;
 		}
 		assert(!std::isnan(weighedRaresCount.back()));
@@ -257,6 +384,7 @@ SimulationEngineRestart::rate_simulation(const PropertyRate& property,
 	simsLifetime = static_cast<CLOCK_INTERNAL_TYPE>(runLength);
 	if (reachCount_.size() != numThresholds+1 || reinit)
 		decltype(reachCount_)().swap(reachCount_);
+	init_effort();
 
 	// Reset batch or run with batch means?
 	if (reinit || ssstack_.empty()) {
@@ -316,6 +444,7 @@ SimulationEngineRestart::tbound_ss_simulation(const PropertyTBoundSS& property)
 
 	// Run a single RESTART simulation:
 	decltype(reachCount_)().swap(reachCount_);
+	init_effort();
 	reinit_stack();
 	assert(ssstack_.size() == 1ul);
 	assert(&oTraial_ == &ssstack_.top().get());
@@ -374,7 +503,7 @@ SimulationEngineRestart::RESTART_run(const SSProperty& property,
 			model_->simulation_step(traial, property, register_time);
 			assert(static_cast<CLOCK_INTERNAL_TYPE>(0.0) < traial.lifeTime);
 			traial.lifeTime = std::min(traial.lifeTime, simsLifetime-currentSimLength_);
-			raresCount[traial.level] += static_cast<double>(traial.lifeTime);
+			raresCount[traial.level] += weight_of(traial) * static_cast<double>(traial.lifeTime);
 			traial.lifeTime += currentSimLength_;
 		}
 
@@ -386,6 +515,7 @@ SimulationEngineRestart::RESTART_run(const SSProperty& property,
 		if (traial.lifeTime > simsLifetime || IS_THR_DOWN_EVENT(e)) {
 			// Traial reached EOS or went down => kill it
 			assert(!(&traial==&oTraial_ && IS_THR_DOWN_EVENT(e)));
+			FIG_PERF_COUNT_AT(KILL, traial.level, 1ul);
 			if (&traial != &oTraial_)  // avoid future aliasing!
 				tpool.return_traial(std::move(traial));
 			ssstack_.pop();
@@ -407,7 +537,7 @@ SimulationEngineRestart::RESTART_run(const SSProperty& property,
 	double weighedAccTime(0.0);
 	unsigned long effort(1ul);
 	for (auto t = 0u ; t <= numThresholds ; t++) {
-		effort *= impFun_->effort_of(t);
+		effort *= effort_of(t);
 		weighedAccTime += raresCount[t] / effort;
 	}
 	// Return the (weighed) simulation-time spent on rare states
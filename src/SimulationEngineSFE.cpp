@@ -27,15 +27,18 @@
 //==============================================================================
 
 // C++
+#include <chrono>
 #include <unordered_map>
 #include <algorithm>   // std::fill(), std::max_element(), std::move()
 #include <functional>  // std::bind()
 // FIG
 #include <SimulationEngineSFE.h>
 #include <ThresholdsBuilderAdaptive.h>
+#include <ModelReplicas.h>
 #include <PropertyTransient.h>
 #include <TraialPool.h>
 #include <ModelSuite.h>
+#include <PerfCounters.h>
 
 // ADL
 using std::begin;
@@ -163,13 +166,31 @@ SimulationEngineSFE::fixed_effort(ThresholdsPathCandidates& result,
 	pathToRare.reserve(LVL_MAX);
 	traialsNow.reserve(EFF_MAX);
 	traialsNext.reserve(EFF_MAX);
+	if (nullptr == replicas_)
+		replicas_ = std::make_shared< ModelReplicas >(*model_, *impFun_, property_);
+	const ModelReplicas& replicas(*replicas_);
+	std::vector< char > levelUp;  // not bool: written concurrently
+	levelUp.reserve(EFF_MAX);
+
+	// When building thresholds, measure the cost of simulating each level
+	if (toBuildThresholds_)
+		levelCost_.clear();
 
 	// Bootstrap the Fixed Effort run
-	Traial& seedTraial(tpool.get_traial());
-	seedTraial.initialise(*model_, *impFun_);
-	traialsNext.push_back(seedTraial);
 	size_t numSuccesses;
 	ImportanceValue l = LVL_INI;
+	const bool checkpoint(toBuildThresholds_ && keepCheckpoint);
+	if (toBuildThresholds_ && resumeFromCheckpoint && !checkpointTraials_.empty()) {
+		// Pick up from the level where the last run was checkpointed,
+		// whose simulations start from copies of the checkpointed Traials
+		pathToRare = checkpointPath_;
+		levelCost_ = checkpointCost_;
+		l = checkpointLevel_;
+	} else {
+		Traial& seedTraial(tpool.get_traial());
+		seedTraial.initialise(*model_, *impFun_);
+		traialsNext.push_back(seedTraial);
+	}
 
 	// Run Fixed Effort: For each threshold level 'l' ...
 	do {
@@ -180,17 +201,28 @@ SimulationEngineSFE::fixed_effort(ThresholdsPathCandidates& result,
 		if (LVL_EFFORT == 0ul && toBuildThresholds_) {
 			// we deviate from a designated path: abort simulation
 			pathToRare.clear();
+			levelCost_.clear();
 			result.clear();
 			break;
 		}
 		assert(LVL_EFFORT > 0ul);
         assert(traialsNow.empty());
-        assert(!traialsNext.empty());
+		// When checkpointing, the Traials entering the level are kept aside
+		// and all simulations run on copies of them; a resumed run finds
+		// them already there
+		if (checkpoint && !traialsNext.empty())
+			save_checkpoint(pathToRare, l, traialsNext);
+		const auto& entry(checkpoint ? checkpointTraials_ : traialsNext);
+        assert(!entry.empty());
         for (auto i = 0ul ; i < LVL_EFFORT ; i++) {
-            const bool useFresh(i >= traialsNext.size());
+            const bool useFresh(checkpoint || i >= entry.size());
 			Traial& traial(useFresh ? tpool.get_traial() : traialsNext[i].get());
-			if (useFresh)
-				traial = traialsNext[i%traialsNext.size()].get();  // copy *contents*
+			if (useFresh) {
+				traial = entry[i%entry.size()].get();  // copy *contents*
+				if (i >= entry.size()) {
+					FIG_PERF_COUNT_AT(SPLIT, l, 1ul);
+				}
+			}
             assert(traial.level == l);
             traial.depth = 0;
 			traialsNow.push_back(traial);
@@ -201,25 +233,41 @@ SimulationEngineSFE::fixed_effort(ThresholdsPathCandidates& result,
 		std::move(begin(traialsNext), end(traialsNext), std::back_inserter(traials_));
 		traialsNext.clear();
 		reachCountLocal.clear();
+		const unsigned long stepsBefore(model_->num_steps());
+		const auto timeBefore(toBuildThresholds_ ? std::chrono::steady_clock::now()
+		                                         : std::chrono::steady_clock::time_point());
 		// ... run Fixed Effort until any level > 'l' ...
-		for (auto i = 0ul ; i < LVL_EFFORT ; i++) {
-            Traial& traial(traialsNow.back());
-			traialsNow.pop_back();
+		levelUp.assign(LVL_EFFORT, 0);
+		replicas.run(LVL_EFFORT, interrupted,
+		             [&](const size_t& i, const ModuleNetwork& network, const Property* property) {
+			Traial& traial(traialsNow[i]);
 			assert(traial.level < LVL_MAX+(toBuildThresholds_?0:1));
-			model_->simulation_step(traial, *property_, watch_events);
-			if (traial.level > l || property_->is_rare(traial.state))
+			network.simulation_step(traial, *property, watch_events);
+			levelUp[i] = traial.level > l || property->is_rare(traial.state);
+		});
+		// ... gather the results in order ...
+		for (auto i = 0ul ; i < LVL_EFFORT ; i++) {
+			Traial& traial(traialsNow[i]);
+			if (levelUp[i])
 				numSuccesses++;
 			if (traial.level > l) {
 				traialsNext.push_back(traial);
 				reachCount_[traial.level]++;
 				reachCountLocal[traial.level]++;
 			} else {
+				FIG_PERF_COUNT_AT(KILL, l, 1ul);
 				tpool.return_traial(traial);
 			}
         }
-		assert(traialsNow.empty());
+		traialsNow.clear();
 		// ... and interpret the results
 		pathToRare.emplace_back(l, static_cast<double>(numSuccesses)/LVL_EFFORT);
+		if (toBuildThresholds_) {
+			const std::chrono::duration<double> elapsed(
+			        std::chrono::steady_clock::now() - timeBefore);
+			levelCost_.emplace_back(static_cast<double>(model_->num_steps()-stepsBefore)/LVL_EFFORT,
+			                        elapsed.count()/LVL_EFFORT);
+		}
 		if (!traialsNext.empty()) {
 			auto nextLvl = filter_next_value(traialsNext, reachCountLocal);
 			assert(l < nextLvl);
@@ -227,8 +275,10 @@ SimulationEngineSFE::fixed_effort(ThresholdsPathCandidates& result,
 				nextLvl = LVL_MAX;  // patch for badly chosen arbitraryMaxLevel
 			assert(nextLvl <= LVL_MAX);
 			l = nextLvl;
-			if (toBuildThresholds_ && l == LVL_MAX)
+			if (toBuildThresholds_ && l == LVL_MAX) {
 				pathToRare.emplace_back(l,1.0);
+				levelCost_.emplace_back(0.0,0.0);  // nothing simulated here
+			}
 		}
 	} while (!traialsNext.empty() &&
 			 l < LVL_MAX + (toBuildThresholds_ ? 0 : 1 ));
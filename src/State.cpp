@@ -394,6 +394,28 @@ State<T_>::encode() const
 }
 
 
+template< typename T_ >
+size_t
+State<T_>::encode(const StateInstance& s) const
+{
+	const size_t numVars(size());
+	assert(s.size() >= numVars);
+	size_t n(0);
+	for (size_t i=0 ; i < numVars ; i++) {
+#ifndef NDEBUG
+		if (!pvars_[i]->is_valid_value(s[i]))
+			throw_FigException("invalid value " + std::to_string(s[i]) +
+			                   " for variable \"" + pvars_[i]->name() + "\"");
+#endif
+		size_t stride(1);
+		for (size_t j = i+1 ; j < numVars; j++)
+			stride *= pvars_[j]->range_;
+		n += pvars_[i]->offset(s[i]) * stride;
+	}
+	return n;
+}
+
+
 template< typename T_ >
 const State<T_>&
 State<T_>::decode(const size_t& n)
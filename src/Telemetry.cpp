@@ -0,0 +1,364 @@
+//==============================================================================
+//
+//  Telemetry.cpp
+//
+//  Copyleft 2026-
+//  Authors:
+//  - The FIG contributors
+//
+//------------------------------------------------------------------------------
+//
+//  This file is part of FIG.
+//
+//  The Finite Improbability Generator (FIG) project is free software;
+//  you can redistribute it and/or modify it under the terms of the GNU
+//  General Public License as published by the Free Software Foundation;
+//  either version 3 of the License, or (at your option) any later version.
+//
+//  FIG is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with FIG; if not, write to the Free Software Foundation,
+//	Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+//==============================================================================
+
+
+// C
+#include <unistd.h>  // sysconf()
+// C++
+#include <cmath>     // std::isfinite()
+#include <cstring>   // std::strncpy(), std::memset()
+#include <fstream>
+#include <iostream>
+#include <iomanip>   // std::setprecision()
+// FIG
+#include <Telemetry.h>
+#include <TraialPool.h>
+#include <ConfidenceInterval.h>
+#include <FigException.h>
+
+
+namespace  // // // // // // // // // // // // // // // // // // // // // // //
+{
+
+/// Resident set size of this process in kB, or 0 if it can't be told
+unsigned long
+rss_kb()
+{
+	static const long PAGE_KB(sysconf(_SC_PAGESIZE) / 1024l);
+	std::ifstream statm("/proc/self/statm");
+	unsigned long size(0ul), resident(0ul);
+	if (!(statm >> size >> resident) || PAGE_KB <= 0l)
+		return 0ul;
+	return resident * static_cast<unsigned long>(PAGE_KB);
+}
+
+
+/// Name of the records' kind as written in the stream
+const char*
+kind_str(const fig::TelemetryRecord::Kind& kind)
+{
+	switch (kind) {
+	case fig::TelemetryRecord::START: return "start";
+	case fig::TelemetryRecord::BATCH: return "batch";
+	case fig::TelemetryRecord::LEVEL: return "level";
+	case fig::TelemetryRecord::END:   return "end";
+	}
+	return "unknown";
+}
+
+
+/// Write \p x as a JSON number, i.e. null if it isn't finite
+struct json_number
+{
+	const double& x;
+	friend std::ostream& operator<<(std::ostream& out, const json_number& n)
+	    { return std::isfinite(n.x) ? (out << n.x) : (out << "null"); }
+};
+
+
+/// Write \p str between quotes, escaping the characters given
+void
+quoted(std::ostream& out, const char* str, const char* escapes, char escapeWith)
+{
+	out << '"';
+	for (const char* c = str ; '\0' != *c ; c++) {
+		if (nullptr != std::strchr(escapes, *c))
+			out << escapeWith;
+		out << *c;
+	}
+	out << '"';
+}
+
+} // namespace   // // // // // // // // // // // // // // // // // // // // //
+
+
+
+namespace fig  // // // // // // // // // // // // // // // // // // // // // //
+{
+
+// Static variables initialization
+
+std::atomic< bool > Telemetry::enabled_(false);
+
+constexpr size_t Telemetry::BUFFER_SIZE;
+
+constexpr std::chrono::milliseconds Telemetry::FLUSH_PERIOD;
+
+
+// Telemetry class member functions
+
+Telemetry::Telemetry() :
+    out_(nullptr),
+    format_(Format::JSON),
+    buffer_(new std::array< TelemetryRecord, BUFFER_SIZE >),
+    head_(0ul),
+    tail_(0ul),
+    dropped_(0ul),
+    nextEstimation_(0u),
+    origin_(Clock::now()),
+    stop_(false)
+{ /* Not much to do around here */ }
+
+
+Telemetry&
+Telemetry::get_instance()
+{
+	static Telemetry instance;
+	return instance;
+}
+
+
+Telemetry::~Telemetry()
+{
+	close();
+}
+
+
+void
+Telemetry::open(const std::string& target, Format format)
+{
+	close();
+	if ("stdout" == target) {
+		out_ = &std::cout;
+	} else if ("stderr" == target) {
+		out_ = &std::cerr;
+	} else {
+		file_.reset(new std::ofstream(target));
+		if (!file_->good()) {
+			file_.reset();
+			throw_FigException("couldn't open telemetry file \"" + target + "\"");
+		}
+		out_ = file_.get();
+	}
+	format_ = format;
+	head_ = tail_ = 0ul;
+	dropped_ = 0ul;
+	nextEstimation_ = 0u;
+	last_.clear();
+	origin_ = Clock::now();
+	stop_ = false;
+
+	if (Format::CSV == format_)
+		(*out_) << "event,estimation,time,samples,estimate,variance,half_width,"
+		           "steps,steps_per_sec,traials_alive,pool_size,rss_kb,level,"
+		           "reach_count,label\n";
+	writer_ = std::thread([this] () {
+		std::unique_lock<std::mutex> lock(mutex_);
+		while (!wakeUp_.wait_for(lock, FLUSH_PERIOD, [this]{ return stop_; }))
+			flush();
+		flush();
+	});
+	enabled_ = true;
+}
+
+
+void
+Telemetry::close()
+{
+	if (!writer_.joinable())
+		return;
+	enabled_ = false;
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		stop_ = true;
+	}
+	wakeUp_.notify_all();
+	writer_.join();
+	if (0ul < dropped_ && nullptr != out_) {
+		if (Format::JSON == format_)
+			(*out_) << "{\"event\":\"dropped\",\"records\":" << dropped_ << "}\n";
+		else
+			(*out_) << "dropped,,,,,,,,,,,,,," << dropped_ << "\n";
+	}
+	out_->flush();
+	file_.reset();
+	out_ = nullptr;
+}
+
+
+unsigned
+Telemetry::start(const std::string& label, const unsigned long& steps)
+{
+	TelemetryRecord record = new_record(TelemetryRecord::START, nextEstimation_++);
+	record.steps = steps;
+	std::strncpy(record.label, label.c_str(), sizeof(record.label)-1ul);
+	push(record);
+	return record.estimation;
+}
+
+
+void
+Telemetry::batch(const unsigned& estimation,
+                 const ConfidenceInterval& ci,
+                 const unsigned long& steps)
+{
+	TelemetryRecord record = new_record(TelemetryRecord::BATCH, estimation);
+	record.samples = ci.num_samples();
+	record.estimate = ci.point_estimate();
+	record.variance = ci.estimation_variance();
+	record.halfWidth = ci.precision(ci.confidence) / 2.0;
+	record.steps = steps;
+	push(record);
+}
+
+
+void
+Telemetry::level(const unsigned& estimation,
+                 const unsigned& level,
+                 const unsigned long& reachCount)
+{
+	TelemetryRecord record = new_record(TelemetryRecord::LEVEL, estimation);
+	record.level = level;
+	record.reachCount = reachCount;
+	push(record);
+}
+
+
+void
+Telemetry::end(const unsigned& estimation,
+               const ConfidenceInterval& ci,
+               const unsigned long& steps)
+{
+	TelemetryRecord record = new_record(TelemetryRecord::END, estimation);
+	record.samples = ci.num_samples();
+	record.estimate = ci.point_estimate();
+	record.variance = ci.estimation_variance();
+	record.halfWidth = ci.precision(ci.confidence) / 2.0;
+	record.steps = steps;
+	push(record);
+}
+
+
+TelemetryRecord
+Telemetry::new_record(const TelemetryRecord::Kind& kind,
+                      const unsigned& estimation) const
+{
+	TelemetryRecord record;
+	std::memset(&record, 0, sizeof(record));
+	record.kind = kind;
+	record.estimation = estimation;
+	record.time = now();
+	record.traialsAlive = TraialPool::get_instance().num_traials_in_use();
+	record.poolSize = TraialPool::get_instance().num_traials();
+	return record;
+}
+
+
+void
+Telemetry::push(const TelemetryRecord& record)
+{
+	const size_t head(head_.load(std::memory_order_relaxed));
+	if (head - tail_.load(std::memory_order_acquire) >= BUFFER_SIZE) {
+		dropped_.fetch_add(1ul, std::memory_order_relaxed);
+		return;  // never block the simulations
+	}
+	(*buffer_)[head % BUFFER_SIZE] = record;
+	head_.store(head+1ul, std::memory_order_release);
+}
+
+
+void
+Telemetry::flush()
+{
+	size_t tail(tail_.load(std::memory_order_relaxed));
+	const size_t head(head_.load(std::memory_order_acquire));
+	if (tail == head)
+		return;
+	const unsigned long rss(rss_kb());
+	for ( ; tail < head ; tail++)
+		write((*buffer_)[tail % BUFFER_SIZE], rss);
+	tail_.store(tail, std::memory_order_release);
+	out_->flush();
+}
+
+
+void
+Telemetry::write(const TelemetryRecord& record, const unsigned long& rss)
+{
+	std::ostream& out(*out_);
+
+	// Simulation steps per second since the last record of the estimation
+	double stepsPerSec(0.0);
+	if (TelemetryRecord::LEVEL != record.kind) {
+		auto& last = last_[record.estimation];
+		if (TelemetryRecord::START != record.kind
+		        && record.time > last.second && record.steps >= last.first)
+			stepsPerSec = (record.steps - last.first) / (record.time - last.second);
+		last = std::make_pair(record.steps, record.time);
+		if (TelemetryRecord::END == record.kind)
+			last_.erase(record.estimation);
+	}
+
+	out << std::setprecision(6) << std::defaultfloat;
+	if (Format::JSON == format_) {
+		out << "{\"event\":\"" << kind_str(record.kind) << "\""
+		    << ",\"estimation\":" << record.estimation
+		    << ",\"time\":" << json_number{record.time};
+		switch (record.kind) {
+		case TelemetryRecord::START:
+			out << ",\"steps\":" << record.steps << ",\"label\":";
+			quoted(out, record.label, "\"\\", '\\');
+			break;
+		case TelemetryRecord::LEVEL:
+			out << ",\"level\":" << record.level
+			    << ",\"reach_count\":" << record.reachCount;
+			break;
+		case TelemetryRecord::BATCH:
+		case TelemetryRecord::END:
+			out << ",\"samples\":" << record.samples
+			    << ",\"estimate\":" << json_number{record.estimate}
+			    << ",\"variance\":" << json_number{record.variance}
+			    << ",\"half_width\":" << json_number{record.halfWidth}
+			    << ",\"steps\":" << record.steps
+			    << ",\"steps_per_sec\":" << json_number{stepsPerSec};
+			break;
+		}
+		out << ",\"traials_alive\":" << record.traialsAlive
+		    << ",\"pool_size\":" << record.poolSize
+		    << ",\"rss_kb\":" << rss << "}\n";
+	} else {
+		out << kind_str(record.kind) << ',' << record.estimation << ','
+		    << record.time << ',' << record.samples << ','
+		    << record.estimate << ',' << record.variance << ','
+		    << record.halfWidth << ',' << record.steps << ','
+		    << stepsPerSec << ',' << record.traialsAlive << ','
+		    << record.poolSize << ',' << rss << ','
+		    << record.level << ',' << record.reachCount << ',';
+		quoted(out, record.label, "\"", '"');
+		out << '\n';
+	}
+}
+
+
+double
+Telemetry::now() const
+{
+	return std::chrono::duration<double>(Clock::now() - origin_).count();
+}
+
+} // namespace fig  // // // // // // // // // // // // // // // // // // // //
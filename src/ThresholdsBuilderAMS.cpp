@@ -34,11 +34,12 @@
 #include <vector>
 #include <memory>
 #include <sstream>
-#include <algorithm>  // std::sort(), std::max({})
+#include <algorithm>  // std::max({})
 #include <unordered_map>
 // FIG
 #include <ThresholdsBuilderAMS.h>
 #include <ImportanceFunctionConcrete.h>
+#include <ModelReplicas.h>
 #include <ModelSuite.h>
 
 
@@ -59,33 +60,33 @@ const unsigned MAX_NUM_FAILURES = 5u;
  * @brief Simulate in network exploring the states importance to find thresholds
  *
  *        Use the first 'numSims' Traials from 'traials' to perform
- *        \ref fig::ModuleNetwork::peak_simulation "peak simulations" in
- *        'network' lasting 'simEffort' synchronized jumps each.
+ *        \ref fig::ModuleNetwork::peak_simulation "peak simulations"
+ *        lasting 'simEffort' synchronized jumps each, in parallel if the
+ *        'replicas' of the model allow it.
  *        Use 'impFun' to consult the visited states' importance.
  *
- * @param network   User's system model, i.e. a network of modules
+ * @param replicas  User's system model, i.e. a network of modules,
+ *                  with a copy per thread
  * @param impFun    ImportanceFunction with \ref ImportanceFunction::has_importance_info()
  *                  "importance info" for all concrete states
  * @param traials   Vector of size >= numSims with references to Traials
  * @param numSims   Number of Traials to simulate with
  * @param simEffort Number of synchronized jumps each simulation will incur in
- * @param halt      For external (thread-parallel) signalling: halt computation
+ * @param halt      For external (thread-parallel) signalling: halt computation,
+ *                  also checked against its deadline in between simulations
  */
 void
-simulate(const fig::ModuleNetwork& network,
+simulate(const fig::ModelReplicas& replicas,
 		 const fig::ImportanceFunction& impFun,
 		 TraialsVec& traials,
 		 const unsigned& numSims,
 		 const unsigned& simEffort,
-		 const bool& halt)
+		 const fig::CancellationToken& halt)
 {
 	assert(traials.size() >= numSims);
-	unsigned jumpsLeft;
+	const ImportanceValue MAX_IMP(impFun.max_value());
 
 	// Function pointers matching supported signatures (ModuleNetwork::peak_simulation())
-    auto predicate = [&jumpsLeft, &impFun](const fig::Traial& t) -> bool {
-        return --jumpsLeft > 0u && t.level < impFun.max_value();
-	};
     auto update = [&impFun](fig::Traial& t) -> void {
 		t.level = impFun.importance_of(t.state);
 	};
@@ -94,12 +95,17 @@ simulate(const fig::ModuleNetwork& network,
 	// However ModuleNetwork::peak_simulation() templetized interface
 	// has no problem taking lambdas as arguments.
 
-	for (size_t i = 0ul ; i < numSims && !halt ; i++) {
-		jumpsLeft = simEffort;
+	replicas.run(numSims, halt,
+	             [&](const size_t& i, const fig::ModuleNetwork& network, const fig::Property*) {
+		unsigned jumpsLeft(simEffort);  // one count per simulation (and thread)
+		auto predicate = [&jumpsLeft, &MAX_IMP](const fig::Traial& t) -> bool {
+			return --jumpsLeft > 0u && t.level < MAX_IMP;
+		};
 		network.peak_simulation(traials[i], update, predicate);
-	}
+	});
 }
 
+
 } // namespace  // // // // // // // // // // // // // // // // // // // // //
 
 
@@ -136,19 +142,17 @@ ThresholdsBuilderAMS::build_thresholds_vector(
 		std::vector< ImportanceValue >().swap(thresholds_);
 	if (thresholds_.capacity() < MAX_NUM_THRESHOLDS)
 		thresholds_.reserve(MAX_NUM_THRESHOLDS);
-	auto lesser = [](const Traial& lhs, const Traial& rhs)
-				  { return lhs.level < rhs.level; };
-
 	unsigned failures(0u), simEffort(MIN_SIM_EFFORT);
 	TraialsVec traials = ThresholdsBuilderAdaptive::get_traials(n_, impFun);
-	const ModuleNetwork& network = *ModelSuite::get_instance().modules_network();
+	const ModelReplicas replicas(*ModelSuite::get_instance().modules_network(), impFun);
 
 	// AMS initialization
 	thresholds_.push_back(impFun.initial_value());  // start from initial state importance
 	assert(thresholds_.back() < impFun.max_value());
 	do {
-		simulate(network, impFun, traials, n_, simEffort, halted_);
-		std::sort(begin(traials), end(traials), lesser);
+		simulate(replicas, impFun, traials, n_, simEffort, halted_);
+		// Only the 1-k_/n_ importance quantile matters: no need to sort
+		select_quantile(begin(traials), begin(traials)+(n_-k_), end(traials));
     } while (thresholds_.back() == traials[n_-k_].get().level
              && (simEffort *= 2u));
     if (impFun.max_value() <= traials[n_-k_].get().level)
@@ -157,6 +161,8 @@ ThresholdsBuilderAMS::build_thresholds_vector(
 	else if (traials[n_-k_].get().level <= thresholds_.back())
 		goto exit_with_fail;  // couldn't make it, so sad
 	thresholds_.push_back(traials[n_-k_].get().level);
+	levelUpFracs_.push_back(fraction_reached(begin(traials), end(traials),
+	                                         thresholds_.back()));
 	simEffort = MIN_SIM_EFFORT;
 
 	// AMS main loop
@@ -164,14 +170,16 @@ ThresholdsBuilderAMS::build_thresholds_vector(
 		// Relaunch all n_-k_ simulations below previously built threshold
 		for (size_t i = 0ul ; i < n_-k_ ; i++)
 			traials[i].get() = traials[n_-k_];  // copy values, not addresses
-		simulate(network, impFun, traials, n_-k_, simEffort, halted_);
+		simulate(replicas, impFun, traials, n_-k_, simEffort, halted_);
         // New 1-k_/n_ importance quantile should be the new threshold
-		std::sort(begin(traials), end(traials), lesser);
+		select_quantile(begin(traials), begin(traials)+(n_-k_), end(traials));
         const ImportanceValue newThreshold = traials[n_-k_].get().level;
 		if (thresholds_.back() < newThreshold && !halted_) {
 			// Found valid new threshold
 			fig::ModelSuite::tech_log("+");
 			thresholds_.push_back(newThreshold);
+			levelUpFracs_.push_back(fraction_reached(begin(traials), end(traials),
+			                                         newThreshold));
 			simEffort = MIN_SIM_EFFORT;
 			failures = 0u;
         } else {
@@ -27,10 +27,19 @@
 //==============================================================================
 
 
+// C
+#include <cmath>
+// C++
+#include <iterator>   // std::distance()
+#include <algorithm>  // std::nth_element(), std::count_if()
+#if defined _OPENMP && defined __GLIBCXX__
+#  include <parallel/algorithm>  // __gnu_parallel::nth_element()
+#endif
 // FIG
 #include "ThresholdsBuilderAdaptive.h"
 #include <ModelSuite.h>
 #include <TraialPool.h>
+#include <FigException.h>
 
 
 namespace fig  // // // // // // // // // // // // // // // // // // // // // //
@@ -44,10 +53,32 @@ bool ThresholdsBuilderAdaptive::highVerbosity = ModelSuite::get_verbosity();
 ThresholdsBuilderAdaptive::ThresholdsBuilderAdaptive(const unsigned& n) :
     n_(n),
     thresholds_(),
-    halted_(false)
+    halted_()
 { /* Not much to do around here */ }
 
 
+void
+ThresholdsBuilderAdaptive::set_prior(const ImportanceVec& levels,
+                                     const std::vector< double >& Pup)
+{
+	if (levels.size() != Pup.size())
+		throw_FigException("got " + std::to_string(levels.size()) + " levels "
+		                   "but " + std::to_string(Pup.size()) + " level-up "
+		                   "probabilities to warm start from");
+	assert(std::is_sorted(levels.begin(), levels.end()));
+	priorLevels_ = levels;
+	priorPup_ = Pup;
+}
+
+
+void
+ThresholdsBuilderAdaptive::clear_prior() noexcept
+{
+	ImportanceVec().swap(priorLevels_);
+	std::vector< double >().swap(priorPup_);
+}
+
+
 void
 ThresholdsBuilderAdaptive::tune(const size_t& numTrans,
                                 const ImportanceValue& maxImportance,
@@ -95,4 +126,85 @@ ThresholdsBuilderAdaptive::get_traials(const unsigned& numTraials,
 	return traials;
 }
 
+
+bool
+ThresholdsBuilderAdaptive::thresholds_from_prior(const ImportanceFunction& impFun,
+                                                 const double& pUp,
+                                                 ImportanceVec& thresholds) const
+{
+	assert(0.0 < pUp && pUp < 1.0);
+	assert(priorLevels_.size() == priorPup_.size());
+	const ImportanceValue IMP_INI(impFun.initial_value(true)),
+	                      IMP_MAX(impFun.max_value(true));
+	ImportanceVec({IMP_INI}).swap(thresholds);
+	if (priorLevels_.size() < 2ul || priorLevels_.front() < IMP_INI
+	        || priorLevels_.back() > IMP_MAX)
+		return false;  // prior doesn't match this ImportanceFunction
+
+	// Accumulate the "rarity" -log(P) of the prior levels, and place a
+	// threshold each time it grows another -log(pUp) from the previous one
+	const double STEP(-std::log(pUp));
+	double rarity(0.0), nextThr(STEP);
+	auto i = 0ul;
+	for ( ; i < priorLevels_.size()-1ul ; i++) {
+		const double& p(priorPup_[i]);
+		if (!(0.0 < p && p <= 1.0))
+			break;  // unknown from here on
+		const double LO(priorLevels_[i]), HI(priorLevels_[i+1]),
+		             LVL_RARITY(-std::log(p));
+		while (rarity+LVL_RARITY >= nextThr && 0.0 < LVL_RARITY) {
+			const auto thr = static_cast<ImportanceValue>(std::ceil(
+			                     LO + (HI-LO)*(nextThr-rarity)/LVL_RARITY));
+			if (thr > thresholds.back() && thr <= IMP_MAX)
+				thresholds.push_back(thr);
+			nextThr += STEP;
+			if (thresholds.size() > MAX_NUM_THRESHOLDS)
+				return false;
+		}
+		rarity += LVL_RARITY;
+	}
+	return priorLevels_.size()-1ul == i;
+}
+
+
+void
+ThresholdsBuilderAdaptive::record_levels(const ImportanceVec& thresholds,
+                                         const std::vector< double >& pUp)
+{
+	assert(1ul < thresholds.size());
+	lastLevels_.assign(thresholds.begin(), thresholds.end()-1);
+	lastPup_.assign(lastLevels_.size(), 0.0);
+	for (auto i = 0ul ; i < lastPup_.size() && i < pUp.size() ; i++)
+		lastPup_[i] = pUp[i];
+}
+
+
+void
+ThresholdsBuilderAdaptive::select_quantile(TraialsVec::iterator first,
+                                           TraialsVec::iterator nth,
+                                           TraialsVec::iterator last)
+{
+	assert(first <= nth);
+	assert(nth < last);
+	auto lesser = [](const Traial& lhs, const Traial& rhs)
+				  { return lhs.level < rhs.level; };
+#if defined _OPENMP && defined __GLIBCXX__
+	__gnu_parallel::nth_element(first, nth, last, lesser);
+#else
+	std::nth_element(first, nth, last, lesser);
+#endif
+}
+
+
+double
+ThresholdsBuilderAdaptive::fraction_reached(TraialsVec::const_iterator first,
+                                            TraialsVec::const_iterator last,
+                                            const ImportanceValue& imp)
+{
+	assert(first < last);
+	const auto reached = std::count_if(first, last, [&imp](const Traial& t)
+	                                                { return t.level >= imp; });
+	return static_cast<double>(reached) / std::distance(first, last);
+}
+
 } // namespace fig  // // // // // // // // // // // // // // // // // // // //
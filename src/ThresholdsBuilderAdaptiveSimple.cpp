@@ -32,11 +32,30 @@
 #include <cassert>
 // C++
 #include <vector>
+#include <iterator>   // std::distance()
+#include <algorithm>  // std::partition()
 // External code
 #include <uint128_t.h>  // uint128::uint128_0
 // FIG
 #include <ThresholdsBuilderAdaptiveSimple.h>
+#include <ModuleNetwork.h>
 #include <ModelSuite.h>
+#include <Property.h>
+#include <Traial.h>
+
+// ADL
+using std::begin;
+using std::end;
+
+
+namespace  // // // // // // // // // // // // // // // // // // // // // // //
+{
+
+/// Max simulation length (in # of jumps) to go up a level in a warm start pilot
+const unsigned PILOT_SIM_LENGTH = 1u<<10;  // 1024
+
+} // namespace  // // // // // // // // // // // // // // // // // // // // //
+
 
 
 namespace fig  // // // // // // // // // // // // // // // // // // // // // //
@@ -49,7 +68,8 @@ ThresholdsBuilderAdaptiveSimple::ThresholdsBuilderAdaptiveSimple(
         property_(nullptr),
         globEff_(0u),
         k_(k),
-        thresholds_()
+        thresholds_(),
+        levelUpFracs_()
 { /* Not much to do around here */ }
 
 
@@ -74,6 +94,22 @@ ThresholdsBuilderAdaptiveSimple::build_thresholds(std::shared_ptr<const Importan
 		goto consistency_check;
 	}
 
+	// Warm start: refine the levels of a previous run if possible
+	if (has_prior()) {
+		if (thresholds_from_prior(*impFun, 1.0/globEff_, thresholds_)
+		        && pilot_thresholds(*impFun, 1.0/globEff_, thresholds_)) {
+			thresholds_.push_back(impFun->max_value()+1);
+			ModelSuite::tech_log("Refined thresholds of a previous run with \""
+			                     + name + "\" for global effort = "
+			                     + std::to_string(globEff_) + "\n");
+			show_thresholds(thresholds_);
+			record_levels(thresholds_, levelUpFracs_);
+			goto consistency_check;
+		}
+		ModelSuite::tech_log("Levels of the previous run don't reach the rare "
+		                     "event: building thresholds from scratch\n");
+	}
+
 	// Choose values for n_ and k_
 	simEngineName_ = impFun->sim_engine_bound();
 	tune(ModelSuite::get_instance().modules_network()->num_transitions(),
@@ -85,8 +121,10 @@ ThresholdsBuilderAdaptiveSimple::build_thresholds(std::shared_ptr<const Importan
 						 + std::to_string(static_cast<float>(k_)/n_) + "\n");
 
 	// Run the adaptive algorithm to choose the thresholds
+	levelUpFracs_.clear();
 	build_thresholds_vector(*impFun);
 	show_thresholds(thresholds_);
+	record_levels(thresholds_, levelUpFracs_);
 consistency_check:
 	assert(!thresholds_.empty());
 	assert(thresholds_[0] == impFun->initial_value());
@@ -104,6 +142,75 @@ consistency_check:
 }
 
 
+bool
+ThresholdsBuilderAdaptiveSimple::pilot_thresholds(const ImportanceFunction& impFun,
+                                                  const double& pUp,
+                                                  ImportanceVec& thresholds)
+{
+	assert(!thresholds.empty());
+	assert(nullptr != property_);
+	const ImportanceValue MAX_IMP(impFun.max_value());
+	const ModuleNetwork& network = *ModelSuite::get_instance().modules_network();
+	TraialsVec traials = get_traials(MIN_N, impFun);
+	ImportanceValue target;
+	unsigned jumpsLeft;
+
+	// Function pointers matching ModuleNetwork::peak_simulation() signature
+	auto predicate = [&](const Traial& t) -> bool {
+		return --jumpsLeft > 0u
+		        && target > t.level
+		        && !property_->is_stop(t.state);
+	};
+	auto update = [&impFun](Traial& t) -> void {
+		t.level = impFun.importance_of(t.state);
+	};
+
+	// Go up the levels measuring the fraction of simulations that make it
+	bool reached(true);
+	levelUpFracs_.clear();
+	for (auto i = 0ul ; reached && i < thresholds.size() && thresholds[i] < MAX_IMP ; i++) {
+		target = i+1ul < thresholds.size() ? thresholds[i+1] : MAX_IMP;
+		for (Traial& t: traials) {
+			jumpsLeft = PILOT_SIM_LENGTH;
+			network.peak_simulation(t, update, predicate);
+		}
+		const auto up = std::partition(begin(traials), end(traials),
+		                               [&target](const Traial& t)
+		                               { return t.level >= target; });
+		const auto numUp = std::distance(begin(traials), up);
+		reached = 0 < numUp && !halted_.expired();
+		if (!reached) {
+			thresholds.resize(i+1ul);
+			break;
+		}
+		levelUpFracs_.push_back(static_cast<double>(numUp) / traials.size());
+		// Split the simulations that went up to replace the rest
+		for (auto it = up ; it != end(traials) ; ++it)
+			it->get() = traials[std::distance(up, it) % numUp];  // copy values, not addresses
+	}
+	TraialPool::get_instance().return_traials(traials);
+
+	// Merge consecutive levels that together are no rarer than pUp
+	ImportanceVec merged(1ul, thresholds.front());
+	std::vector< double > mergedFracs;
+	for (auto i = 0ul ; i < thresholds.size() ; i++) {
+		const bool measured(i < levelUpFracs_.size());
+		if (0ul < i && measured && mergedFracs.back() * levelUpFracs_[i] >= pUp) {
+			mergedFracs.back() *= levelUpFracs_[i];
+			continue;  // drop thresholds[i]
+		}
+		if (0ul < i)
+			merged.push_back(thresholds[i]);
+		if (measured)
+			mergedFracs.push_back(levelUpFracs_[i]);
+	}
+	thresholds.swap(merged);
+	levelUpFracs_.swap(mergedFracs);
+
+	return reached;
+}
+
+
 void
 ThresholdsBuilderAdaptiveSimple::tune(const size_t& numTrans,
                                       const ImportanceValue& maxImportance,
@@ -33,7 +33,7 @@
 #include <vector>
 #include <deque>
 #include <memory>      // std::make_unique<>
-#include <algorithm>   // std::fill()
+#include <algorithm>   // std::fill(), std::all_of()
 #include <functional>  // std::bind()
 #include <iomanip>     // std::setprecision()
 // FIG
@@ -208,7 +208,8 @@ ThresholdsBuilderES::ThresholdsBuilderES(
     property_(nullptr),
     model_(nullptr),
 	impFun_(nullptr),
-	internalSimulator_(make_unique<SimulationEngineSFE>(model, true))
+	internalSimulator_(make_unique<SimulationEngineSFE>(model, true)),
+    costAware_(false)
 { /* Not much to do around here */ }
 
 
@@ -234,9 +235,18 @@ ThresholdsBuilderES::build_thresholds(std::shared_ptr<const ImportanceFunction>
 						+ "\" for num_sims,sim_len = " + str(n_)
 						+ "," + str(maxSimLen_));
 
-	// Probe for reachable importance values to select threshold candidates
+	// Probe for reachable importance values to select threshold candidates,
+	// unless we can warm start from the levels of a previous run
 	const bool forceRealMax(0.0 <= ModelSuite::get_DFT());
-	ImportanceVec thrCandidates(reachable_importance_values(forceRealMax));
+	const bool warm(has_prior()
+	                && priorLevels_.front() >= initial_importance(*impFun_)
+	                && priorLevels_.back() <= max_importance(*impFun_)
+	                && std::all_of(begin(priorPup_), end(priorPup_),
+	                               [](const double& p) { return 0.0 < p; }));
+	if (warm)
+		ModelSuite::tech_log("; refining the thresholds of a previous run");
+	ImportanceVec thrCandidates(warm ? priorLevels_
+	                                 : reachable_importance_values(forceRealMax));
 	if (thrCandidates.size() < 2ul)  // we must have reached beyond initial importance
 		throw_FigException("ES could not find reachable importance values");
 	if (highVerbosity) {
@@ -247,12 +257,17 @@ ThresholdsBuilderES::build_thresholds(std::shared_ptr<const ImportanceFunction>
 	}
 
 	// Estimate probabilities of going from one (reachable) importance value to the next
-	auto Pup = FE_for_ES(thrCandidates);
+	auto Pup = FE_for_ES(thrCandidates, warm);
 	assert(!currentThresholds_.empty());  // could we build something?
 	assert(!Pup.empty());
 	process_artificial_thresholds(Pup);
 	if (highVerbosity)
 		print_lvlup(Pup);
+	assert(currentThresholds_.size() == Pup.size());
+	lastLevels_.resize(Pup.size());
+	for (auto i = 0ul ; i < Pup.size() ; i++)
+		lastLevels_[i] = currentThresholds_[i].first;
+	lastPup_.assign(begin(Pup), end(Pup));
 
 	// SimualtionEngineRestart can't split on initial! Patch if this is the case:
 	const auto IMP_INI = initial_importance(*impFun_);
@@ -264,10 +279,13 @@ ThresholdsBuilderES::build_thresholds(std::shared_ptr<const ImportanceFunction>
 
 	// Turn level-up probabilities into effort factors
 	auto effort(Pup);
-	std::fill(begin(effort), end(effort), static_cast<decltype(effort)::value_type>(0));
-	for (auto i = 0ul ; i < Pup.size() ; i++) {
-		const auto prev = effort[(i-1)%Pup.size()];
-		effort[i] = 1.0f/Pup[i] + (prev-std::round(prev));  // E [# sims to move up from lvl i]
+	for (auto i = 0ul ; i < Pup.size() ; i++)
+		effort[i] = 1.0f/Pup[i];  // E [# sims to move up from lvl i]
+	if (costAware_)
+		cost_aware_effort(effort, levelCost_);  // ...per unit of work
+	for (auto i = 1ul ; i < effort.size() ; i++) {
+		const auto prev = effort[i-1];
+		effort[i] += prev-std::round(prev);  // carry the rounding leftovers
 	}
 
 	// Select the thresholds based on the effort factors
@@ -292,6 +310,56 @@ ThresholdsBuilderES::build_thresholds(std::shared_ptr<const ImportanceFunction>
 }
 
 
+void
+ThresholdsBuilderES::cost_aware_effort(std::vector< float >& effort,
+                                       const std::vector< double >& levelCost)
+{
+	// Levels not measured (e.g. artificial ones) take the cost of the
+	// closest measured level below them
+	std::vector< double > cost(effort.size(), 0.0);
+	double last(0.0);
+	for (auto i = 0ul ; i < effort.size() ; i++) {
+		if (i < levelCost.size() && 0.0 < levelCost[i])
+			last = levelCost[i];
+		cost[i] = last;
+	}
+	if (std::none_of(begin(cost), end(cost), [](const double& c) { return 0.0 < c; }))
+		return;  // nothing measured
+	for (auto i = 0ul ; i < effort.size() && 0.0 >= cost[i] ; i++)
+		cost[i] = *std::find_if(begin(cost), end(cost),
+		                        [](const double& c) { return 0.0 < c; });
+
+	// Optimal allocation for fixed work: n_i ∝ sqrt(variance_i / cost_i)
+	// Levels without splitting (e.g. the initial one) are left untouched
+	double work(0.0), newWork(0.0);
+	std::vector< double > rescaled(effort.size());
+	for (auto i = 0ul ; i < effort.size() ; i++) {
+		if (effort[i] <= 1.0f)
+			continue;
+		rescaled[i] = effort[i] / std::sqrt(cost[i]);
+		work += effort[i] * cost[i];
+		newWork += rescaled[i] * cost[i];
+	}
+	if (0.0 >= newWork)
+		return;  // no splitting anywhere
+	const double norm(work/newWork);
+	for (auto i = 0ul ; i < effort.size() ; i++) {
+		if (effort[i] <= 1.0f)
+			continue;
+		const double e = std::min<double>(MAX_COST_RESCALE*effort[i],
+		                 std::max<double>(effort[i]/MAX_COST_RESCALE,
+		                                  rescaled[i]*norm));
+		effort[i] = static_cast<float>(std::max(1.0, e));
+	}
+
+	if (highVerbosity) {
+		ModelSuite::tech_log("\nCost-aware efforts (level cost, effort):");
+		for (auto i = 0ul ; i < effort.size() ; i++)
+			ModelSuite::tech_log(" (" + str(cost[i]) + "," + str(effort[i]) + ")");
+	}
+}
+
+
 ImportanceVec
 ThresholdsBuilderES::reachable_importance_values(bool forceRealMax)
 {
@@ -395,7 +463,8 @@ ThresholdsBuilderES::reachable_importance_values(bool forceRealMax)
  * @todo Improve modularisation
  */
 std::vector< float >
-ThresholdsBuilderES::FE_for_ES(const ImportanceVec& reachableImportanceValues)
+ThresholdsBuilderES::FE_for_ES(const ImportanceVec& reachableImportanceValues,
+                               bool warm)
 {
 	static constexpr auto NUM_PATHS = 3ul;
 	using namespace std::placeholders;  // _1, _2, ...
@@ -410,6 +479,8 @@ ThresholdsBuilderES::FE_for_ES(const ImportanceVec& reachableImportanceValues)
 
 	// Use reachableImportanceValues as candidates to paths to the rare event
 	std::vector<PathCandidate> paths(NUM_PATHS);
+	PathContent bestPath;
+	auto idx = 0ul;
 	decltype(currentThresholds_)().swap(currentThresholds_);
 	currentThresholds_.reserve(reachableImportanceValues.size());
 	for (auto i = 0ul ; i < reachableImportanceValues.size() ; i++)
@@ -422,10 +493,15 @@ ThresholdsBuilderES::FE_for_ES(const ImportanceVec& reachableImportanceValues)
 	maxImportanceLvl = reachableImportanceValues.back();
 	level_effort = [&](const unsigned&) -> unsigned long { return n_; };
 
-	// Check possible (importance) paths to the rare event
+	// Check possible (importance) paths to the rare event;
+	// when a probe dies midway, double the effort and resume it from the
+	// level where it died, reusing the Traials that had reached that level
+	if (warm)
+		goto warm_start;
 	if (highVerbosity)
 		ModelSuite::tech_log("\nLooking for feasible paths to the rare event: ");
-	auto idx = 0ul;
+	internalSimulator_->keepCheckpoint = true;
+	internalSimulator_->resumeFromCheckpoint = false;
 	do {
 		internalSimulator_->fixed_effort(paths[idx], watch_events);
 		const auto& path(paths[idx]);
@@ -433,20 +509,32 @@ ThresholdsBuilderES::FE_for_ES(const ImportanceVec& reachableImportanceValues)
 			continue;
 		if (path.front().back().first < reachableImportanceValues.back() && n_ < MAX_N) {
 			ModelSuite::tech_log(highVerbosity ? ("*") : (""));
+			internalSimulator_->resumeFromCheckpoint = true;
 			n_ *= 2;
 		} else {
+			internalSimulator_->resumeFromCheckpoint = false;
 			auto updatePrint = !highVerbosity ? ("") :
 				path.front().back().first < reachableImportanceValues.back() ? ("-") : ("+");
 			ModelSuite::tech_log(updatePrint);
 			idx++;
 		}
 	} while (idx < NUM_PATHS);
+	internalSimulator_->keepCheckpoint = false;
+	internalSimulator_->resumeFromCheckpoint = false;
+	internalSimulator_->clear_checkpoint();
 
 	//\///////////////////////////////////////////////////////////////////
 	// Step #2: choose the best path from step #1 and settle for it alone
 
-	auto bestPath = choose_best_path_to_rare(paths);
+	bestPath = choose_best_path_to_rare(paths);
 	/// @todo TODO: ^^^ hardcoded for SimulationEngineSFE: generalise!
+warm_start:
+	if (warm) {
+		// The previous run chose the path and estimated its probabilities
+		assert(reachableImportanceValues.size() == priorPup_.size());
+		for (auto i = 0ul ; i < priorPup_.size() ; i++)
+			bestPath.emplace_back(reachableImportanceValues[i], priorPup_[i]);
+	}
 	assert(bestPath.size() <= reachableImportanceValues.size());
 	if (highVerbosity) {
 		ModelSuite::tech_log("\nChosen path visits "+str(bestPath.size())+" ImportanceValues:");
@@ -511,6 +599,7 @@ ThresholdsBuilderES::FE_for_ES(const ImportanceVec& reachableImportanceValues)
 	static constexpr auto NUM_SAMPLES_FROM_BEST_PATH = NUM_PATHS;
 	decltype(paths)().swap(paths);
 	paths.reserve(NUM_SAMPLES_FROM_BEST_PATH);
+	std::vector< decltype(internalSimulator_->levelCost_) > costs;
 	auto maxSteps = bestPath.size();
 	ModelSuite::tech_log("\nRunning internal Fixed Effort [");
 	do {
@@ -526,6 +615,7 @@ ThresholdsBuilderES::FE_for_ES(const ImportanceVec& reachableImportanceValues)
 		ModelSuite::tech_log(0.0 >= newPath.back().second ? "-" : "+");
 		maxSteps = std::max(maxSteps, newPath.size());
 		paths.emplace_back(std::move(pathWrapper));
+		costs.emplace_back(internalSimulator_->levelCost_);
 	} while (paths.size() < NUM_SAMPLES_FROM_BEST_PATH);
 	paths.emplace_back(PathCandidate(1,std::move(bestPath)));
 	ModelSuite::tech_log("]");
@@ -550,6 +640,27 @@ ThresholdsBuilderES::FE_for_ES(const ImportanceVec& reachableImportanceValues)
 		Pup.emplace_back(0u < num ? acc/static_cast<decltype(acc)>(num) : 0.0);
 	}
 
+	// Average the cost of simulating each level in those runs: use
+	// wall-clock time unless it's below the clock resolution somewhere
+	std::vector< double > steps(maxSteps, 0.0), secs(maxSteps, 0.0);
+	bool timed(true);
+	for (auto i = 0ul ; i < maxSteps ; i++) {
+		auto num(0u);
+		for (const auto& cost: costs) {
+			if (cost.size() <= i || 0.0 >= cost[i].first)
+				continue;
+			num++;
+			steps[i] += cost[i].first;
+			secs[i] += cost[i].second;
+		}
+		if (0u < num) {
+			steps[i] /= num;
+			secs[i] /= num;
+			timed &= 0.0 < secs[i];
+		}
+	}
+	levelCost_ = timed ? secs : steps;
+
 	internalSimulator_->unbind();
 	internalSimulator_->property_ = nullptr;
 	return Pup;
@@ -30,12 +30,10 @@
 // C
 #include <cassert>
 #include <cmath>
-#include <pthread.h>
 // C++
 #include <utility>
 #include <sstream>
-#include <thread>
-#include <functional>  // std::ref()
+#include <chrono>
 // FIG
 #include <ThresholdsBuilderHybrid.h>
 #include <ImportanceFunction.h>
@@ -69,53 +67,69 @@ ThresholdsBuilderHybrid::setup(std::shared_ptr<const Property> prop,
 ThresholdsVec
 ThresholdsBuilderHybrid::build_thresholds(std::shared_ptr<const ImportanceFunction> impFun)
 {
-	// Impose an execution wall time limit...
-	const std::chrono::minutes TIMEOUT = ADAPTIVE_TIMEOUT;  // take by value!
-	std::thread timer([] (bool& halt, const std::chrono::minutes& limit)
-					  { std::this_thread::sleep_for(limit); halt=true; },
-					  std::ref(halted_), TIMEOUT);
-	try {
-		// Start out using an adaptive technique, which may just work btw...
-		halted_ = false;
-		ThresholdsBuilderSMC::build_thresholds(impFun);
-		pthread_cancel(timer.native_handle());  // ...it worked!
-
-	} catch (FigException&) {
-		// Adaptive algorithm couldn't finish but achievements remain
-		// stored in the vector member 'thresholds_'
-		assert(thresholds_.empty() ||
-		       thresholds_.back() >= impFun->initial_value());
-		const size_t MARGIN(thresholds_.empty() ? impFun->initial_value()
-		                                        : thresholds_.back());
-		if (highVerbosity)
-			figTechLog << "\nSequential Monte Carlo couldn't reach the rare event!"
-					   << "\nArtificial thresholds will be set above the "
-					   << "ImportanceValue " << MARGIN << "\n";
+	// Choose artificial thresholds above whatever the adaptive part built
+	auto complete_artificially = [&] ()
+		{
+			assert(thresholds_.empty() ||
+			       thresholds_.back() >= impFun->initial_value());
+			const size_t MARGIN(thresholds_.empty() ? impFun->initial_value()
+			                                        : thresholds_.back());
+			if (highVerbosity)
+				figTechLog << "\nSequential Monte Carlo couldn't reach the rare event!"
+						   << "\nArtificial thresholds will be set above the "
+						   << "ImportanceValue " << MARGIN << "\n";
+			else
+				figTechLog << "\nChoosing artificial thresholds above " << MARGIN << "\n";
+			postPro_ = impFun->post_processing();
+			stride_ = choose_stride(impFun->max_value()-MARGIN);
+			ThresholdsBuilderFixed::build_thresholds(*impFun,
+			                                         MARGIN-impFun->initial_value(),
+			                                         stride_,
+			                                         thresholds_);
+			halted_.cancel();
+		};
+
+	levelUpFracs_.clear();
+	if (has_prior()) {
+		// Warm start: refine the levels of a previous run with a short pilot,
+		// which spares the adaptive technique altogether
+		halted_.reset();
+		const bool covered = thresholds_from_prior(*impFun, 1.0/globEff_, thresholds_);
+		const bool complete = pilot_thresholds(*impFun, 1.0/globEff_, thresholds_)
+		                      && covered;
+		figTechLog << "\nRefined thresholds of a previous run with \"" << name
+		           << "\" for global effort = " << globEff_ << "\n";
+		if (complete)
+			thresholds_.push_back(impFun->max_value()+1);
 		else
-			figTechLog << "\nChoosing artificial thresholds above " << MARGIN << "\n";
-		postPro_ = impFun->post_processing();
-		stride_ = choose_stride(impFun->max_value()-MARGIN);
-		ThresholdsBuilderFixed::build_thresholds(*impFun,
-		                                         MARGIN-impFun->initial_value(),
-		                                         stride_,
-		                                         thresholds_);
-		halted_ = true;
-
-	} catch (std::exception&) {
-		timer.detach();
-		throw;
+			complete_artificially();
+
+	} else {
+		// Impose an execution wall time limit, checked cooperatively...
+		const std::chrono::minutes TIMEOUT = ADAPTIVE_TIMEOUT;  // take by value!
+		halted_.reset();
+		halted_.set_budget(TIMEOUT);
+		try {
+			// Start out using an adaptive technique, which may just work btw...
+			ThresholdsBuilderSMC::build_thresholds(impFun);
+
+		} catch (FigException&) {
+			// Adaptive algorithm couldn't finish but achievements remain
+			// stored in the vector member 'thresholds_'
+			complete_artificially();
+		}
 	}
 
 	// Tidy-up
 	ImportanceVec thresholds;
 	std::swap(thresholds, thresholds_);
-	timer.detach();
 
-	if (halted_)
+	if (halted_ || has_prior())
 		show_thresholds(thresholds);
 	assert(!thresholds.empty());
 	assert(thresholds[0] == impFun->initial_value());
 	assert(thresholds.back() == 1 + impFun->max_value());
+	record_levels(thresholds, levelUpFracs_);  // artificial levels are unknown
 
 	// Build ThresholdsVec to return
 	ThresholdsVec result;
@@ -31,14 +31,17 @@
 #include <cmath>  // std::log2()
 #include <cassert>
 // C++
-#include <thread>
+#include <atomic>
+#include <chrono>
 #include <random>
+#include <numeric>    // std::iota()
 #include <sstream>
 #include <iterator>   // std::begin(), std::end()
-#include <algorithm>  // std::sort(), std::max({})
+#include <algorithm>  // std::swap(), std::max({})
 // FIG
 #include <ThresholdsBuilderSMC.h>
 #include <ModuleNetwork.h>
+#include <ModelReplicas.h>
 #include <ModelSuite.h>
 #include <Property.h>
 #include <Traial.h>
@@ -55,6 +58,7 @@ namespace  // // // // // // // // // // // // // // // // // // // // // // //
 using fig::Traial;
 using fig::ImportanceValue;
 using TraialsVec = fig::ThresholdsBuilderAdaptive::TraialsVec;
+using SteadyClock = std::chrono::steady_clock;
 
 /// Allowed simulation length (in # of jumps) to find new thresholds
 unsigned SIM_EFFORT = 1u<<6u; // 64
@@ -77,6 +81,17 @@ std::mt19937 RNG(RNG_SEED);
 // ////////////////////////////////////////////////////////////////
 
 
+/// Whether computations must stop, either signalled externally
+/// (viz. 'halt' was cancelled or its deadline expired)
+/// or because the local 'deadline' was reached
+inline bool
+must_stop(const fig::CancellationToken& halt,
+          const SteadyClock::time_point& deadline)
+{
+	return halt.expired() || SteadyClock::now() >= deadline;
+}
+
+
 /**
  * @brief Duplicate the number of simulations used for finding new thresholds
  * @param n       Number of traials to use for reaching states
@@ -106,8 +121,10 @@ increase_simulation_effort(unsigned& n, unsigned& k, TraialsVec& traials)
  *        positions of 'traials', look for states with importance == 'lastThr'
  *        Store them in the last 'k' positions of traials (overwriting previous
  *        information) to use them as initial states in simulations to come.
+ *        The simulations run in parallel if the 'replicas' allow it.
  *
- * @param network User's system model, i.e. a network of modules
+ * @param replicas User's system model, i.e. a network of modules,
+ *                 with a copy per thread
  * @param impFun  ImportanceFunction with
  *                \ref ImportanceFunction::has_importance_info()
  *                "importance info" for all concrete states
@@ -127,13 +144,13 @@ increase_simulation_effort(unsigned& n, unsigned& k, TraialsVec& traials)
  *       first 'n' traials <b>without the need to intialize them beforehand</b>.
  */
 bool
-build_states_distribution(const fig::ModuleNetwork& network,
+build_states_distribution(const fig::ModelReplicas& replicas,
 						  const fig::ImportanceFunction& impFun,
 						  TraialsVec& traials,
 						  const unsigned& n,
 						  const unsigned& k,
 						  const ImportanceValue& lastThr,
-						  const bool& halt)
+						  const fig::CancellationToken& halt)
 {
 	assert(0u < k);
 	assert(k < n);
@@ -144,31 +161,41 @@ build_states_distribution(const fig::ModuleNetwork& network,
 				   OVERLENGTH(IMP_RANGE <  20u ? 1u :
 							  IMP_RANGE > 100u ? 5u : std::round(0.05f*IMP_RANGE)),
 				   SIM_LENGTH(SIM_EFFORT*OVERLENGTH);
-	unsigned jumpsLeft, pos, fails(0u);
 
 	// Function pointers matching ModuleNetwork::peak_simulation() signature
-	auto predicate = [&jumpsLeft,lastThr](const Traial& t) -> bool {
-		return --jumpsLeft > 0u && lastThr != t.level;
-    };
     auto update = [&impFun](Traial& t) -> void {
         t.level = impFun.importance_of(t.state);
     };
 
 	// Starting uniformly random from initial states computed before,
-    // advance the first 'n' traials until they meet a state realizing lastThr
-    std::uniform_int_distribution<unsigned> uniK(0, k-1);
-	for (size_t i = 0ul ; i < n && !halt ; i++) {
-		fails = 0u;
+    // advance the first 'n' traials until they meet a state realizing lastThr.
+	// Each simulation chooses its initial states with its own RNG,
+	// seeded here so that results don't depend on the threads scheduling
+	std::vector< std::mt19937::result_type > seeds(n);
+	for (auto& seed: seeds)
+		seed = RNG();
+	std::atomic< bool > failed(false);
+	replicas.run(n, halt,
+	             [&](const size_t& i, const fig::ModuleNetwork& network, const fig::Property*) {
+		if (failed)
+			return;  // another traial couldn't make it
+		std::mt19937 rng(seeds[i]);
+		std::uniform_int_distribution<unsigned> uniK(0, k-1);
+		unsigned jumpsLeft, fails(0u);
+		auto predicate = [&jumpsLeft,lastThr](const Traial& t) -> bool {
+			return --jumpsLeft > 0u && lastThr != t.level;
+		};
 		Traial& t(traials[i]);
-        do {
+		do {
 			jumpsLeft = SIM_LENGTH * (1u+fails);
-			t = traials[n + uniK(RNG)];  // choose randomly among last 'k'
-//			assert(lastThr <= t.level);  // FIXME is this check logical?
-            network.peak_simulation(t, update, predicate);
-		} while (!halt && lastThr != t.level && ++fails < TOLERANCE);
-	}
-
-	if (fails >= TOLERANCE || halt) {
+			t = traials[n + uniK(rng)];  // choose randomly among last 'k'
+			network.peak_simulation(t, update, predicate);
+		} while (!halt.expired() && lastThr != t.level && ++fails < TOLERANCE);
+		if (fails >= TOLERANCE)
+			failed = true;
+	});
+
+	if (failed || halt.expired()) {
 		// Either halted or couldn't make the 'n' traials reach lastThr
 		fig::ModelSuite::tech_log("*");  // report failure
 		return false;
@@ -176,13 +203,14 @@ build_states_distribution(const fig::ModuleNetwork& network,
 
     // Store 'k' from those 'n' new states as the next-gen initial states
 	// Uniformly choose which will be those 'k' (without repetitions)
-    std::vector<bool> used(n, false);
-    std::uniform_int_distribution<unsigned> uniN(0, n-1);
-	for (size_t i = 0ul ; i < k ; i++) {
-        do { pos = uniN(RNG); } while (used[pos]);
-		traials[n+i].get() = traials[pos];  // copy values, not addresses
-        used[pos] = true;
-    }
+	// via a partial Fisher-Yates shuffle of their positions
+	std::vector<unsigned> positions(n);
+	std::iota(begin(positions), end(positions), 0u);
+	for (unsigned i = 0u ; i < k ; i++) {
+		std::uniform_int_distribution<unsigned> uniRest(i, n-1);
+		std::swap(positions[i], positions[uniRest(RNG)]);
+		traials[n+i].get() = traials[positions[i]];  // copy values, not addresses
+	}
 
 	return true;
 }
@@ -195,9 +223,12 @@ build_states_distribution(const fig::ModuleNetwork& network,
  *        Launch n simulations from initial states chosen randomly among those
  *        realizing 'lastThr' in a previous run. Resulting (1 - k/n) quantile's
  *        importance is proposed as new threshold. Reachable states realizing
- *        such importance are left in the first 'n' positions of 'traials'
+ *        such importance are left in the first 'n' positions of 'traials'.
+ *        The simulations run in parallel if the 'replicas' allow it,
+ *        which must hold the property whose stop states end them.
  *
- * @param network User's system model, i.e. a network of modules
+ * @param replicas User's system model, i.e. a network of modules,
+ *                 and the property, with a copy per thread
  * @param impFun  ImportanceFunction with
  *                \ref ImportanceFunction::has_importance_info()
  *                "importance info" for all concrete states
@@ -209,38 +240,48 @@ build_states_distribution(const fig::ModuleNetwork& network,
  * @param k       Number of initial states to start simulations from
  * @param lastThr ImportanceValue of last chosen threshold, to be overcome
  * @param halt    For external (thread-parallel) signalling: halt computation
+ * @param deadline <i>(Optional)</i> Wall-clock time after which computations
+ *                 are abandoned, checked in between simulations
  *
  * @return New threshold ImportanceValue > lastThr if successfull,
  *         chosen as the 1-k/n quantile of the simulations run
  *         (sorted by maximum importance reached)
  */
 ImportanceValue
-find_new_threshold(const fig::ModuleNetwork& network,
+find_new_threshold(const fig::ModelReplicas& replicas,
 				   const fig::ImportanceFunction& impFun,
-                   const fig::Property& property,
 				   TraialsVec& traials,
 				   const unsigned& n,
 				   const unsigned& k,
 				   const ImportanceValue& lastThr,
-				   const bool& halt)
+				   const fig::CancellationToken& halt,
+				   const SteadyClock::time_point& deadline = SteadyClock::time_point::max())
 {
 	assert(0u < k);
 	assert(k < n);
     assert(traials.size() >= n+k);
     using std::to_string;
-	unsigned jumpsLeft, fails(0u), simEffort(SIM_EFFORT);
+	unsigned fails(0u), simEffort(SIM_EFFORT);
 	const ImportanceValue MAX_IMP(impFun.max_value());
     ImportanceValue newThr(lastThr);
 
 	// Function pointers matching ModuleNetwork::peak_simulation() signatures
-	auto predicate = [&jumpsLeft,&MAX_IMP,&property](const Traial& t) -> bool {
-		return --jumpsLeft > 0u
-		        && MAX_IMP > t.level
-				&& !property.is_stop(t.state);
-    };
     auto update = [&impFun](Traial& t) -> void {
         t.level = impFun.importance_of(t.state);
     };
+	auto simulate = [&](const size_t& i,
+	                    const fig::ModuleNetwork& network,
+	                    const fig::Property* property) {
+		if (must_stop(halt, deadline))
+			return;
+		unsigned jumpsLeft(simEffort);
+		auto predicate = [&jumpsLeft,&MAX_IMP,property](const Traial& t) -> bool {
+			return --jumpsLeft > 0u
+			        && MAX_IMP > t.level
+			        && !property->is_stop(t.state);
+		};
+		network.peak_simulation(traials[i], update, predicate);
+	};
 	// 'reinit' is what happens when the new quantile isn't higher than lastThr
 	auto reinit = [&n, &k, &fails, &simEffort] (TraialsVec& traials) {
 		fig::ModelSuite::tech_log("-");  // report failure
@@ -256,17 +297,15 @@ find_new_threshold(const fig::ModuleNetwork& network,
 
 	do {
 		// Run 'n' simulations
-		for (size_t i = 0ul ; i < n && !halt ; i++) {
-			jumpsLeft = simEffort;
-			network.peak_simulation(traials[i], update, predicate);
-		}
-		// Sort to find 1-k/n quantile
-		std::sort(begin(traials), begin(traials)+n,
-				  [](Traial& lhs, Traial& rhs){return lhs.level < rhs.level;});
+		replicas.run(n, halt, simulate);
+		// Select the 1-k/n quantile
+		fig::ThresholdsBuilderAdaptive::select_quantile(begin(traials),
+		                                                begin(traials)+(n-k),
+		                                                begin(traials)+n);
         newThr = traials[n-k].get().level;
-	} while (!halt && newThr <= lastThr && reinit(traials));
+	} while (!must_stop(halt, deadline) && newThr <= lastThr && reinit(traials));
 
-	if (fails < ::NUM_FAILURES && !halt)
+	if (fails < ::NUM_FAILURES && !must_stop(halt, deadline))
 		fig::ModelSuite::tech_log("+");  // report success
 	else
 		newThr = lastThr;
@@ -331,7 +370,8 @@ ThresholdsBuilderSMC::build_thresholds_vector(const ImportanceFunction& impFun)
 		thresholds_.reserve(MAX_NUM_THRESHOLDS);
 
 	TraialsVec traials = get_traials(n_+k_, impFun);
-	const ModuleNetwork& network = *ModelSuite::get_instance().modules_network();
+	const ModelReplicas replicas(*ModelSuite::get_instance().modules_network(),
+	                             impFun, property_.get());
 	if (highVerbosity)
 		ModelSuite::tech_log("[RNG seed: " + std::to_string(RNG_SEED) + "] ");
 
@@ -340,9 +380,8 @@ ThresholdsBuilderSMC::build_thresholds_vector(const ImportanceFunction& impFun)
 	assert(thresholds_.back() < impFun.max_value());
 	ImportanceValue newThreshold(thresholds_.back());
 	do {
-		newThreshold = find_new_threshold(network,
+		newThreshold = find_new_threshold(replicas,
 										  impFun,
-										  *property_,
 										  traials,
 										  n_,
 										  k_,
@@ -355,37 +394,35 @@ ThresholdsBuilderSMC::build_thresholds_vector(const ImportanceFunction& impFun)
 	else if (newThreshold <= thresholds_.back())
 		goto exit_with_fail;  // couldn't make it
 	thresholds_.push_back(newThreshold);
+	levelUpFracs_.push_back(fraction_reached(begin(traials), begin(traials)+n_,
+	                                         newThreshold));
 
 	// SMC main loop
 	while (thresholds_.back() < impFun.max_value()) {
 		const ImportanceValue lastThr = thresholds_.back();
 		// Find "initial states" (and clocks valuations) realizing last threshold
-		if (!build_states_distribution(network, impFun, traials, n_, k_, lastThr, halted_)
+		if (!build_states_distribution(replicas, impFun, traials, n_, k_, lastThr, halted_)
 		    || halted_)
 			goto exit_with_fail;  // couldn't find those initial states
-		// Impose (hardcoded) time limit
+		// Impose (hardcoded) time limit, checked cooperatively
 		static constexpr std::chrono::seconds TIMEOUT(2ul<<4ul);
-		std::thread timer([] (bool& halt, const std::chrono::seconds& limit)
-						  { std::this_thread::sleep_for(limit); halt=true; },
-						  std::ref(halted_), TIMEOUT);
-		try {
-			// Find sims' 1-k/n quantile starting from those initial states
-			newThreshold = find_new_threshold(network, impFun, *property_,
-			                                  traials,
-			                                  n_, k_,
-			                                  lastThr,
-			                                  halted_);
-			pthread_cancel(timer.native_handle());
-			timer.detach();
-		} catch (...) {
-			timer.detach();
-			throw;
-		}
-		if (halted_)
+		const auto deadline = SteadyClock::now() + TIMEOUT;
+		// Find sims' 1-k/n quantile starting from those initial states
+		newThreshold = find_new_threshold(replicas, impFun,
+		                                  traials,
+		                                  n_, k_,
+		                                  lastThr,
+		                                  halted_,
+		                                  deadline);
+		if (must_stop(halted_, deadline)) {
+			halted_.cancel();
 			goto exit_with_fail;
+		}
 		if (newThreshold > thresholds_.back()) {
 			// If reached an upper level, use it as new threshold...
 			thresholds_.push_back(newThreshold);
+			levelUpFracs_.push_back(fraction_reached(begin(traials), begin(traials)+n_,
+			                                         newThreshold));
 		} else {
 			// ...else increase effort (if feasible) and retry
 			increase_simulation_effort(n_, k_, traials);
@@ -59,6 +59,7 @@ Traial::Traial(const size_t& stateSize, const size_t& numClocks) :
 	numLevelsCrossed(0),
 	nextSplitLevel(1),
 	lifeTime(0.0),
+	logWeight(0.0),
 	state(stateSize),
     orderedIndex_(numClocks),
     clocksValuations_(),
@@ -96,6 +97,7 @@ Traial::Traial(const size_t& stateSize,
 	numLevelsCrossed(0),
 	nextSplitLevel(1),
 	lifeTime(0.0),
+	logWeight(0.0),
 	state(stateSize),
 	orderedIndex_(numClocks),
     clocksValuations_(),
@@ -142,6 +144,7 @@ Traial::Traial(const size_t& stateSize,
 	numLevelsCrossed(0),
 	nextSplitLevel(1),
 	lifeTime(static_cast<CLOCK_INTERNAL_TYPE>(0.0)),
+	logWeight(0.0),
     state(stateSize),
 	orderedIndex_(numClocks),
     clocksValuations_(),
@@ -214,9 +217,11 @@ Traial::clocks_values(bool ordered) const
 }
 
 
+template< class Sampler >
 Traial&
 Traial::initialise(const ModuleNetwork& network,
-				   const ImportanceFunction& impFun)
+				   const ImportanceFunction& impFun,
+				   const Sampler& sample)
 {
 #ifndef NDEBUG
 	if (!network.sealed())
@@ -236,8 +241,9 @@ Traial::initialise(const ModuleNetwork& network,
 	// initialise clocks (reset all and then resample initials)
 	for (auto& timeout : clocks_)
 		timeout.value = 0.0f;
+	logWeight = 0.0;  // before sampling: tilted clocks may update it
 	for (const auto& posCLK: network.initialClocks)
-		clocks_[posCLK.first].value = posCLK.second.sample();  // should be non-negative
+		clocks_[posCLK.first].value = sample(posCLK.second);  // should be non-negative
 	// initialise importance and simulation time
 	level = impFun.ready() ? impFun.level_of(state)
 						   : impFun.importance_of(state);
@@ -247,6 +253,10 @@ Traial::initialise(const ModuleNetwork& network,
 	return *this;
 }
 
+// Traial::initialise() can only be invoked with the following samplers
+template Traial& Traial::initialise(const ModuleNetwork&, const ImportanceFunction&, const SampleClock&);
+template Traial& Traial::initialise(const ModuleNetwork&, const ImportanceFunction&, const Clock::Sampler&);
+
 
 void
 Traial::print_out(std::ostream& ostr, bool flush) const
@@ -40,6 +40,7 @@
 // FIG
 #include <TraialPool.h>
 #include <FigLog.h>
+#include <PerfCounters.h>
 
 // ADL
 using std::begin;
@@ -49,9 +50,6 @@ using std::end;
 namespace   // // // // // // // // // // // // // // // // // // // // // // //
 {
 
-/// We use delicate move-semantics; keep track of the actual memory location
-static fig::Traial* TRAIALS_MEM_ADDR(nullptr);
-
 /// Check whether the TraialPool was requested a positive number of Traials
 /// @return Whether \p numTraials > 0u
 /// @note Print warning if DEBUG mode is on and numTraials == 0u
@@ -80,10 +78,12 @@ std::unique_ptr< TraialPool > TraialPool::instance_ = nullptr;
 
 std::once_flag TraialPool::singleInstance_;
 
-std::vector< Traial > TraialPool::traials_;
+std::deque< Traial > TraialPool::traials_;
 
 std::forward_list< Reference< Traial > > TraialPool::available_traials_;
 
+size_t TraialPool::numAvailable_ = 0ul;
+
 size_t TraialPool::numVariables = 0u;
 
 size_t TraialPool::numClocks = 0u;
@@ -128,6 +128,7 @@ TraialPool::get_traial()
 		ensure_resources(increment_size());  // Need to create more Traials
 	Traial& traial(available_traials_.front());
 	available_traials_.pop_front();
+	numAvailable_--;
 	return traial;
 }
 
@@ -136,6 +137,7 @@ void
 TraialPool::return_traial(Traial&& traial)
 {
 	available_traials_.emplace_front(traial);
+	numAvailable_++;
 }
 
 
@@ -143,6 +145,7 @@ void
 TraialPool::return_traial(Reference<Traial> traial)
 {
 	available_traials_.push_front(traial);
+	numAvailable_++;
 }
 
 
@@ -159,6 +162,7 @@ retrieve_traials:
 	while (!available_traials_.empty() && 0u < --numTraials) {
 		cont.emplace(end(cont), available_traials_.front());
 		available_traials_.pop_front();
+		numAvailable_--;
 	}
 	if (0u < numTraials) {
 		ensure_resources(std::max<unsigned>(numTraials+1, increment_size()));
@@ -182,6 +186,7 @@ TraialPool::get_traials(std::stack< Reference<Traial> >& stack,
 	while (!available_traials_.empty() && 0u < --numTraials) {
 		stack.emplace(available_traials_.front());
 		available_traials_.pop_front();
+		numAvailable_--;
 	}
 	if (0u < numTraials) {
 		ensure_resources(std::max<unsigned>(numTraials++, increment_size()));
@@ -201,6 +206,7 @@ TraialPool::get_traials(std::forward_list< Reference<Traial> >& flist,
 	while (!available_traials_.empty() && 0u < --numTraials) {
 		flist.push_front(available_traials_.front());
 		available_traials_.pop_front();
+		numAvailable_--;
 	}
 	if (0u < numTraials) {
 		ensure_resources(std::max<unsigned>(numTraials++, increment_size()));
@@ -225,6 +231,7 @@ TraialPool::get_traial_copies(Container< Reference<Traial>, OtherArgs...>& cont,
 	while (!available_traials_.empty() && 0u < --numCopies) {
 		Traial& t = available_traials_.front();
 		available_traials_.pop_front();
+		numAvailable_--;
 		t = traial;
 		t.depth = depth;
 		t.nextSplitLevel = 1 + static_cast<decltype(t.nextSplitLevel)>(traial.level);
@@ -264,6 +271,7 @@ TraialPool::get_traial_copies(std::stack< Reference<Traial> >& stack,
 	while (!available_traials_.empty() && 0u < --numCopies) {
 		Traial& t = available_traials_.front();
 		available_traials_.pop_front();
+		numAvailable_--;
 		t = traial;
 		t.depth = depth;
 		t.nextSplitLevel = 1 + static_cast<decltype(t.nextSplitLevel)>(traial.level);
@@ -292,6 +300,7 @@ TraialPool::get_traial_copies(std::stack< Reference< Traial >,
 	while (!available_traials_.empty() && 0u < --numCopies) {
 		Traial& t = available_traials_.front();
 		available_traials_.pop_front();
+		numAvailable_--;
 		t = traial;
 		t.depth = depth;
 		t.nextSplitLevel = 1 + static_cast<decltype(t.nextSplitLevel)>(traial.level);
@@ -318,6 +327,7 @@ TraialPool::get_traial_copies(std::forward_list< Reference<Traial> >& flist,
 	while (!available_traials_.empty() && 0u < --numCopies) {
 		Traial& t = available_traials_.front();
         available_traials_.pop_front();
+        numAvailable_--;
         t = traial;
 		t.depth = depth;
 		t.nextSplitLevel = 1 + static_cast<decltype(t.nextSplitLevel)>(traial.level);
@@ -335,6 +345,7 @@ template< template< typename... > class Container,
 void
 TraialPool::return_traials(Container<Reference<Traial>, OtherArgs...>& traials)
 {
+	numAvailable_ += traials.size();
 	for (Traial& t: traials)
 		available_traials_.push_front(t);
 	traials.clear();  // keep user from tampering with those references
@@ -354,6 +365,7 @@ TraialPool::return_traials(std::stack< Reference< Traial > >& stack)
 	const size_t numTraials(stack.size());
 	for (size_t i = 0ul ; i < numTraials ; i++) {
 		available_traials_.push_front(stack.top());
+		numAvailable_++;
 		stack.pop();
 	}
 }
@@ -368,6 +380,7 @@ TraialPool::return_traials(std::stack< Reference< Traial >,
 	const size_t numTraials(stack.size());
 	for (size_t i = 0ul ; i < numTraials ; i++) {
 		available_traials_.push_front(stack.top());
+		numAvailable_++;
 		stack.pop();
 	}
 }
@@ -379,6 +392,7 @@ TraialPool::return_traials(std::forward_list< Reference< Traial > >& list)
 {
 	for (auto it = list.begin() ; it != list.end() ; it = list.begin()) {
 		available_traials_.push_front(*it);
+		numAvailable_++;
 		list.pop_front();  // 'it' got invalidated
 	}
 }
@@ -393,48 +407,44 @@ TraialPool::ensure_resources(const size_t& requiredResources)
 
 	if (newSize <= oldSize)
 		return;  // nothing to do!
+	FIG_PERF_COUNT(POOL_GROWTH);
 
-	traials_.reserve(newSize);
-	if (0ul == oldSize)  // called by ctor? register mem address
-		::TRAIALS_MEM_ADDR = traials_.data();
-	else if (traials_.data() != ::TRAIALS_MEM_ADDR)  // we're fucked [*]
-		throw_FigException("memory corrupted after reallocation of the "
-		                   "Traials vector; ABORTING");
-
-	// A reservation could have moved the memory segment: reproduce references
-	/// @bug FIXME: references in users' ADTs would still be corrupted [*]
-	available_traials_.clear();
-	for (size_t i = 0ul ; i < oldSize ; i++)
-		available_traials_.emplace_front(std::ref(traials_[i]));
-	// Now create and reference the new Traial instances
+	// Growing the deque at the back doesn't move the Traials in use,
+	// so only the new instances need to be referenced
 	for (size_t i = oldSize ; i < newSize ; i++) {
-//		traials_.push_back(Traial(numVariables, numClocks));  // copy elision
 		traials_.emplace_back(numVariables, numClocks);
-		available_traials_.emplace_front(std::ref(traials_[i]));
+		available_traials_.emplace_front(std::ref(traials_.back()));
 	}
+	numAvailable_ += newSize - oldSize;
+}
+
 
-	assert(traials_.data() == ::TRAIALS_MEM_ADDR);
-
-	/* [*] Important note for developers
-	 *
-	 * Using move semantics to offer the Traial instances may cause system
-	 * malfunctions derived from memory remapings.
-	 * When new resources are needed the OS may choose to reallocate the whole
-	 * 'traials_' vector in a different memory page, which would invalidate
-	 * all the references held by the users of the TraialPool.
-	 *
-	 * We're trying to dodge the problem by reserving a memory space
-	 * for 'traials_' greater than the creation 'INITIAL_SIZE'.
-	 * This is a flimsy workaround: the problem will still arise
-	 * after sufficient new resources requests.
-	 */
+void
+TraialPool::shrink(const size_t& maxTraials)
+{
+	if (traials_.size() <= maxTraials)
+		return;  // nothing to do!
+	std::unordered_set< const Traial* > available(2ul*numAvailable_);
+	for (const Traial& t: available_traials_)
+		available.insert(&t);
+	// Only the last Traials can be freed without moving the others
+	size_t numFreed(0ul);
+	while (traials_.size() > maxTraials && available.erase(&traials_.back()) > 0ul) {
+		traials_.pop_back();
+		numFreed++;
+	}
+	if (0ul == numFreed)
+		return;
+	available_traials_.remove_if([&available] (const Reference<Traial>& t)
+	                             { return available.end() == available.find(&t.get()); });
+	numAvailable_ -= numFreed;
 }
 
 
 size_t
 TraialPool::num_resources() const noexcept
 {
-	return std::distance(begin(available_traials_), end(available_traials_));
+	return numAvailable_;
 }
 
 
@@ -460,6 +470,7 @@ TraialPool::clear()
 	available_traials_.clear();
 //	available_traials_.resize(0ul,traials_.front());
 	traials_.clear();
+	numAvailable_ = 0ul;
 	numVariables = 0ul;
 	numClocks = 0ul;
 }
@@ -64,7 +64,7 @@ Transition::Transition(const Transition& that) :
 }
 
 
-Transition::Transition(Transition&& that) :
+Transition::Transition(Transition&& that) noexcept :
 	label_(std::move(that.label_)),
 	triggeringClock(std::move(that.triggeringClock)),
 	pre(std::move(that.pre)),
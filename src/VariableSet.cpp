@@ -92,6 +92,18 @@ VariableSet<T_>::operator=(const T_& value)
 }
 
 
+template< typename T_ >
+size_t
+VariableSet<T_>::offset(const T_& value) const
+{
+	for (size_t i=0 ; i < values_.size() ; i++)
+		if (value == values_[i])
+			return i;
+	assert(false);  // invalid value
+	return 0ul;
+}
+
+
 template< typename T_ >
 void
 VariableSet<T_>::assign(const T_& value)
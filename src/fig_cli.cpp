@@ -55,6 +55,7 @@
 #include <NumericConstraint.h>
 #include <TimeConstraint.h>
 #include <FigVersionVisitor.h>
+#include <Telemetry.h>
 
 
 using namespace TCLAP;
@@ -82,6 +83,16 @@ size_t rngSeed;
 bool verboseOutput;
 bool forceOperation;
 bool confluenceCheck;
+bool retuneEffort;
+size_t maxTraials;
+bool warmThresholds;
+bool costAwareThresholds;
+bool singlePass;
+bool sharedTrajectories;
+bool regenerative;
+bool anytimeValid;
+bool antithetic;
+bool commonRandomNumbers;
 double failProbDFT;
 std::ostream* traceDump(nullptr);
 
@@ -255,12 +266,22 @@ ValueArg<string> ifunAutoCompositional(
 	"provided to \"compose\" the global importance from these.",
 	false, "+",
 	"composition_fun");
+ValueArg<size_t> ifunAutoLazy(
+	"", "alazy",
+	"Use an automatically computed \"on-the-fly\" importance function, "
+	"i.e. compute the importance of the global model states as they are "
+	"visited during simulations. This stores in memory only the values of "
+	"the states visited last; the value given is the max number of states "
+	"to keep (0 for the default).",
+	false, 0ul,
+	"cache_size");
 std::vector< Arg* > impFunSpecs = {
 	&ifunFlat,
 	&ifunAdhoc,
 	// &ifunAdhocCoupled
 	&ifunAutoMonolithic,
 	&ifunAutoCompositional,
+	&ifunAutoLazy,
 };
 
 // Importance function post-processing
@@ -272,7 +293,7 @@ MultiDoubleArg< string, float > impPostProc(
 	"", "post-process",
 	"Specify a post-processing to apply to the importance computed, e.g. "
 	"\"--post-process exp 2.0\" to exponentiate all values using '2' as "
-	"the base. Only applicable to --amono and --acomp importance functions.",
+	"the base. Only applicable to --amono, --acomp and --alazy importance functions.",
 	false, &postProcConstraints, &postProcArg);
 
 // Stopping conditions (aka estimation bounds)
@@ -369,6 +390,79 @@ SwitchArg confluenceCheck_(
 	"c", "confluence",
 	"Run algorithm to check confluence of committed actions.");
 
+// Online re-tuning of the thresholds effort
+SwitchArg retuneEffort_(
+	"", "retune-effort",
+	"Re-tune the splitting of the threshold levels in between batches of "
+	"RESTART simulations, using the level-up frequencies observed so far. "
+	"Intended to amend poor effort values chosen by a short pilot run.");
+
+// Memory budget of RESTART
+ValueArg<size_t> maxTraials_(
+	"", "max-traials",
+	"Max number of simulation runs (Traials) alive at once in RESTART. "
+	"Level-ups that would exceed it split fewer retrials, weighing them up "
+	"to keep the estimates unbiased (0 for no limit).",
+	false, 0ul, "A positive integral");
+
+// Warm start of the thresholds building
+SwitchArg warmThresholds_(
+	"", "warm-thresholds",
+	"When several global effort values are given, build the thresholds for "
+	"the first one only, and refine these for the following ones instead of "
+	"building them from scratch. Applies to adaptive thresholds builders.");
+
+// Cost-aware thresholds efforts
+SwitchArg costAwareThresholds_(
+	"", "cost-aware-thresholds",
+	"Measure the cost of simulating each level while building thresholds, "
+	"and choose the efforts that minimise the variance per CPU time rather "
+	"than per simulation. Applies to the \"es\" thresholds builder.");
+
+// Single-pass estimation
+SwitchArg singlePass_(
+	"", "single-pass",
+	"Estimate for all stopping conditions requested (confidence criteria or "
+	"time budgets) with a single simulation stream, reporting each condition "
+	"as soon as it is met, instead of estimating from scratch for each one.");
+
+// Multi-property estimation
+SwitchArg sharedTrajectories_(
+	"", "shared-trajectories",
+	"With the \"nosplit\" engine, estimate all transient properties at once: "
+	"each simulation is monitored by every property, and each property stops "
+	"as soon as its confidence interval converges.");
+
+// Regenerative simulation
+SwitchArg regenerative_(
+	"", "regenerative",
+	"With the \"nosplit\" engine, estimate rate properties from independent "
+	"regeneration cycles, delimited by the returns of the simulation to the "
+	"initial state, instead of using batch means on a single long run. "
+	"No warm-up is discarded; suited for models whose initial state renews "
+	"the system, e.g. Markovian queues starting empty. "
+	"The \"is\" engine always uses regeneration cycles.");
+
+// Sequential stopping
+SwitchArg anytimeValid_(
+	"", "anytime-valid",
+	"Check confidence criteria with confidence sequences, which are valid "
+	"at any stopping time: the estimation stops as soon as the precision "
+	"requested is met, without the optimism of checking a fixed-sample "
+	"confidence interval after every batch. Intervals are somewhat wider.");
+
+// Variance reduction for standard Monte Carlo
+SwitchArg antithetic_(
+	"", "antithetic",
+	"With the \"nosplit\" engine, run the independent simulations (of "
+	"transient properties and regeneration cycles) in pairs, the second one "
+	"driven by the antithetic random numbers of the first.");
+SwitchArg commonRandomNumbers_(
+	"", "crn",
+	"With the \"nosplit\" engine, give each independent simulation its own "
+	"RNG substream, so that runs with the same seed on variants of a model "
+	"use common random numbers and their estimates can be sharply compared.");
+
 // Simulation trace dumping
 ValueArg<string> dumpTrace_(
     "", "trace",
@@ -378,6 +472,21 @@ ValueArg<string> dumpTrace_(
     "undefined behaviour.",
     false, "stderr", "stderr/stdout/filename");
 
+// Estimation telemetry
+ValueArg<string> telemetry_(
+    "", "telemetry",
+    "Write a machine-readable stream with the progress of estimations to "
+    "given file/stream: per-batch samples, estimate, variance, half-width, "
+    "simulation steps per second, Traials alive, simulations reaching each "
+    "threshold level, and memory used.",
+    false, "", "stderr/stdout/filename");
+ValuesConstraint<string> telemetryFormatConstraints(
+	std::vector<string>({"json", "csv"}));
+ValueArg<string> telemetryFormat_(
+    "", "telemetry-format",
+    "Format of the telemetry stream: JSON lines or CSV rows",
+    false, "json", &telemetryFormatConstraints);
+
 // For models that come from a Dynamic Faul Tree specification (e.g. GALILEO),
 // the user may specify the the probability of fail before repair,
 // e.g. of increasing one lvl of importance
@@ -616,6 +725,11 @@ get_ifun_specification()
 	} else if (ifunAutoMonolithic.isSet()) {
 		new(&impFunSpec) fig::ImpFunSpec("concrete_coupled", "auto", "", postProc);
 
+	} else if (ifunAutoLazy.isSet()) {
+		new(&impFunSpec) fig::ImpFunSpec("concrete_lazy", "auto", "", postProc,
+		                                 0u, 0u, 0u,              // unused
+		                                 ifunAutoLazy.getValue());  // cache size
+
 	} else if (ifunAutoCompositional.isSet()) {
 		UserDefImpFun details = parse_ifun_details(ifunAutoCompositional.getValue());
 		if (std::get<0>(details).empty())
@@ -782,6 +896,26 @@ get_traces_dumpfile()
 	return true;
 }
 
+
+/// Open the telemetry stream if requested by the user
+/// @return Whether the stream could be successfully opened
+bool
+get_telemetry_stream()
+{
+	if (!telemetry_.isSet())
+		return true;
+	const auto format(telemetryFormat_.getValue() == "csv"
+	                  ? fig::Telemetry::Format::CSV
+	                  : fig::Telemetry::Format::JSON);
+	try {
+		fig::Telemetry::get_instance().open(telemetry_.getValue(), format);
+	} catch (fig::FigException& e) {
+		figTechLog << "[ERROR] " << e.msg() << std::endl;
+		return false;
+	}
+	return true;
+}
+
 } // namespace  // // // // // // // // // // // // // // // // // // // // //
 
 
@@ -827,8 +961,20 @@ parse_arguments(const int& argc, const char** argv, bool fatalError)
 		cmd_.add(verboseOutput_);
 		cmd_.add(forceOperation_);
 		cmd_.add(confluenceCheck_);
+		cmd_.add(retuneEffort_);
+		cmd_.add(maxTraials_);
+		cmd_.add(warmThresholds_);
+		cmd_.add(costAwareThresholds_);
+		cmd_.add(singlePass_);
+		cmd_.add(sharedTrajectories_);
+		cmd_.add(regenerative_);
+		cmd_.add(anytimeValid_);
+		cmd_.add(antithetic_);
+		cmd_.add(commonRandomNumbers_);
 		cmd_.add(failProbDFT_);
 		cmd_.add(dumpTrace_);
+		cmd_.add(telemetry_);
+		cmd_.add(telemetryFormat_);
 
 		// Parse the command line input
 		cmd_.parse(argc, argv);
@@ -842,6 +988,16 @@ parse_arguments(const int& argc, const char** argv, bool fatalError)
 		verboseOutput   = verboseOutput_.getValue();
 		forceOperation  = forceOperation_.getValue();
 		confluenceCheck = confluenceCheck_.getValue();
+		retuneEffort    = retuneEffort_.getValue();
+		maxTraials      = maxTraials_.getValue();
+		warmThresholds  = warmThresholds_.getValue();
+		costAwareThresholds = costAwareThresholds_.getValue();
+		singlePass      = singlePass_.getValue();
+		sharedTrajectories = sharedTrajectories_.getValue();
+		regenerative    = regenerative_.getValue();
+		anytimeValid    = anytimeValid_.getValue();
+		antithetic      = antithetic_.getValue();
+		commonRandomNumbers = commonRandomNumbers_.getValue();
 		failProbDFT     = failProbDFT_.getValue();
 		if (!get_jani_spec()) {
 			figTechLog << "[ERROR] Failed parsing the JANI-spec commands.\n\n";
@@ -894,6 +1050,11 @@ parse_arguments(const int& argc, const char** argv, bool fatalError)
 			figTechLog << "trace-dump stream/file destination.\n\n";
 			goto exit_with_failure;
 		}
+		if (!get_telemetry_stream()) {
+			figTechLog << "[ERROR] Something failed while opening the ";
+			figTechLog << "telemetry stream/file destination.\n\n";
+			goto exit_with_failure;
+		}
 
 	} catch (ArgException& e) {
 		throw_FigException(std::string("command line parsing failed "
@@ -50,6 +50,7 @@
 #include <ConfluenceChecker.h>
 #include <JANI_translator.h>
 #include <ImportanceFunction.h>
+#include <Telemetry.h>
 
 
 //  Helper functions headers  //////////////////////////////////////////////////
@@ -75,6 +76,16 @@ using fig_cli::thrSpec;
 using fig_cli::globalEfforts;
 using fig_cli::estBounds;
 using fig_cli::simsTimeout;
+using fig_cli::retuneEffort;
+using fig_cli::maxTraials;
+using fig_cli::warmThresholds;
+using fig_cli::costAwareThresholds;
+using fig_cli::singlePass;
+using fig_cli::sharedTrajectories;
+using fig_cli::regenerative;
+using fig_cli::anytimeValid;
+using fig_cli::antithetic;
+using fig_cli::commonRandomNumbers;
 using fig_cli::rngType;
 using fig_cli::rngSeed;
 
@@ -147,11 +158,21 @@ int main(int argc, char** argv)
 		model.set_rng(rngType, rngSeed);
 		model.set_timeout(simsTimeout);
 		model.set_verbosity(verboseOutput);
+		model.set_effort_retuning(retuneEffort);
+		model.set_max_traials(maxTraials);
+		model.set_thresholds_warm_start(warmThresholds);
+		model.set_cost_aware_thresholds(costAwareThresholds);
+		model.set_single_pass_estimation(singlePass);
+		model.set_shared_trajectories(sharedTrajectories);
+		model.set_regenerative(regenerative);
+		model.set_anytime_valid(anytimeValid);
+		model.set_variance_reduction(antithetic, commonRandomNumbers);
 		model.process_batch(engineName,
 							impFunSpec,
 		                    thrSpec,
 							estBounds,
 		                    globalEfforts);
+		fig::Telemetry::get_instance().close();  // flush pending records
 	} catch (fig::FigException& e) {
 		log(FIG_ERROR + " perform estimations.\n\n");
 		tech_log("Error message: " + e.msg() + "\n");
@@ -310,6 +331,15 @@ void compile_model(bool modelAlreadyBuilt)
 		}
 	}
 
+	// Report the time taken by each phase of the front-end
+	double phaseStart = omp_get_wtime();
+	auto phase_log = [&] (const std::string& msg) {
+		std::stringstream ss; ss << msg << " (" << std::fixed;
+		ss << std::setprecision(2) << omp_get_wtime()-phaseStart << " s)\n";
+		tech_log(ss.str());
+		phaseStart = omp_get_wtime();
+	};
+
 	// Build AST from files, viz. parse
 	auto modelAST = ModelAST::from_files(modelFile.c_str(),
 	                                     propertiesFile.c_str());
@@ -317,7 +347,7 @@ void compile_model(bool modelAlreadyBuilt)
 		log("[ERROR] Failed to parse the model.\n");
 		throw_FigException("failed parsing the model file");
 	}
-	tech_log(" - Parsing        succeeded\n");
+	phase_log(" - Parsing        succeeded");
 
 	// Debug print:
 	// { ModelPrinter printer(std::cerr,true); modelAST->accept(printer); }
@@ -329,7 +359,7 @@ void compile_model(bool modelAlreadyBuilt)
 		log(typechecker.get_messages());
 		throw_FigException("type-check for the model failed");
 	}
-	tech_log(" - Type-checking  succeeded\n");
+	phase_log(" - Type-checking  succeeded");
 
     // Reduce expressions (errors when irreducible constants are found)
 	ModelReductor reductor;
@@ -338,7 +368,7 @@ void compile_model(bool modelAlreadyBuilt)
         log(reductor.get_messages());
         throw_FigException("reduction of constant expressions failed");
     }
-	tech_log(" - Expr-reduction succeeded\n");
+	phase_log(" - Expr-reduction succeeded");
 
 	// Check confluence if requested
     if (confluenceCheck) {
@@ -346,34 +376,30 @@ void compile_model(bool modelAlreadyBuilt)
         modelAST->accept(confluence_verifier);
         if (confluence_verifier.has_errors()) {
             log(confluence_verifier.get_messages());
-			tech_log(" - Confluence-checking failed\n");
+			phase_log(" - Confluence-checking failed");
         } else {
-			tech_log(" - Confluence-checking succeeded\n");
+			phase_log(" - Confluence-checking succeeded");
         }
     }
 
 	// Check IOSA correctness
-	if (ModuleScope::modules_size_bounded_by(ModelVerifier::NTRANS_BOUND)) {
-		ModelVerifier verifier;
-        modelAST->accept(verifier);
-        if (verifier.has_errors()) {
-            log("\n[WARNING] IOSA-checking failed\n");
-			tech_log(verifier.get_messages());
-			if (!forceOperation) {
-				log(" -- aborting\n");
-				log("To force estimation disregarding ");
-				log("IOSA errors call with \"--force\"");
-				throw_FigException("iosa-check for the model failed");
-			} else {
-				log("\n");
-			}
-        } else if (verifier.has_warnings()) {
-            tech_log(verifier.get_messages());
-        }
-		tech_log(" - IOSA-checking  succeeded\n");
-	} else {
-		log(" - IOSA-checking skipped: model is too big\n");
+	ModelVerifier verifier;
+	modelAST->accept(verifier);
+	if (verifier.has_errors()) {
+		log("\n[WARNING] IOSA-checking failed\n");
+		tech_log(verifier.get_messages());
+		if (!forceOperation) {
+			log(" -- aborting\n");
+			log("To force estimation disregarding ");
+			log("IOSA errors call with \"--force\"");
+			throw_FigException("iosa-check for the model failed");
+		} else {
+			log("\n");
+		}
+	} else if (verifier.has_warnings()) {
+		tech_log(verifier.get_messages());
 	}
+	phase_log(" - IOSA-checking  succeeded");
 
 
 	// Build model (i.e. populate ModelSuite)
@@ -383,7 +409,7 @@ void compile_model(bool modelAlreadyBuilt)
 		log(builder.get_messages());
 		throw_FigException("parser failed to build the model");
 	}
-	tech_log(" - Model building succeeded\n");
+	phase_log(" - Model building succeeded");
 
 	// Seal model
 	auto& modelInstance = fig::ModelSuite::get_instance();
@@ -394,7 +420,8 @@ void compile_model(bool modelAlreadyBuilt)
 		log("[ERROR] Failed to seal the model.\n");
 		throw_FigException("parser failed sealing the model");
 	}
-	tech_log(" - Model sealing  succeeded\n\n");
+	phase_log(" - Model sealing  succeeded");
+	tech_log("\n");
 
 	log(std::string("Model") +
 	    (propertiesFile.empty() ? (" file ") : (" and properties files "))
@@ -118,12 +118,10 @@ bool compile_model(const string& modelFilePath)
 //	modelAST->accept(confluence_verifier);
 //	CHECK_FALSE(confluence_verifier.has_errors());
 
-	// Check IOSA correctness (for small enough modules only)
-	if (ModuleScope::modules_size_bounded_by(ModelVerifier::NTRANS_BOUND)) {
-		ModelVerifier verifier;
-		modelAST->accept(verifier);
-		REQUIRE_FALSE(verifier.has_errors());
-	}
+	// Check IOSA correctness
+	ModelVerifier verifier;
+	modelAST->accept(verifier);
+	REQUIRE_FALSE(verifier.has_errors());
 
 	// Build model, i.e. populate ModelSuite
 	ModelBuilder builder;
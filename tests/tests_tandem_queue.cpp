@@ -27,6 +27,12 @@
 //==============================================================================
 
 
+// C++
+#include <set>
+#include <cstdio>   // std::remove()
+#include <fstream>
+#include <functional>
+// FIG
 #include <tests_definitions.h>
 
 
@@ -47,6 +53,17 @@ int trPropId(-1);               // index of the query within our TAD
 const double SS_PROB(6.23e-5);  // expected result of steady-state query (C=10: 7.25e-6)
 int ssPropId(-1);               // index of the query within our TAD
 
+// Change the global configuration of the ModelSuite for as long as
+// this lives: undone on scope exit, also when a failed REQUIRE leaves early
+class ScopedSetting
+{
+	std::function<void()> undo_;
+public:
+	ScopedSetting(std::function<void()> set, std::function<void()> undo) :
+		undo_(undo) { set(); }
+	~ScopedSetting() { undo_(); }
+};
+
 } // namespace   // // // // // // // // // // // // // // // // // // // // //
 
 
@@ -102,6 +119,75 @@ SECTION("Seal model and check consistency")
 	REQUIRE(model.num_RNGs() > 0ul);
 }
 
+SECTION("Importance: monolithic, decision diagram vs vector storage")
+{
+	const fig::ModuleNetwork& network(*model.modules_network());
+	const fig::Property& property(*model.get_property(trPropId));
+	fig::ImportanceFunctionConcreteCoupled vecIFun(network), mddIFun(network);
+	mddIFun.force_symbolic(true);
+	vecIFun.assess_importance(property, "auto");
+	mddIFun.assess_importance(property, "auto");
+	REQUIRE_FALSE(vecIFun.symbolic());
+	REQUIRE(mddIFun.symbolic());
+	REQUIRE(mddIFun.min_value() == vecIFun.min_value());
+	REQUIRE(mddIFun.max_value() == vecIFun.max_value());
+	REQUIRE(mddIFun.initial_value() == vecIFun.initial_value());
+	// Both storages must agree on every reachable state
+	std::set< fig::StateInstance > reached;
+	std::vector< fig::StateInstance > toVisit(1ul, network.initial_state().to_state_instance());
+	while (!toVisit.empty()) {
+		const fig::StateInstance s(toVisit.back());
+		toVisit.pop_back();
+		if (!reached.insert(s).second)
+			continue;
+		REQUIRE(mddIFun.info_of(s) == vecIFun.info_of(s));
+		for (auto& t: network.adjacent_states(s))
+			if (end(reached) == reached.find(t))
+				toVisit.emplace_back(std::move(t));
+	}
+	REQUIRE(reached.size() > 1ul);
+}
+
+SECTION("Parallel simulations: model and property copies")
+{
+	const fig::ModuleNetwork& network(*model.modules_network());
+	const fig::Property& property(*model.get_property(trPropId));
+	fig::ImportanceFunctionConcreteCoupled ifun(network);
+	ifun.assess_importance(property, "auto");
+	REQUIRE(ifun.concurrent_queries());
+	// Copies must behave as the originals
+	const fig::ModuleNetwork copy(network);
+	REQUIRE(copy.sealed());
+	REQUIRE(copy.is_markovian() == network.is_markovian());
+	REQUIRE(copy.num_transitions() == network.num_transitions());
+	const auto propCopy(property.clone());
+	REQUIRE(propCopy->get_id() == property.get_id());
+	// Peak simulations run from all threads
+	const size_t NUM_SIMS(64ul);
+	auto& tpool(fig::TraialPool::get_instance());
+	std::vector< fig::Reference< fig::Traial > > traials;
+	tpool.get_traials(traials, NUM_SIMS);
+	for (fig::Traial& t: traials)
+		t.initialise(network, ifun);
+	const fig::ModelReplicas replicas(network, ifun, &property);
+	std::vector< int > stopped(NUM_SIMS, 0);  // not bool: written concurrently
+	replicas.run(NUM_SIMS, fig::CancellationToken(),
+	             [&](const size_t& i, const fig::ModuleNetwork& net, const fig::Property* prop) {
+		unsigned jumpsLeft(1u<<7u);
+		net.peak_simulation(traials[i],
+		                    [&ifun](fig::Traial& t) { t.level = ifun.importance_of(t.state); },
+		                    [&jumpsLeft](const fig::Traial&) { return --jumpsLeft > 0u; });
+		stopped[i] = prop->is_stop(traials[i].get().state);
+	});
+	for (size_t i = 0ul ; i < NUM_SIMS ; i++) {
+		const fig::Traial& t(traials[i]);
+		REQUIRE(t.level == ifun.importance_of(t.state));
+		REQUIRE(static_cast<bool>(stopped[i]) == property.is_stop(t.state));
+		REQUIRE(propCopy->is_rare(t.state) == property.is_rare(t.state));
+	}
+	tpool.return_traials(traials);
+}
+
 SECTION("Transient: standard MC")
 {
 	const string nameEngine("nosplit");
@@ -129,6 +215,149 @@ SECTION("Transient: standard MC")
 	REQUIRE(ci.point_estimate() == Approx(TR_PROB).epsilon(TR_PROB*.8));
 	REQUIRE(ci.precision(.9) > 0.0);
 	REQUIRE(ci.precision(.9) < TR_PROB*1.5);
+	// Estimate two different properties from the same simulations:
+	// reaching half of the buffer of q2 is (much) likelier than filling it
+	const auto prop = model.get_property(trPropId);
+	std::shared_ptr< const fig::Property > halfProp;
+	for (size_t i = 0ul ; i < model.num_properties() ; i++)
+		if (static_cast<int>(i) != trPropId
+		        && fig::PropertyType::TRANSIENT == model.get_property(i)->type)
+			halfProp = model.get_property(i);
+	REQUIRE(nullptr != halfProp);
+	auto check_shared = [&] (const fig::StoppingConditions& bound) {
+		model.estimate_shared({prop, halfProp}, *engine, bound, fig::ImpFunSpec(nameIFun, "flat"));
+		auto sharedResults = model.get_last_estimates();
+		REQUIRE(sharedResults.size() == 2ul);
+		auto ci1 = sharedResults.front(), ci2 = sharedResults.back();
+		REQUIRE(ci1.point_estimate() == Approx(TR_PROB).epsilon(TR_PROB*.8));
+		REQUIRE(ci2.point_estimate() > 10.0*ci1.point_estimate());
+		REQUIRE(ci2.point_estimate() < 1.0);
+		REQUIRE(ci1.num_samples() == ci2.num_samples());
+	};
+	check_shared(timeBound);
+	// Estimate briefly while streaming the telemetry as CSV
+	const string telemetryFile("tandem_queue_telemetry.csv");
+	fig::StoppingConditions shortTimeBound;
+	shortTimeBound.add_time_budget(2);  // estimate for 2 seconds
+	auto& telemetry = fig::Telemetry::get_instance();
+	{
+		ScopedSetting streaming(
+			[&](){ telemetry.open(telemetryFile, fig::Telemetry::Format::CSV); },
+			[&](){ telemetry.close(); });
+		REQUIRE(fig::Telemetry::enabled());
+		model.estimate(trPropId, *engine, shortTimeBound, fig::ImpFunSpec(nameIFun, "flat"));
+	}
+	REQUIRE(!fig::Telemetry::enabled());
+	// Check the stream: header, start, batches and end of the estimation
+	std::ifstream csv(telemetryFile);
+	REQUIRE(csv.good());
+	string line;
+	size_t numBatches(0ul);
+	bool started(false), ended(false);
+	REQUIRE(std::getline(csv, line));
+	REQUIRE(line.find("event,estimation,time,samples") == 0ul);
+	while (std::getline(csv, line)) {
+		started |= line.find("start,") == 0ul;
+		numBatches += line.find("batch,") == 0ul ? 1ul : 0ul;
+		ended |= line.find("end,") == 0ul;
+	}
+	csv.close();
+	std::remove(telemetryFile.c_str());
+	REQUIRE(started);
+	REQUIRE(numBatches > 0ul);
+	REQUIRE(ended);
+	// Estimate again simulating in antithetic pairs
+	{
+		ScopedSetting antithetic([](){ model.set_variance_reduction(true, false); },
+		                         [](){ model.set_variance_reduction(false, false); });
+		engine = model.prepare_simulation_engine(nameEngine, nameIFun, nameThr, trPropId);
+		REQUIRE(engine->ready());
+		model.estimate(trPropId, *engine, timeBound, fig::ImpFunSpec(nameIFun, "flat"));
+		auto results = model.get_last_estimates();
+		REQUIRE(results.size() == 1ul);
+		auto ci = results.front();
+		REQUIRE(ci.point_estimate() == Approx(TR_PROB).epsilon(TR_PROB*.8));
+		REQUIRE(ci.precision(.9) > 0.0);
+		REQUIRE(ci.precision(.9) < TR_PROB*1.5);
+		// Shared simulations also come in antithetic pairs
+		REQUIRE(std::dynamic_pointer_cast<fig::SimulationEngineNosplit>(engine)->antithetic());
+		check_shared(timeBound);
+	}
+	// Single-pass estimation can't share simulations
+	{
+		ScopedSetting singlePass([](){ model.set_single_pass_estimation(true); },
+		                         [](){ model.set_single_pass_estimation(false); });
+		fig::StoppingConditions twoBounds;
+		twoBounds.add_time_budget(1);
+		twoBounds.add_time_budget(2);
+		REQUIRE_THROWS(model.estimate_shared({prop, halfProp}, *engine, twoBounds));
+	}
+}
+
+SECTION("Transient: importance sampling, monolithic, fix")
+{
+	const string nameEngine("is");
+	const fig::ImpFunSpec ifunSpec("concrete_coupled", "auto");
+	const string nameThr("fix");
+	REQUIRE(model.is_markovian());
+	REQUIRE(model.exists_simulator(nameEngine));
+	REQUIRE(model.exists_importance_function(ifunSpec.name));
+	REQUIRE(model.exists_threshold_technique(nameThr));
+	// Prepare engine
+	model.build_importance_function_auto(ifunSpec, trPropId, true);
+	auto engine = model.prepare_simulation_engine(nameEngine, ifunSpec.name, nameThr, trPropId);
+	REQUIRE(engine->ready());
+	REQUIRE(!engine->isplit());
+	// Set estimation criteria
+	auto rng = model.available_RNGs().front();
+	REQUIRE(model.exists_rng(rng));
+	model.set_rng(rng, 8);
+	fig::StoppingConditions timeBound;
+	timeBound.add_time_budget(10);  // estimate for 10 seconds
+	// Estimate
+	model.estimate(trPropId, *engine, timeBound, ifunSpec);
+	auto results = model.get_last_estimates();
+	REQUIRE(results.size() == 1ul);
+	auto ci = results.front();
+	REQUIRE(ci.point_estimate() == Approx(TR_PROB).epsilon(TR_PROB*.8));
+	REQUIRE(ci.precision(.9) > 0.0);
+	REQUIRE(ci.precision(.9) < TR_PROB*1.5);
+	// The tilting was tuned for the property
+	auto is = std::dynamic_pointer_cast<fig::SimulationEngineIS>(engine);
+	REQUIRE(nullptr != is);
+	REQUIRE(!is->tilts().empty());
+}
+
+SECTION("Steady-state: standard MC, regenerative")
+{
+	const string nameEngine("nosplit");
+	const string nameIFun("algebraic");
+	const string nameThr("fix");
+	REQUIRE(model.exists_simulator(nameEngine));
+	REQUIRE(model.exists_importance_function(nameIFun));
+	REQUIRE(model.exists_threshold_technique(nameThr));
+	// Prepare engine
+	model.build_importance_function_flat(nameIFun, ssPropId, true);
+	auto engine = model.prepare_simulation_engine(nameEngine, nameIFun, nameThr, ssPropId);
+	REQUIRE(engine->ready());
+	// Set estimation criteria
+	auto rng = model.available_RNGs().front();
+	REQUIRE(model.exists_rng(rng));
+	model.set_rng(rng, 8);
+	fig::StoppingConditions timeBound;
+	timeBound.add_time_budget(20);  // estimate for 20 seconds
+	// Estimate from cycles delimited by the returns to the empty queues
+	{
+		ScopedSetting regenerative([](){ model.set_regenerative(true); },
+		                           [](){ model.set_regenerative(false); });
+		model.estimate(ssPropId, *engine, timeBound, fig::ImpFunSpec(nameIFun, "flat"));
+	}
+	auto results = model.get_last_estimates();
+	REQUIRE(results.size() == 1ul);
+	auto ci = results.front();
+	REQUIRE(ci.num_samples() > 100l);
+	REQUIRE(ci.point_estimate() == Approx(SS_PROB).epsilon(SS_PROB*.8));
+	REQUIRE(ci.precision(.9) > 0.0);
 }
 
 SECTION("Steady-state: RESTART, ad hoc, hyb")
@@ -164,6 +393,18 @@ SECTION("Steady-state: RESTART, ad hoc, hyb")
 	REQUIRE(ci.precision(confCo) <= Approx(SS_PROB*prec).epsilon(SS_PROB*.2));
 	REQUIRE(static_cast<fig::ConfidenceInterval&>(ci).precision()
 			  == Approx(SS_PROB*prec).epsilon(SS_PROB*0.1));
+	// Estimate again stopping as soon as the confidence sequence is narrow enough
+	{
+		ScopedSetting anytimeValid([](){ model.set_anytime_valid(true); },
+		                           [](){ model.set_anytime_valid(false); });
+		model.estimate(ssPropId, *engine, confCrit, ifunSpec);
+	}
+	auto csResults = model.get_last_estimates();
+	REQUIRE(csResults.size() == 1ul);
+	auto cs = csResults.front();
+	REQUIRE(cs.point_estimate() == Approx(SS_PROB).epsilon(SS_PROB*.2));
+	REQUIRE(cs.precision(confCo) > 0.0);
+	REQUIRE(cs.precision(confCo) <= Approx(SS_PROB*prec).epsilon(SS_PROB*.2));
 }
 
 SECTION("Steady-state: RESTART, monolithic, hyb")
@@ -180,6 +421,14 @@ SECTION("Steady-state: RESTART, monolithic, hyb")
 	model.build_importance_function_auto(ifunSpec, ssPropId, true);
 	auto engine = model.prepare_simulation_engine(nameEngine, ifunSpec.name, nameThr, ssPropId);
 	REQUIRE(engine->ready());
+	// Level-up probabilities recorded are the fractions measured by SMC
+	auto thrBuilder = std::dynamic_pointer_cast<const fig::ThresholdsBuilderAdaptive>(
+	                      model.current_thresholds_builder());
+	REQUIRE(nullptr != thrBuilder);
+	const auto& pUp = thrBuilder->last_level_up_probs();
+	REQUIRE(pUp.size() == thrBuilder->last_levels().size());
+	for (const auto& p: pUp)
+		REQUIRE((0.0 <= p && p <= 1.0));
 	// Set estimation criteria
 	auto rng = model.available_RNGs().front();
 	REQUIRE(model.exists_rng(rng));
@@ -199,6 +448,21 @@ SECTION("Steady-state: RESTART, monolithic, hyb")
 	REQUIRE(ci.precision(confCo) <= Approx(SS_PROB*prec).epsilon(SS_PROB*.2));
 	REQUIRE(static_cast<fig::ConfidenceInterval&>(ci).precision()
 	          == Approx(SS_PROB*prec).epsilon(SS_PROB*0.1));
+	// Estimate again re-tuning the effort in between batches
+	{
+		ScopedSetting retune([](){ model.set_effort_retuning(true); },
+		                     [](){ model.set_effort_retuning(false); });
+		engine = model.prepare_simulation_engine(nameEngine, ifunSpec.name, nameThr, ssPropId);
+		REQUIRE(engine->ready());
+		model.estimate(ssPropId, *engine, confCrit, ifunSpec);
+	}
+	auto retunedResults = model.get_last_estimates();
+	REQUIRE(retunedResults.size() == 1ul);
+	auto retuned = retunedResults.front();
+	REQUIRE(retuned.point_estimate() == Approx(SS_PROB).epsilon(SS_PROB*.6));
+	// Batch means with and without re-tuning must agree: intervals overlap
+	const double halfWidths((ci.precision(confCo)+retuned.precision(confCo))/2.0);
+	REQUIRE(retuned.point_estimate() == Approx(ci.point_estimate()).epsilon(halfWidths));
 }
 
 SECTION("Transient: RESTART, compositional (+ operator), es")
@@ -235,6 +499,147 @@ SECTION("Transient: RESTART, compositional (+ operator), es")
 	          == Approx(TR_PROB*prec).epsilon(TR_PROB*0.1));
 }
 
+SECTION("Transient: RESTART, on-the-fly, hyb")
+{
+	const string nameEngine("restart");
+	const fig::ImpFunSpec ifunSpec("concrete_lazy", "auto");
+	const string nameThr("hyb");
+	REQUIRE(model.exists_simulator(nameEngine));
+	REQUIRE(model.exists_importance_function(ifunSpec.name));
+	REQUIRE(model.exists_importance_strategy(ifunSpec.strategy));
+	REQUIRE(model.exists_threshold_technique(nameThr));
+	// Prepare engine
+	model.set_global_effort(5, nameEngine);
+	model.build_importance_function_auto(ifunSpec, trPropId, true);
+	auto engine = model.prepare_simulation_engine(nameEngine, ifunSpec.name, nameThr, trPropId);
+	REQUIRE(engine->ready());
+	// Set estimation criteria
+	auto rng = model.available_RNGs().front();
+	REQUIRE(model.exists_rng(rng));
+	model.set_rng(rng, 42);
+	const double confCo(.95);
+	const double prec(.35);
+	fig::StoppingConditions confCrit;
+	confCrit.add_confidence_criterion(confCo, prec);
+    model.set_timeout(TIMEOUT_(0));  // unset timeout; estimate for as long as necessary
+	// Estimate
+	model.estimate(trPropId, *engine, confCrit, ifunSpec);
+	auto results = model.get_last_estimates();
+	REQUIRE(results.size() == 1ul);
+	auto ci = results.front();
+	REQUIRE(ci.point_estimate() == Approx(TR_PROB).epsilon(TR_PROB*.3));
+	REQUIRE(ci.precision(confCo) > 0.0);
+	REQUIRE(ci.precision(confCo) <= Approx(TR_PROB*prec).epsilon(TR_PROB*.2));
+	REQUIRE(static_cast<fig::ConfidenceInterval&>(ci).precision()
+	          == Approx(TR_PROB*prec).epsilon(TR_PROB*0.1));
+}
+
+SECTION("Transient: RESTART, monolithic, es")
+{
+	const string nameEngine("restart");
+	const fig::ImpFunSpec ifunSpec("concrete_coupled", "auto");
+	const string nameThr("es");
+	REQUIRE(model.exists_simulator(nameEngine));
+	REQUIRE(model.exists_importance_function(ifunSpec.name));
+	REQUIRE(model.exists_importance_strategy(ifunSpec.strategy));
+	REQUIRE(model.exists_threshold_technique(nameThr));
+	model.build_importance_function_auto(ifunSpec, trPropId, true);
+	// Set estimation criteria
+	auto rng = model.available_RNGs().front();
+	REQUIRE(model.exists_rng(rng));
+	model.set_rng(rng, 42);
+	const double confCo(.95);
+	const double prec(.35);
+	fig::StoppingConditions confCrit;
+	confCrit.add_confidence_criterion(confCo, prec);
+    model.set_timeout(TIMEOUT_(0));  // unset timeout; estimate for as long as necessary
+	// Every variant below must yield the same kind of estimate
+	auto check_last_estimate = [&] () {
+		auto results = model.get_last_estimates();
+		REQUIRE(results.size() == 1ul);
+		auto ci = results.front();
+		REQUIRE(ci.point_estimate() == Approx(TR_PROB).epsilon(TR_PROB*.3));
+		REQUIRE(ci.precision(confCo) > 0.0);
+		REQUIRE(ci.precision(confCo) <= Approx(TR_PROB*prec).epsilon(TR_PROB*.2));
+	};
+	// Estimate re-tuning the effort in between batches
+	{
+		ScopedSetting retune([](){ model.set_effort_retuning(true); },
+		                     [](){ model.set_effort_retuning(false); });
+		auto engine = model.prepare_simulation_engine(nameEngine, ifunSpec.name, nameThr, trPropId);
+		REQUIRE(engine->ready());
+		REQUIRE(std::dynamic_pointer_cast<fig::SimulationEngineRestart>(engine)->effort_retuning());
+		model.estimate(trPropId, *engine, confCrit, ifunSpec);
+	}
+	check_last_estimate();
+	// Estimate with a tight budget of Traials
+	{
+		ScopedSetting budget([](){ model.set_max_traials(16ul); },
+		                     [](){ model.set_max_traials(0ul); });
+		auto engine = model.prepare_simulation_engine(nameEngine, ifunSpec.name, nameThr, trPropId);
+		REQUIRE(engine->ready());
+		REQUIRE(std::dynamic_pointer_cast<fig::SimulationEngineRestart>(engine)->max_traials() == 16ul);
+		model.estimate(trPropId, *engine, confCrit, ifunSpec);
+	}
+	check_last_estimate();
+	// The pool was shrunk after the estimation
+	REQUIRE(fig::TraialPool::get_instance().num_traials()
+	        <= fig::TraialPool::initial_size());
+	// Estimate with work-normalised ES efforts
+	{
+		ScopedSetting costAware([](){ model.set_cost_aware_thresholds(true); },
+		                        [](){ model.set_cost_aware_thresholds(false); });
+		auto engine = model.prepare_simulation_engine(nameEngine, ifunSpec.name, nameThr, trPropId);
+		REQUIRE(engine->ready());
+		model.estimate(trPropId, *engine, confCrit, ifunSpec);
+	}
+	check_last_estimate();
+	// ES efforts are rescaled by 1/sqrt(cost) keeping the total work...
+	{
+		const std::vector< double > cost = {1.0, 1.0, 4.0, 16.0};
+		std::vector< float > effort = {1.0f, 8.0f, 8.0f, 8.0f};
+		fig::ThresholdsBuilderES::cost_aware_effort(effort, cost);
+		REQUIRE(effort[0] == 1.0f);  // no splitting: untouched
+		REQUIRE(effort[2]/effort[1] == Approx(1.0/2.0));
+		REQUIRE(effort[3]/effort[1] == Approx(1.0/4.0));
+		double work(0.0);
+		for (auto i = 1ul ; i < effort.size() ; i++)
+			work += effort[i]*cost[i];
+		REQUIRE(work == Approx(8.0*(1.0+4.0+16.0)));
+	}
+	// ...but never by more than MAX_COST_RESCALE
+	{
+		const float MAX_RESCALE(fig::ThresholdsBuilderES::MAX_COST_RESCALE);
+		std::vector< float > effort = {1.0f, 8.0f, 8.0f, 8.0f};
+		fig::ThresholdsBuilderES::cost_aware_effort(effort, {0.0, 1.0, 1.0, 1.0e4});
+		REQUIRE(effort[1] == Approx(8.0f*MAX_RESCALE));
+		REQUIRE(effort[2] == Approx(8.0f*MAX_RESCALE));
+		REQUIRE(effort[3] < 8.0f);
+		REQUIRE(effort[3] >= Approx(8.0f/MAX_RESCALE));
+	}
+	// Estimate two criteria with the same simulations
+	{
+		const double confCo1(.9);
+		const double prec1(.4);
+		fig::StoppingConditions twoCrit;
+		twoCrit.add_confidence_criterion(confCo1, prec1);
+		twoCrit.add_confidence_criterion(confCo, prec);
+		ScopedSetting singlePass([](){ model.set_single_pass_estimation(true); },
+		                         [](){ model.set_single_pass_estimation(false); });
+		auto engine = model.prepare_simulation_engine(nameEngine, ifunSpec.name, nameThr, trPropId);
+		REQUIRE(engine->ready());
+		model.estimate(trPropId, *engine, twoCrit, ifunSpec);
+		auto results = model.get_last_estimates();
+		REQUIRE(results.size() == 2ul);
+		auto ci1 = results.front(), ci2 = results.back();
+		REQUIRE(ci1.point_estimate() == Approx(TR_PROB).epsilon(TR_PROB*.3));
+		REQUIRE(ci2.point_estimate() == Approx(TR_PROB).epsilon(TR_PROB*.3));
+		REQUIRE(ci1.num_samples() <= ci2.num_samples());
+		REQUIRE(ci1.precision(confCo1) <= Approx(TR_PROB*prec1).epsilon(TR_PROB*.2));
+		REQUIRE(ci2.precision(confCo) <= Approx(TR_PROB*prec).epsilon(TR_PROB*.2));
+	}
+}
+
 SECTION("Transient: Fixed Effort, monolithic, hyb")
 {
 	const string nameEngine("sfe");